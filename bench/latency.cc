@@ -49,6 +49,22 @@ static void pthreadpool_parallelize_1d_tile_1d(benchmark::State& state) {
 }
 BENCHMARK(pthreadpool_parallelize_1d_tile_1d)->UseRealTime()->Apply(SetNumberOfThreads);
 
+static void pthreadpool_parallelize_1d_tile_1d_pipeline(benchmark::State& state) {
+	const uint32_t threads = static_cast<uint32_t>(state.range(0));
+	pthreadpool_t threadpool = pthreadpool_create(threads);
+	const pthreadpool_task_1d_tile_1d_t stages[2] = { compute_1d_tile_1d, compute_1d_tile_1d };
+	while (state.KeepRunning()) {
+		pthreadpool_parallelize_1d_tile_1d_pipeline(
+			threadpool,
+			stages, 2,
+			nullptr /* context */,
+			threads, 1,
+			0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+}
+BENCHMARK(pthreadpool_parallelize_1d_tile_1d_pipeline)->UseRealTime()->Apply(SetNumberOfThreads);
+
 
 static void compute_2d(void*, size_t, size_t) {
 }
@@ -89,4 +105,46 @@ static void pthreadpool_parallelize_2d_tile_2d(benchmark::State& state) {
 BENCHMARK(pthreadpool_parallelize_2d_tile_2d)->UseRealTime()->Apply(SetNumberOfThreads);
 
 
+
+static void pthreadpool_graph_run_1d(benchmark::State& state) {
+	const uint32_t threads = static_cast<uint32_t>(state.range(0));
+	pthreadpool_t threadpool = pthreadpool_create(threads);
+	pthreadpool_graph_t graph = pthreadpool_graph_create();
+	/* Independent nodes, each as small as the pthreadpool_parallelize_1d benchmark */
+	for (size_t node = 0; node < 8; node++) {
+		pthreadpool_graph_add_1d(
+			graph,
+			compute_1d,
+			nullptr /* context */,
+			threads,
+			0 /* flags */);
+	}
+	while (state.KeepRunning()) {
+		pthreadpool_graph_run(threadpool, graph, 0 /* flags */);
+	}
+	pthreadpool_graph_destroy(graph);
+	pthreadpool_destroy(threadpool);
+}
+BENCHMARK(pthreadpool_graph_run_1d)->UseRealTime()->Apply(SetNumberOfThreads);
+
+
+static void spawn_task(void*) {
+}
+
+static void pthreadpool_task_group_spawn_wait(benchmark::State& state) {
+	const uint32_t threads = static_cast<uint32_t>(state.range(0));
+	pthreadpool_t threadpool = pthreadpool_create(threads);
+	pthreadpool_task_group_t group = pthreadpool_task_group_create(threadpool);
+	while (state.KeepRunning()) {
+		for (uint32_t task = 0; task < threads; task++) {
+			pthreadpool_task_group_spawn(group, spawn_task, nullptr /* context */);
+		}
+		pthreadpool_task_group_wait(group);
+	}
+	pthreadpool_task_group_destroy(group);
+	pthreadpool_destroy(threadpool);
+}
+BENCHMARK(pthreadpool_task_group_spawn_wait)->UseRealTime()->Apply(SetNumberOfThreads);
+
+
 BENCHMARK_MAIN();
@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+
+#include <pthreadpool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+
+static void SetNumberOfThreads(benchmark::internal::Benchmark* benchmark) {
+	/* Powers of two keep the number of runs small on machines with hundreds of processors */
+	const int max_threads = std::thread::hardware_concurrency();
+	for (int t = 1; t < max_threads; t *= 2) {
+		benchmark->Arg(t);
+	}
+	benchmark->Arg(std::max(max_threads, 1));
+}
+
+
+static void compute_1d(void*, size_t) {
+}
+
+/*
+ * One item per thread: every thread runs out of work right away, and the call time is dominated by the tail phase,
+ * when threads look for victims to steal from.
+ */
+static void pthreadpool_parallelize_1d_tail(benchmark::State& state) {
+	const uint32_t threads = static_cast<uint32_t>(state.range(0));
+	pthreadpool_t threadpool = pthreadpool_create(threads);
+	while (state.KeepRunning()) {
+		pthreadpool_parallelize_1d(
+			threadpool,
+			compute_1d,
+			nullptr /* context */,
+			threads,
+			0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+}
+BENCHMARK(pthreadpool_parallelize_1d_tail)->UseRealTime()->Apply(SetNumberOfThreads);
+
+
+static void compute_1d_skewed(void* context, size_t i) {
+	if (i == 0) {
+		/* Only the first item does any work, all other ranges drain immediately */
+		std::atomic<size_t>* counter = static_cast<std::atomic<size_t>*>(context);
+		for (size_t k = 0; k < 1000; k++) {
+			counter->fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+/*
+ * Few items per thread with a single expensive item: idle threads keep scanning for victims while one thread is busy.
+ */
+static void pthreadpool_parallelize_1d_skewed_tail(benchmark::State& state) {
+	const uint32_t threads = static_cast<uint32_t>(state.range(0));
+	pthreadpool_t threadpool = pthreadpool_create(threads);
+	std::atomic<size_t> counter(0);
+	while (state.KeepRunning()) {
+		pthreadpool_parallelize_1d(
+			threadpool,
+			compute_1d_skewed,
+			&counter,
+			threads * 4,
+			0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+}
+BENCHMARK(pthreadpool_parallelize_1d_skewed_tail)->UseRealTime()->Apply(SetNumberOfThreads);
+
+
+BENCHMARK_MAIN();
@@ -26,6 +26,26 @@ static void pthreadpool_parallelize_1d(benchmark::State& state) {
 BENCHMARK(pthreadpool_parallelize_1d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
 
 
+static void pthreadpool_parallelize_1d_batch_claims(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(2);
+	const size_t threads = pthreadpool_get_threads_count(threadpool);
+	const size_t items = static_cast<size_t>(state.range(0));
+	while (state.KeepRunning()) {
+		pthreadpool_parallelize_1d(
+			threadpool,
+			compute_1d,
+			nullptr /* context */,
+			items * threads,
+			PTHREADPOOL_FLAG_BATCH_CLAIMS);
+	}
+	pthreadpool_destroy(threadpool);
+
+	/* Do not normalize by thread */
+	state.SetItemsProcessed(int64_t(state.iterations()) * items);
+}
+BENCHMARK(pthreadpool_parallelize_1d_batch_claims)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+
+
 static void compute_1d_tile_1d(void*, size_t, size_t) {
 }
 
@@ -49,6 +69,29 @@ static void pthreadpool_parallelize_1d_tile_1d(benchmark::State& state) {
 BENCHMARK(pthreadpool_parallelize_1d_tile_1d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
 
 
+static void compute_1d_range(void*, size_t, size_t) {
+}
+
+static void pthreadpool_parallelize_1d_range(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(2);
+	const size_t threads = pthreadpool_get_threads_count(threadpool);
+	const size_t items = static_cast<size_t>(state.range(0));
+	while (state.KeepRunning()) {
+		pthreadpool_parallelize_1d_range(
+			threadpool,
+			compute_1d_range,
+			nullptr /* context */,
+			items * threads, 1,
+			0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+
+	/* Do not normalize by thread */
+	state.SetItemsProcessed(int64_t(state.iterations()) * items);
+}
+BENCHMARK(pthreadpool_parallelize_1d_range)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+
+
 static void compute_2d(void*, size_t, size_t) {
 }
 
@@ -119,6 +162,26 @@ static void pthreadpool_parallelize_2d_tile_2d(benchmark::State& state) {
 }
 BENCHMARK(pthreadpool_parallelize_2d_tile_2d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
 
+static void pthreadpool_parallelize_2d_tile_2d_morton_order(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(2);
+	const size_t threads = pthreadpool_get_threads_count(threadpool);
+	const size_t items = static_cast<size_t>(state.range(0));
+	while (state.KeepRunning()) {
+		pthreadpool_parallelize_2d_tile_2d(
+			threadpool,
+			compute_2d_tile_2d,
+			nullptr /* context */,
+			threads, items,
+			1, 1,
+			PTHREADPOOL_FLAG_MORTON_ORDER);
+	}
+	pthreadpool_destroy(threadpool);
+
+	/* Do not normalize by thread */
+	state.SetItemsProcessed(int64_t(state.iterations()) * items);
+}
+BENCHMARK(pthreadpool_parallelize_2d_tile_2d_morton_order)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+
 
 static void compute_3d(void*, size_t, size_t, size_t) {
 }
@@ -404,4 +467,49 @@ static void pthreadpool_parallelize_6d_tile_2d(benchmark::State& state) {
 BENCHMARK(pthreadpool_parallelize_6d_tile_2d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
 
 
+static void compute_nd(void*, const size_t*, const size_t*) {
+}
+
+static void pthreadpool_parallelize_nd_2d(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(2);
+	const size_t threads = pthreadpool_get_threads_count(threadpool);
+	const size_t items = static_cast<size_t>(state.range(0));
+	const size_t range[2] = { threads, items };
+	while (state.KeepRunning()) {
+		pthreadpool_parallelize_nd(
+			threadpool,
+			compute_nd,
+			nullptr /* context */,
+			2, range, nullptr /* tile */,
+			0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+
+	/* Do not normalize by thread */
+	state.SetItemsProcessed(int64_t(state.iterations()) * items);
+}
+BENCHMARK(pthreadpool_parallelize_nd_2d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+
+
+static void pthreadpool_parallelize_nd_6d(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(2);
+	const size_t threads = pthreadpool_get_threads_count(threadpool);
+	const size_t items = static_cast<size_t>(state.range(0));
+	const size_t range[6] = { 1, 1, 1, 1, threads, items };
+	while (state.KeepRunning()) {
+		pthreadpool_parallelize_nd(
+			threadpool,
+			compute_nd,
+			nullptr /* context */,
+			6, range, nullptr /* tile */,
+			0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+
+	/* Do not normalize by thread */
+	state.SetItemsProcessed(int64_t(state.iterations()) * items);
+}
+BENCHMARK(pthreadpool_parallelize_nd_6d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+
+
 BENCHMARK_MAIN();
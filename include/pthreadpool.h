@@ -5,6 +5,9 @@
 #include <stdint.h>
 
 typedef struct pthreadpool* pthreadpool_t;
+typedef struct pthreadpool_job* pthreadpool_job_t;
+typedef struct pthreadpool_graph* pthreadpool_graph_t;
+typedef struct pthreadpool_task_group* pthreadpool_task_group_t;
 
 typedef void (*pthreadpool_task_1d_t)(void*, size_t);
 typedef void (*pthreadpool_task_1d_with_thread_t)(void*, size_t, size_t);
@@ -26,6 +29,15 @@ typedef void (*pthreadpool_task_5d_tile_2d_t)(void*, size_t, size_t, size_t, siz
 typedef void (*pthreadpool_task_6d_t)(void*, size_t, size_t, size_t, size_t, size_t, size_t);
 typedef void (*pthreadpool_task_6d_tile_1d_t)(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t);
 typedef void (*pthreadpool_task_6d_tile_2d_t)(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t, size_t);
+typedef void (*pthreadpool_task_1d_indexed_tile_1d_t)(void*, const size_t*, size_t);
+typedef void (*pthreadpool_task_1d_indexed_u32_tile_1d_t)(void*, const uint32_t*, size_t);
+typedef void (*pthreadpool_task_ragged_2d_t)(void*, size_t, size_t);
+typedef void (*pthreadpool_task_ragged_2d_tile_1d_t)(void*, size_t, size_t, size_t);
+typedef void (*pthreadpool_task_1d_range_t)(void*, size_t, size_t);
+typedef void (*pthreadpool_task_2d_range_t)(void*, size_t, size_t, size_t);
+typedef void (*pthreadpool_task_nd_t)(void*, const size_t*, const size_t*);
+typedef void (*pthreadpool_task_nd_range_t)(void*, const size_t*, size_t, size_t);
+typedef void (*pthreadpool_spawn_task_t)(void*);
 
 typedef void (*pthreadpool_task_1d_with_id_t)(void*, uint32_t, size_t);
 typedef void (*pthreadpool_task_2d_tile_1d_with_id_t)(void*, uint32_t, size_t, size_t, size_t);
@@ -68,6 +80,153 @@ typedef void (*pthreadpool_task_3d_tile_1d_with_id_with_thread_t)(void*, uint32_
  */
 #define PTHREADPOOL_FLAG_YIELD_WORKERS 0x00000002
 
+/**
+ * Claim items in batches rather than one-by-one.
+ *
+ * Each worker thread claims a fraction of the remaining items in its range at
+ * once, which reduces synchronization overhead for short tasks. The batches
+ * shrink as the range nears its end, where other threads steal items. Items in
+ * a claimed batch can not be stolen by other threads, thus with this flag a
+ * task must not wait for completion of other items in the same computation.
+ */
+#define PTHREADPOOL_FLAG_BATCH_CLAIMS 0x00000004
+
+/**
+ * Process items with a static schedule.
+ *
+ * The items are evenly split between threads, and each thread processes only
+ * its own part of the range, without stealing items from other threads. As a
+ * result, computations with the same range on the same thread pool always map
+ * the same items to the same threads, which lets subsequent computations reuse
+ * data cached by the previous ones. With this flag a task must not wait for
+ * completion of other items in the same computation.
+ */
+#define PTHREADPOOL_FLAG_STATIC_SCHEDULE 0x00000008
+
+/**
+ * Process items with a dynamic schedule.
+ *
+ * Rather than splitting the items between threads in advance, all threads
+ * claim items one-by-one from a shared counter, similarly to OpenMP
+ * schedule(dynamic). This schedule suits computations with very irregular
+ * costs of items, and computations with few items per thread. The size of
+ * items, and thus the granularity of the schedule, is controlled by the tile
+ * sizes of the parallelization function. Combined with
+ * PTHREADPOOL_FLAG_BATCH_CLAIMS, each claim takes a chunk of 1/8 of the items
+ * per thread, similarly to OpenMP schedule(dynamic, chunk), and the items in a
+ * chunk are processed by the claiming thread. This flag takes priority over
+ * PTHREADPOOL_FLAG_STATIC_SCHEDULE.
+ */
+#define PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE 0x00000010
+
+/**
+ * Process items with a guided schedule.
+ *
+ * Similarly to PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE, all threads claim items from
+ * a shared counter, but each claim takes a chunk of items proportional to the
+ * number of remaining items divided by the number of threads, similarly to
+ * OpenMP schedule(guided). Items in a claimed chunk are processed by the
+ * claiming thread, thus with this flag a task must not wait for completion of
+ * other items in the same computation. This flag takes priority over
+ * PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE, PTHREADPOOL_FLAG_STATIC_SCHEDULE, and
+ * PTHREADPOOL_FLAG_BATCH_CLAIMS.
+ */
+#define PTHREADPOOL_FLAG_GUIDED_SCHEDULE 0x00000020
+
+/**
+ * Adapt the split of items between threads to the previous computations.
+ *
+ * The thread pool remembers how many items threads stole from each other in
+ * recent computations with this flag, and moves the boundaries between the
+ * ranges of the threads accordingly in the next computation with the same
+ * function, task, and range. Over repeated computations with consistent costs
+ * of items the split converges to a balanced partition with little stealing.
+ * The flag has no effect with PTHREADPOOL_FLAG_STATIC_SCHEDULE,
+ * PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE, or PTHREADPOOL_FLAG_GUIDED_SCHEDULE.
+ */
+#define PTHREADPOOL_FLAG_ADAPTIVE_PARTITION 0x00000040
+
+/**
+ * Traverse the tiles of a 2D grid in Morton (Z-curve) order.
+ *
+ * By default tiles are linearized in row-major order, thus the contiguous part
+ * of the grid assigned to each thread consists of a few long strips of tiles.
+ * With this flag tiles are linearized along a Z-curve instead, thus each thread
+ * processes a compact 2D patch of tiles and touches fewer rows and columns of
+ * the operands, and tiles stolen from another thread stay close to the patch of
+ * that thread. The flag affects pthreadpool_parallelize_2d_tile_2d, and the
+ * grid of tiles along the second and third dimensions in
+ * pthreadpool_parallelize_3d_tile_2d. The function is still called exactly
+ * once for every tile, only the order and the assignment of tiles to threads
+ * change.
+ */
+#define PTHREADPOOL_FLAG_MORTON_ORDER 0x00000080
+
+/**
+ * Assign parts of the range to worker threads by the processor they run on.
+ *
+ * Worker threads of thread pools which are not created with
+ * pthreadpool_create_pinned are not pinned, and the system scheduler migrates
+ * them between processors. Then the part of the range a worker thread processes
+ * has no relation to the data cached by its current processor. With this flag
+ * each worker thread takes the part of the range which was processed on its
+ * current processor in the previous computation with this flag, and steals
+ * items first from threads running on processors which share the last-level
+ * cache with its processor. Repeated computations over the same data thus keep
+ * their cache affinity as threads migrate. On Linux the current processor is
+ * read from the restartable sequences (rseq) area registered by the C library,
+ * or obtained with sched_getcpu if rseq is not available. On other systems, and
+ * for thread pools with pinned threads, the flag has no effect. Thread numbers
+ * passed to the tasks of *_with_thread functions identify the parts of the
+ * range, thus they are still unique among concurrently running tasks, but a
+ * system thread may get a different thread number in the next computation.
+ */
+#define PTHREADPOOL_FLAG_CPU_AFFINITY 0x00000100
+
+/**
+ * Let the computation run concurrently with the computation of another caller.
+ *
+ * By default, parallelization calls from different threads are serialized:
+ * a call waits until the thread pool finishes the computation of the previous
+ * caller. When this flag is specified and the thread pool is busy, the call
+ * doesn't wait: items are split between the threads of the thread pool, and
+ * threads which finished their share of the running computation, or are
+ * idle after it, process them. The calling thread waits until all items are
+ * processed, and starts processing them itself once the thread pool is no
+ * longer busy with other callers. Concurrent computations ignore
+ * PTHREADPOOL_FLAG_STATIC_SCHEDULE, PTHREADPOOL_FLAG_ADAPTIVE_PARTITION and
+ * PTHREADPOOL_FLAG_CPU_AFFINITY. The calling thread processes items as
+ * thread 0 only while it holds the thread pool, thus tasks of *_with_thread
+ * functions still get unique thread numbers. With Grand Central Dispatch the
+ * flag has no effect.
+ */
+#define PTHREADPOOL_FLAG_CONCURRENT_JOBS 0x00000200
+
+/**
+ * Process the items on the calling thread instead of waiting for a busy
+ * thread pool.
+ *
+ * When the thread pool is processing a computation of another caller, the
+ * parallelization function doesn't wait for it, and processes all items on
+ * the calling thread, as if the thread pool had a single thread. Tasks of
+ * *_with_thread functions get thread number 0 then, which is also used by the
+ * thread pool in the other computation. pthreadpool_last_try_ran_inline
+ * reports whether the items were processed on the calling thread. This flag
+ * takes precedence over PTHREADPOOL_FLAG_CONCURRENT_JOBS.
+ */
+#define PTHREADPOOL_FLAG_TRY 0x00000400
+
+/**
+ * Maximum number of dimensions of a grid processed by pthreadpool_parallelize_nd.
+ */
+#define PTHREADPOOL_MAX_DIMENSIONS 16
+
+/**
+ * Node index returned by pthreadpool_graph_add_* functions when the node
+ * can't be added to the graph.
+ */
+#define PTHREADPOOL_GRAPH_NODE_NONE SIZE_MAX
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -75,6 +234,15 @@ extern "C" {
 /**
  * Create a thread pool with the specified number of threads.
  *
+ * Tasks may call parallelization functions on the same thread pool. A nested
+ * call doesn't create threads: the calling thread starts processing all items
+ * of the nested computation, and threads of the thread pool which finished
+ * their share of the outer computation steal items from it while they
+ * spin-wait. Thread numbers passed to the tasks of *_with_thread functions in
+ * nested computations identify the system threads of the thread pool, and
+ * unless PTHREADPOOL_FLAG_CPU_AFFINITY is used in the outer computation, match
+ * the thread numbers passed to its tasks.
+ *
  * @param  threads_count  the number of threads in the thread pool.
  *    A value of 0 has special interpretation: it creates a thread pool with as
  *    many threads as there are logical processors in the system.
@@ -84,6 +252,32 @@ extern "C" {
  */
 pthreadpool_t pthreadpool_create(size_t threads_count);
 
+/**
+ * Create a thread pool with the specified number of threads, and pin its
+ * worker threads to processors.
+ *
+ * If the thread pool has as many threads as there are processors the calling
+ * thread may run on, each worker thread is pinned to its own processor, and
+ * threads in the same core, cache, and NUMA node get consecutive thread
+ * numbers. Threads then steal work from threads on nearby processors first,
+ * and capacities of threads follow the capacities of their processors.
+ * Otherwise, and on systems other than Linux, this function is equivalent to
+ * pthreadpool_create. The calling thread, which serves as thread #0, is never
+ * pinned.
+ *
+ * Pinning suits processes which run a single thread pool over all processors:
+ * the threads of several pinned thread pools share the same processors, and
+ * worker threads ignore later changes of the affinity of the process.
+ *
+ * @param  threads_count  the number of threads in the thread pool.
+ *    A value of 0 has special interpretation: it creates a thread pool with as
+ *    many threads as there are logical processors in the system.
+ *
+ * @returns  A pointer to an opaque thread pool object if the call is
+ *    successful, or NULL pointer if the call failed.
+ */
+pthreadpool_t pthreadpool_create_pinned(size_t threads_count);
+
 /**
  * Query the number of threads in a thread pool.
  *
@@ -93,6 +287,43 @@ pthreadpool_t pthreadpool_create(size_t threads_count);
  */
 size_t pthreadpool_get_threads_count(pthreadpool_t threadpool);
 
+/**
+ * Query whether the last parallelization call with PTHREADPOOL_FLAG_TRY on the
+ * calling thread found the thread pool busy and processed the items on the
+ * calling thread.
+ *
+ * Every call with PTHREADPOOL_FLAG_TRY updates the result. Calls which
+ * process items on the calling thread for other reasons, e.g. because the
+ * thread pool has a single thread, or because the call is made from a task of
+ * a computation on the same thread pool, report 0.
+ *
+ * @returns  1 if the items were processed on the calling thread because the
+ *    thread pool was busy, 0 otherwise.
+ */
+int pthreadpool_last_try_ran_inline(void);
+
+/**
+ * Override the relative capacities of threads in a thread pool.
+ *
+ * Computations split items between threads in proportion to the capacities of
+ * threads, so that faster threads receive larger shares of items. By default,
+ * when pthreadpool_create_pinned pins threads to processors, capacities of
+ * threads are detected from the capacities of processors reported by the
+ * operating system, and are equal otherwise. Overriding capacities is primarily
+ * useful for testing the weighted split on machines with identical processors.
+ *
+ * This function must not be called concurrently with computations on the same
+ * thread pool.
+ *
+ * @param  threadpool  the thread pool to modify.
+ * @param  capacities  array of threads_count relative capacities of threads,
+ *    in the [1, 65535] range, or NULL to make all threads equal. Thread #0
+ *    is the thread which calls the parallelization functions.
+ */
+void pthreadpool_set_thread_capacities(
+	pthreadpool_t threadpool,
+	const uint32_t* capacities);
+
 /**
  * Process items on a 1D grid.
  *
@@ -123,6 +354,92 @@ void pthreadpool_parallelize_1d(
 	size_t range,
 	uint32_t flags);
 
+/**
+ * Start processing items on a 1D grid without waiting for the items.
+ *
+ * The function processes the same items as pthreadpool_parallelize_1d, but
+ * returns as soon as the items are handed to the thread pool. Idle threads of
+ * the thread pool process the items, and the calling thread is free to do
+ * other work, e.g. I/O or preparation of the next job. Several jobs may run
+ * on the same thread pool at the same time, and concurrently with calls of
+ * the synchronous parallelization functions.
+ *
+ * The returned job must be passed to pthreadpool_wait exactly once, before the
+ * context is released and before the thread pool is destroyed. The order in
+ * which items are processed is not specified, and
+ * PTHREADPOOL_FLAG_STATIC_SCHEDULE, PTHREADPOOL_FLAG_ADAPTIVE_PARTITION and
+ * PTHREADPOOL_FLAG_CPU_AFFINITY have no effect.
+ *
+ * @note When the library is built on Grand Central Dispatch, which provides no
+ *    idle threads to hand the items to, the function processes all items in
+ *    parallel before returning, like pthreadpool_parallelize_1d, and always
+ *    returns NULL.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param function    the function to call for each item.
+ * @param context     the first argument passed to the specified function.
+ * @param range       the number of items on the 1D grid to process. The
+ *    specified function will be called once for each item.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ *
+ * @returns  The job to wait for, or NULL if all items were processed before
+ *    the function returned.
+ */
+pthreadpool_job_t pthreadpool_parallelize_1d_async(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_t function,
+	void* context,
+	size_t range,
+	uint32_t flags);
+
+/**
+ * Process items with different costs on a 1D grid.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < range; i++)
+ *     function(context, i);
+ *
+ * Unlike pthreadpool_parallelize_1d, which splits items between threads by
+ * count, this function splits items by their total weight, so that every
+ * thread starts with an equal share of work, and threads which run out of
+ * work steal about half of the remaining weight of other threads. Weights are
+ * only hints: they affect the split, but every item is processed exactly once
+ * regardless of its weight. With PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE or
+ * PTHREADPOOL_FLAG_GUIDED_SCHEDULE items are claimed by count, and weights
+ * are ignored.
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool          the thread pool to use for parallelisation. If
+ *    threadpool is NULL, all items are processed serially on the calling
+ *    thread.
+ * @param function            the function to call for each item.
+ * @param context             the first argument passed to the specified
+ *    function.
+ * @param cumulative_weights  the prefix sums of the weights of items:
+ *    cumulative_weights[i] is the total weight of items 0..i, inclusive. The
+ *    array must contain range non-decreasing elements.
+ * @param range               the number of items on the 1D grid to process.
+ *    The specified function will be called once for each item.
+ * @param flags               a bitwise combination of zero or more optional
+ *    flags (PTHREADPOOL_FLAG_DISABLE_DENORMALS or
+ *    PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_1d_weighted(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_t function,
+	void* context,
+	const size_t* cumulative_weights,
+	size_t range,
+	uint32_t flags);
+
 /**
  * Process items on a 1D grid passing along the current thread id.
  *
@@ -232,82 +549,102 @@ void pthreadpool_parallelize_1d_tile_1d(
 	uint32_t flags);
 
 /**
- * Process items on a 2D grid.
+ * Process tiles on a 1D grid through a pipeline of several stages.
  *
  * The function implements a parallel version of the following snippet:
  *
- *   for (size_t i = 0; i < range_i; i++)
- *     for (size_t j = 0; j < range_j; j++)
- *       function(context, i, j);
+ *   for (size_t k = 0; k < stages_count; k++)
+ *     for (size_t i = 0; i < range; i += tile)
+ *       stages[k](context, i, min(range - i, tile));
  *
- * When the function returns, all items have been processed and the thread pool
- * is ready for a new task.
+ * where stage k of a tile depends only on the previous stages of the same
+ * tile. Unlike consecutive pthreadpool_parallelize_1d_tile_1d calls, there is
+ * no barrier between stages: the thread which claims a tile runs all stages
+ * of the tile back to back, while its data is still in the cache of the
+ * processor. Tiles pass through the stages independently, so different stages
+ * of different tiles may run at the same time.
  *
- * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ * When the call returns, all stages of all tiles have been processed and the
+ * thread pool is ready for a new task.
  *
- * @param threadpool  the thread pool to use for parallelisation. If threadpool
- *    is NULL, all items are processed serially on the calling thread.
- * @param function    the function to call for each item.
- * @param context     the first argument passed to the specified function.
- * @param range_i     the number of items to process along the first dimension
- *    of the 2D grid.
- * @param range_j     the number of items to process along the second dimension
- *    of the 2D grid.
- * @param flags       a bitwise combination of zero or more optional flags
+ * @note If multiple threads call this function with the same thread pool,
+ *    the calls are serialized.
+ *
+ * @param threadpool    the thread pool to use for parallelisation. If
+ *    threadpool is NULL, all tiles are processed serially on the calling
+ *    thread.
+ * @param stages        the functions to call for each tile, in the order of
+ *    the stages.
+ * @param stages_count  the number of stages.
+ * @param context       the first argument passed to the stage functions.
+ * @param range         the number of items on the 1D grid to process.
+ * @param tile          the maximum number of items on the 1D grid to process in
+ *    one function call.
+ * @param flags         a bitwise combination of zero or more optional flags
  *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
  */
-void pthreadpool_parallelize_2d(
+void pthreadpool_parallelize_1d_tile_1d_pipeline(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_t function,
+	const pthreadpool_task_1d_tile_1d_t* stages,
+	size_t stages_count,
 	void* context,
-	size_t range_i,
-	size_t range_j,
+	size_t range,
+	size_t tile,
 	uint32_t flags);
 
 /**
- * Process items on a 2D grid passing along the current thread id.
+ * Process items on a 1D grid in contiguous runs of the longest length
+ * available to each thread.
  *
  * The function implements a parallel version of the following snippet:
  *
- *   for (size_t i = 0; i < range_i; i++)
- *     for (size_t j = 0; j < range_j; j++)
- *       function(context, thread_index, i, j);
+ *   function(context, 0, range);
  *
- * When the function returns, all items have been processed and the thread pool
- * is ready for a new task.
+ * where the range is split into runs [start, end) which are passed to the
+ * function in parallel. Each thread passes all items it claimed at once as a
+ * single run, so the function is called far fewer times than with
+ * pthreadpool_parallelize_1d, and the loop over a run in the function can be
+ * vectorized. Run boundaries, except the end of the range, are multiples of
+ * the alignment, thus runs processed by different threads don't share cache
+ * lines or SIMD vectors of outputs indexed by items when the alignment is a
+ * multiple of the number of items in a cache line or SIMD vector.
  *
- * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ * Items in a run can not be stolen by other threads, thus the function must
+ * not wait for completion of other items in the same computation.
+ *
+ * When the call returns, all items have been processed and the thread pool is
+ * ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool,
+ *    the calls are serialized.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
- * @param function    the function to call for each item.
+ * @param function    the function to call for each run of items.
  * @param context     the first argument passed to the specified function.
- * @param range_i     the number of items to process along the first dimension
- *    of the 2D grid.
- * @param range_j     the number of items to process along the second dimension
- *    of the 2D grid.
+ * @param range       the number of items on the 1D grid to process.
+ * @param alignment   the granularity of run boundaries. Zero is treated as 1.
  * @param flags       a bitwise combination of zero or more optional flags
  *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
  */
-void pthreadpool_parallelize_2d_with_thread(
+void pthreadpool_parallelize_1d_range(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_with_thread_t function,
+	pthreadpool_task_1d_range_t function,
 	void* context,
-	size_t range_i,
-	size_t range_j,
+	size_t range,
+	size_t alignment,
 	uint32_t flags);
 
 /**
- * Process items on a 2D grid with the specified maximum tile size along the
- * last grid dimension.
+ * Process items from a list of indices.
  *
  * The function implements a parallel version of the following snippet:
  *
- *   for (size_t i = 0; i < range_i; i++)
- *     for (size_t j = 0; j < range_j; j += tile_j)
- *       function(context, i, j, min(range_j - j, tile_j));
+ *   for (size_t p = 0; p < count; p++)
+ *     function(context, indices[p]);
+ *
+ * Positions in the list, rather than the indices, are split between threads,
+ * so only the listed items are dispatched regardless of the range of indices.
  *
  * When the function returns, all items have been processed and the thread pool
  * is ready for a new task.
@@ -317,90 +654,54 @@ void pthreadpool_parallelize_2d_with_thread(
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
- * @param function    the function to call for each tile.
+ * @param function    the function to call for each index in the list.
  * @param context     the first argument passed to the specified function.
- * @param range_i     the number of items to process along the first dimension
- *    of the 2D grid.
- * @param range_j     the number of items to process along the second dimension
- *    of the 2D grid.
- * @param tile_j      the maximum number of items along the second dimension of
- *    the 2D grid to process in one function call.
+ * @param indices     the list of indices of items to process.
+ * @param count       the number of indices in the list.
  * @param flags       a bitwise combination of zero or more optional flags
  *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
  */
-void pthreadpool_parallelize_2d_tile_1d(
+void pthreadpool_parallelize_1d_indexed(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_tile_1d_t function,
+	pthreadpool_task_1d_t function,
 	void* context,
-	size_t range_i,
-	size_t range_j,
-	size_t tile_j,
+	const size_t* indices,
+	size_t count,
 	uint32_t flags);
 
 /**
- * Process items on a 2D grid with the specified maximum tile size along the
- * last grid dimension using a microarchitecture-aware task function.
- *
- * The function implements a parallel version of the following snippet:
- *
- *   uint32_t uarch_index = cpuinfo_initialize() ?
- *       cpuinfo_get_current_uarch_index() : default_uarch_index;
- *   if (uarch_index > max_uarch_index) uarch_index = default_uarch_index;
- *   for (size_t i = 0; i < range_i; i++)
- *     for (size_t j = 0; j < range_j; j += tile_j)
- *       function(context, uarch_index, i, j, min(range_j - j, tile_j));
- *
- * When the function returns, all items have been processed and the thread pool
- * is ready for a new task.
+ * Process items from a list of 32-bit indices.
  *
- * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ * The function is equivalent to pthreadpool_parallelize_1d_indexed, but
+ * takes a list of 32-bit indices.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
- * @param function    the function to call for each tile.
+ * @param function    the function to call for each index in the list.
  * @param context     the first argument passed to the specified function.
- * @param default_uarch_index  the microarchitecture index to use when
- *    pthreadpool is configured without cpuinfo, cpuinfo initialization failed,
- *    or index returned by cpuinfo_get_current_uarch_index() exceeds the
- *    max_uarch_index value.
- * @param max_uarch_index      the maximum microarchitecture index expected by
- *    the specified function. If the index returned by
- *    cpuinfo_get_current_uarch_index() exceeds this value, default_uarch_index
- *    will be used instead. default_uarch_index can exceed max_uarch_index.
- * @param range_i     the number of items to process along the first dimension
- *    of the 2D grid.
- * @param range_j     the number of items to process along the second dimension
- *    of the 2D grid.
- * @param tile_j      the maximum number of items along the second dimension of
- *    the 2D grid to process in one function call.
+ * @param indices     the list of indices of items to process.
+ * @param count       the number of indices in the list.
  * @param flags       a bitwise combination of zero or more optional flags
  *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
  */
-void pthreadpool_parallelize_2d_tile_1d_with_uarch(
+void pthreadpool_parallelize_1d_indexed_u32(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_tile_1d_with_id_t function,
+	pthreadpool_task_1d_t function,
 	void* context,
-	uint32_t default_uarch_index,
-	uint32_t max_uarch_index,
-	size_t range_i,
-	size_t range_j,
-	size_t tile_j,
+	const uint32_t* indices,
+	size_t count,
 	uint32_t flags);
 
 /**
- * Process items on a 2D grid with the specified maximum tile size along the
- * last grid dimension using a microarchitecture-aware task function and passing
- * along the current thread id.
+ * Process slices of a list of indices with specified maximum slice size.
  *
  * The function implements a parallel version of the following snippet:
  *
- *   uint32_t uarch_index = cpuinfo_initialize() ?
- *       cpuinfo_get_current_uarch_index() : default_uarch_index;
- *   if (uarch_index > max_uarch_index) uarch_index = default_uarch_index;
- *   for (size_t i = 0; i < range_i; i++)
- *     for (size_t j = 0; j < range_j; j += tile_j)
- *       function(context, uarch_index, thread_index, i, j, min(range_j - j, tile_j));
+ *   for (size_t p = 0; p < count; p += tile)
+ *     function(context, indices + p, min(count - p, tile));
+ *
+ * Every function call receives a contiguous slice of the list, so that the
+ * function can gather the listed items with vector instructions.
  *
  * When the function returns, all items have been processed and the thread pool
  * is ready for a new task.
@@ -410,52 +711,432 @@ void pthreadpool_parallelize_2d_tile_1d_with_uarch(
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
- * @param function    the function to call for each tile.
+ * @param function    the function to call for each slice of the list.
  * @param context     the first argument passed to the specified function.
- * @param default_uarch_index  the microarchitecture index to use when
- *    pthreadpool is configured without cpuinfo, cpuinfo initialization failed,
- *    or index returned by cpuinfo_get_current_uarch_index() exceeds the
- *    max_uarch_index value.
- * @param max_uarch_index      the maximum microarchitecture index expected by
- *    the specified function. If the index returned by
- *    cpuinfo_get_current_uarch_index() exceeds this value, default_uarch_index
- *    will be used instead. default_uarch_index can exceed max_uarch_index.
- * @param range_i     the number of items to process along the first dimension
- *    of the 2D grid.
- * @param range_j     the number of items to process along the second dimension
- *    of the 2D grid.
- * @param tile_j      the maximum number of items along the second dimension of
- *    the 2D grid to process in one function call.
+ * @param indices     the list of indices of items to process.
+ * @param count       the number of indices in the list.
+ * @param tile        the maximum number of indices to process in one function
+ *    call.
  * @param flags       a bitwise combination of zero or more optional flags
  *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
  */
-void pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+void pthreadpool_parallelize_1d_indexed_tile_1d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_tile_1d_with_id_with_thread_t function,
+	pthreadpool_task_1d_indexed_tile_1d_t function,
 	void* context,
-	uint32_t default_uarch_index,
-	uint32_t max_uarch_index,
-	size_t range_i,
-	size_t range_j,
-	size_t tile_j,
+	const size_t* indices,
+	size_t count,
+	size_t tile,
 	uint32_t flags);
 
 /**
- * Process items on a 2D grid with the specified maximum tile size along each
- * grid dimension.
- *
- * The function implements a parallel version of the following snippet:
- *
- *   for (size_t i = 0; i < range_i; i += tile_i)
- *     for (size_t j = 0; j < range_j; j += tile_j)
- *       function(context, i, j,
- *         min(range_i - i, tile_i), min(range_j - j, tile_j));
+ * Process slices of a list of 32-bit indices with specified maximum slice size.
  *
- * When the function returns, all items have been processed and the thread pool
- * is ready for a new task.
+ * The function is equivalent to pthreadpool_parallelize_1d_indexed_tile_1d,
+ * but takes a list of 32-bit indices.
  *
- * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param function    the function to call for each slice of the list.
+ * @param context     the first argument passed to the specified function.
+ * @param indices     the list of indices of items to process.
+ * @param count       the number of indices in the list.
+ * @param tile        the maximum number of indices to process in one function
+ *    call.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_1d_indexed_u32_tile_1d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_indexed_u32_tile_1d_t function,
+	void* context,
+	const uint32_t* indices,
+	size_t count,
+	size_t tile,
+	uint32_t flags);
+
+/**
+ * Process items on a ragged 2D grid described by row offsets.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < rows; i++)
+ *     for (size_t k = 0; k < row_offsets[i + 1] - row_offsets[i]; k++)
+ *       function(context, i, k);
+ *
+ * Items of all rows are linearized, and split between threads by count of
+ * items rather than by count of rows, so that rows of very different lengths
+ * don't unbalance the work, as in compressed sparse row (CSR) matrices.
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool   the thread pool to use for parallelisation. If
+ *    threadpool is NULL, all items are processed serially on the calling
+ *    thread.
+ * @param function     the function to call for each item.
+ * @param context      the first argument passed to the specified function.
+ * @param row_offsets  the array of rows + 1 non-decreasing offsets of rows:
+ *    row i contains row_offsets[i + 1] - row_offsets[i] items.
+ * @param rows         the number of rows on the ragged 2D grid to process.
+ * @param flags        a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_ragged_2d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_ragged_2d_t function,
+	void* context,
+	const size_t* row_offsets,
+	size_t rows,
+	uint32_t flags);
+
+/**
+ * Process segments of rows on a ragged 2D grid described by row offsets.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t t = 0; t < row_offsets[rows] - row_offsets[0]; t += tile)
+ *     for (size_t i = 0; i < rows; i++)
+ *       if (the items [t, t + tile) of the linearized grid overlap row i)
+ *         function(context, i, start, count);
+ *
+ * where start is the index of the first overlapping item within row i, and
+ * count is the number of overlapping items. Items of all rows are linearized,
+ * and split into tiles of up to tile items, which are distributed between
+ * threads. Every function call processes a contiguous segment of one row,
+ * and a tile which spans several rows is processed in several calls.
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool   the thread pool to use for parallelisation. If
+ *    threadpool is NULL, all items are processed serially on the calling
+ *    thread.
+ * @param function     the function to call for each segment of a row.
+ * @param context      the first argument passed to the specified function.
+ * @param row_offsets  the array of rows + 1 non-decreasing offsets of rows:
+ *    row i contains row_offsets[i + 1] - row_offsets[i] items.
+ * @param rows         the number of rows on the ragged 2D grid to process.
+ * @param tile         the maximum number of items of the linearized grid to
+ *    process in one tile.
+ * @param flags        a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_ragged_2d_tile_1d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_ragged_2d_tile_1d_t function,
+	void* context,
+	const size_t* row_offsets,
+	size_t rows,
+	size_t tile,
+	uint32_t flags);
+
+/**
+ * Process items on a 2D grid.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < range_i; i++)
+ *     for (size_t j = 0; j < range_j; j++)
+ *       function(context, i, j);
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param function    the function to call for each item.
+ * @param context     the first argument passed to the specified function.
+ * @param range_i     the number of items to process along the first dimension
+ *    of the 2D grid.
+ * @param range_j     the number of items to process along the second dimension
+ *    of the 2D grid.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_2d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_t function,
+	void* context,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags);
+
+/**
+ * Start processing items on a 2D grid without waiting for the items.
+ *
+ * The function processes the same items as pthreadpool_parallelize_2d, but
+ * returns as soon as the items are handed to the thread pool. See
+ * pthreadpool_parallelize_1d_async for the semantics of the returned job.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param function    the function to call for each item.
+ * @param context     the first argument passed to the specified function.
+ * @param range_i     the number of items to process along the first dimension
+ *    of the 2D grid.
+ * @param range_j     the number of items to process along the second dimension
+ *    of the 2D grid.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ *
+ * @returns  The job to wait for, or NULL if all items were processed before
+ *    the function returned.
+ */
+pthreadpool_job_t pthreadpool_parallelize_2d_async(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_t function,
+	void* context,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags);
+
+/**
+ * Process items on a 2D grid passing along the current thread id.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < range_i; i++)
+ *     for (size_t j = 0; j < range_j; j++)
+ *       function(context, thread_index, i, j);
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param function    the function to call for each item.
+ * @param context     the first argument passed to the specified function.
+ * @param range_i     the number of items to process along the first dimension
+ *    of the 2D grid.
+ * @param range_j     the number of items to process along the second dimension
+ *    of the 2D grid.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_2d_with_thread(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_with_thread_t function,
+	void* context,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags);
+
+/**
+ * Process items on a 2D grid with the specified maximum tile size along the
+ * last grid dimension.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < range_i; i++)
+ *     for (size_t j = 0; j < range_j; j += tile_j)
+ *       function(context, i, j, min(range_j - j, tile_j));
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param function    the function to call for each tile.
+ * @param context     the first argument passed to the specified function.
+ * @param range_i     the number of items to process along the first dimension
+ *    of the 2D grid.
+ * @param range_j     the number of items to process along the second dimension
+ *    of the 2D grid.
+ * @param tile_j      the maximum number of items along the second dimension of
+ *    the 2D grid to process in one function call.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_2d_tile_1d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_1d_t function,
+	void* context,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_j,
+	uint32_t flags);
+
+/**
+ * Process items on a 2D grid in contiguous runs along the last grid dimension.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < range_i; i++)
+ *     function(context, i, 0, range_j);
+ *
+ * where each row is split into runs [start_j, end_j) which are passed to the
+ * function in parallel. Each thread passes all items it claimed within a row
+ * at once as a single run. Run boundaries, except the end of a row, are
+ * multiples of alignment_j. Higher-dimensional grids are processed by
+ * pthreadpool_parallelize_nd_range.
+ *
+ * Items in a run can not be stolen by other threads, thus the function must
+ * not wait for completion of other items in the same computation.
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool   the thread pool to use for parallelisation. If
+ *    threadpool is NULL, all items are processed serially on the calling
+ *    thread.
+ * @param function     the function to call for each run of items.
+ * @param context      the first argument passed to the specified function.
+ * @param range_i      the number of items to process along the first
+ *    dimension of the 2D grid.
+ * @param range_j      the number of items to process along the second
+ *    dimension of the 2D grid.
+ * @param alignment_j  the granularity of run boundaries along the second
+ *    dimension of the 2D grid. Zero is treated as 1.
+ * @param flags        a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_2d_range(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_range_t function,
+	void* context,
+	size_t range_i,
+	size_t range_j,
+	size_t alignment_j,
+	uint32_t flags);
+
+/**
+ * Process items on a 2D grid with the specified maximum tile size along the
+ * last grid dimension using a microarchitecture-aware task function.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   uint32_t uarch_index = cpuinfo_initialize() ?
+ *       cpuinfo_get_current_uarch_index() : default_uarch_index;
+ *   if (uarch_index > max_uarch_index) uarch_index = default_uarch_index;
+ *   for (size_t i = 0; i < range_i; i++)
+ *     for (size_t j = 0; j < range_j; j += tile_j)
+ *       function(context, uarch_index, i, j, min(range_j - j, tile_j));
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param function    the function to call for each tile.
+ * @param context     the first argument passed to the specified function.
+ * @param default_uarch_index  the microarchitecture index to use when
+ *    pthreadpool is configured without cpuinfo, cpuinfo initialization failed,
+ *    or index returned by cpuinfo_get_current_uarch_index() exceeds the
+ *    max_uarch_index value.
+ * @param max_uarch_index      the maximum microarchitecture index expected by
+ *    the specified function. If the index returned by
+ *    cpuinfo_get_current_uarch_index() exceeds this value, default_uarch_index
+ *    will be used instead. default_uarch_index can exceed max_uarch_index.
+ * @param range_i     the number of items to process along the first dimension
+ *    of the 2D grid.
+ * @param range_j     the number of items to process along the second dimension
+ *    of the 2D grid.
+ * @param tile_j      the maximum number of items along the second dimension of
+ *    the 2D grid to process in one function call.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_2d_tile_1d_with_uarch(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_1d_with_id_t function,
+	void* context,
+	uint32_t default_uarch_index,
+	uint32_t max_uarch_index,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_j,
+	uint32_t flags);
+
+/**
+ * Process items on a 2D grid with the specified maximum tile size along the
+ * last grid dimension using a microarchitecture-aware task function and passing
+ * along the current thread id.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   uint32_t uarch_index = cpuinfo_initialize() ?
+ *       cpuinfo_get_current_uarch_index() : default_uarch_index;
+ *   if (uarch_index > max_uarch_index) uarch_index = default_uarch_index;
+ *   for (size_t i = 0; i < range_i; i++)
+ *     for (size_t j = 0; j < range_j; j += tile_j)
+ *       function(context, uarch_index, thread_index, i, j, min(range_j - j, tile_j));
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param function    the function to call for each tile.
+ * @param context     the first argument passed to the specified function.
+ * @param default_uarch_index  the microarchitecture index to use when
+ *    pthreadpool is configured without cpuinfo, cpuinfo initialization failed,
+ *    or index returned by cpuinfo_get_current_uarch_index() exceeds the
+ *    max_uarch_index value.
+ * @param max_uarch_index      the maximum microarchitecture index expected by
+ *    the specified function. If the index returned by
+ *    cpuinfo_get_current_uarch_index() exceeds this value, default_uarch_index
+ *    will be used instead. default_uarch_index can exceed max_uarch_index.
+ * @param range_i     the number of items to process along the first dimension
+ *    of the 2D grid.
+ * @param range_j     the number of items to process along the second dimension
+ *    of the 2D grid.
+ * @param tile_j      the maximum number of items along the second dimension of
+ *    the 2D grid to process in one function call.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_1d_with_id_with_thread_t function,
+	void* context,
+	uint32_t default_uarch_index,
+	uint32_t max_uarch_index,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_j,
+	uint32_t flags);
+
+/**
+ * Process items on a 2D grid with the specified maximum tile size along each
+ * grid dimension.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < range_i; i += tile_i)
+ *     for (size_t j = 0; j < range_j; j += tile_j)
+ *       function(context, i, j,
+ *         min(range_i - i, tile_i), min(range_j - j, tile_j));
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -482,6 +1163,169 @@ void pthreadpool_parallelize_2d_tile_2d(
 	size_t tile_j,
 	uint32_t flags);
 
+/**
+ * Start processing tiles on a 2D grid without waiting for the tiles.
+ *
+ * The function processes the same tiles as pthreadpool_parallelize_2d_tile_2d,
+ * but returns as soon as the tiles are handed to the thread pool. See
+ * pthreadpool_parallelize_1d_async for the semantics of the returned job.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param function    the function to call for each tile.
+ * @param context     the first argument passed to the specified function.
+ * @param range_i     the number of items to process along the first dimension
+ *    of the 2D grid.
+ * @param range_j     the number of items to process along the second dimension
+ *    of the 2D grid.
+ * @param tile_i      the maximum number of items along the first dimension of
+ *    the 2D grid to process in one function call.
+ * @param tile_j      the maximum number of items along the second dimension of
+ *    the 2D grid to process in one function call.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS, PTHREADPOOL_FLAG_YIELD_WORKERS or
+ *    PTHREADPOOL_FLAG_MORTON_ORDER)
+ *
+ * @returns  The job to wait for, or NULL if all items were processed before
+ *    the function returned.
+ */
+pthreadpool_job_t pthreadpool_parallelize_2d_tile_2d_async(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_2d_t function,
+	void* context,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
+	uint32_t flags);
+
+/**
+ * Process items on the upper triangle, including the diagonal, of a square 2D
+ * grid.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t j = 0; j < range; j++)
+ *     for (size_t i = 0; i <= j; i++)
+ *       function(context, i, j);
+ *
+ * Items of the triangle are linearized, and split between threads by count of
+ * items, so every thread gets an equal number of items rather than an equal
+ * number of rows of different lengths. For the lower triangle, swap the
+ * arguments of the function.
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param function    the function to call for each item.
+ * @param context     the first argument passed to the specified function.
+ * @param range       the number of items to process along each dimension of
+ *    the 2D grid.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_2d_triangular(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_t function,
+	void* context,
+	size_t range,
+	uint32_t flags);
+
+/**
+ * Process tiles on the upper triangle, including the diagonal, of a square 2D
+ * grid with the specified maximum tile size along both grid dimensions.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t j = 0; j < range; j += tile)
+ *     for (size_t i = 0; i <= j; i += tile)
+ *       function(context, i, j,
+ *         min(range - i, tile), min(range - j, tile));
+ *
+ * Only tiles which intersect the upper triangle are processed, and tiles are
+ * split between threads by count, so every thread gets an equal number of
+ * tiles. Tiles on the diagonal also cover items below the diagonal, which the
+ * function must skip if needed.
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param function    the function to call for each tile.
+ * @param context     the first argument passed to the specified function.
+ * @param range       the number of items to process along each dimension of
+ *    the 2D grid.
+ * @param tile        the maximum number of items along each dimension of the
+ *    2D grid to process in one function call.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_2d_tile_2d_triangular(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_2d_t function,
+	void* context,
+	size_t range,
+	size_t tile,
+	uint32_t flags);
+
+/**
+ * Process items on a 2D grid with the specified maximum tile size along each
+ * grid dimension, where each tile depends on the results of the tile above and
+ * the tile to the left of it.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < range_i; i += tile_i)
+ *     for (size_t j = 0; j < range_j; j += tile_j)
+ *       function(context, i, j,
+ *         min(range_i - i, tile_i), min(range_j - j, tile_j));
+ *
+ * A tile is processed only after the tiles (i - tile_i, j) and (i, j - tile_j)
+ * are processed, and it observes all of their memory writes. Tiles on the same
+ * anti-diagonal are independent and run in parallel, so the whole wavefront
+ * computation completes in a single call instead of one call per
+ * anti-diagonal.
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param function    the function to call for each tile.
+ * @param context     the first argument passed to the specified function.
+ * @param range_i     the number of items to process along the first dimension
+ *    of the 2D grid.
+ * @param range_j     the number of items to process along the second dimension
+ *    of the 2D grid.
+ * @param tile_i      the maximum number of items along the first dimension of
+ *    the 2D grid to process in one function call.
+ * @param tile_j      the maximum number of items along the second dimension of
+ *    the 2D grid to process in one function call.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_2d_tile_2d_wavefront(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_2d_t function,
+	void* context,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
+	uint32_t flags);
+
 /**
  * Process items on a 2D grid with the specified maximum tile size along each
  * grid dimension using a microarchitecture-aware task function.
@@ -1407,6 +2251,380 @@ void pthreadpool_parallelize_6d_tile_2d(
 	size_t tile_n,
 	uint32_t flags);
 
+/**
+ * Process items on an N-dimensional grid with the specified maximum tile size
+ * along each grid dimension.
+ *
+ * The function implements a parallel version of the following snippet for any
+ * number of dimensions:
+ *
+ *   for (size_t i0 = 0; i0 < range[0]; i0 += tile[0])
+ *     ...
+ *       for (size_t iN = 0; iN < range[N - 1]; iN += tile[N - 1])
+ *         function(context, {i0, ..., iN},
+ *           {min(range[0] - i0, tile[0]), ..., min(range[N - 1] - iN, tile[N - 1])});
+ *
+ * The function receives the start of the tile and the size of the tile along
+ * every dimension as arrays of num_dims elements. The arrays are only valid
+ * during the function call.
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param function    the function to call for each tile.
+ * @param context     the first argument passed to the specified function.
+ * @param num_dims    the number of dimensions of the grid, at most
+ *    PTHREADPOOL_MAX_DIMENSIONS.
+ * @param range       the number of items to process along each dimension of
+ *    the grid.
+ * @param tile        the maximum number of items along each dimension of the
+ *    grid to process in one function call. If tile is NULL, the function
+ *    processes one item at a time.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_nd(
+	pthreadpool_t threadpool,
+	pthreadpool_task_nd_t function,
+	void* context,
+	size_t num_dims,
+	const size_t* range,
+	const size_t* tile,
+	uint32_t flags);
+
+/**
+ * Process items on an N-dimensional grid in contiguous runs along the last
+ * grid dimension.
+ *
+ * The function implements a parallel version of the following snippet for any
+ * number of dimensions:
+ *
+ *   for (size_t i0 = 0; i0 < range[0]; i0++)
+ *     ...
+ *       for (size_t iM = 0; iM < range[N - 2]; iM++)
+ *         function(context, {i0, ..., iM}, 0, range[N - 1]);
+ *
+ * where each row along the last dimension is split into runs [start, end)
+ * which are passed to the function in parallel. Each thread passes all items
+ * it claimed within a row at once as a single run. Run boundaries, except the
+ * end of a row, are multiples of alignment. The function receives the index
+ * along the first num_dims - 1 dimensions as an array, which is only valid
+ * during the function call.
+ *
+ * Items in a run can not be stolen by other threads, thus the function must
+ * not wait for completion of other items in the same computation.
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param function    the function to call for each run of items.
+ * @param context     the first argument passed to the specified function.
+ * @param num_dims    the number of dimensions of the grid, at least 1 and at
+ *    most PTHREADPOOL_MAX_DIMENSIONS.
+ * @param range       the number of items to process along each dimension of
+ *    the grid.
+ * @param alignment   the granularity of run boundaries along the last
+ *    dimension of the grid. Zero is treated as 1.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+void pthreadpool_parallelize_nd_range(
+	pthreadpool_t threadpool,
+	pthreadpool_task_nd_range_t function,
+	void* context,
+	size_t num_dims,
+	const size_t* range,
+	size_t alignment,
+	uint32_t flags);
+
+/**
+ * Wait until all items of an asynchronous job are processed, and release the
+ * job.
+ *
+ * The calling thread helps to process the remaining items of the job once the
+ * thread pool is not busy with a synchronous computation. When the function
+ * returns, all changes made by the job are visible to the calling thread.
+ *
+ * @param job  the job returned by an asynchronous parallelization function,
+ *    or NULL. The job must not be used after this call.
+ */
+void pthreadpool_wait(pthreadpool_job_t job);
+
+/**
+ * Query whether all items of an asynchronous job are processed, without
+ * waiting or helping to process the items.
+ *
+ * The job still needs to be released with pthreadpool_wait, which returns
+ * without waiting once this function returned 1.
+ *
+ * @param job  the job returned by an asynchronous parallelization function,
+ *    or NULL.
+ *
+ * @returns  1 if all items of the job are processed or job is NULL, 0
+ *    otherwise.
+ */
+int pthreadpool_test(pthreadpool_job_t job);
+
+/**
+ * Get a file descriptor which becomes readable once all items of an
+ * asynchronous job are processed, for integration with event loops such as
+ * epoll.
+ *
+ * The descriptor is an eventfd created on the first call, and is closed by
+ * pthreadpool_wait: it must not be closed by the caller, and must be removed
+ * from event loops before pthreadpool_wait is called.
+ *
+ * @param job  the job returned by an asynchronous parallelization function.
+ *
+ * @returns  The file descriptor, or -1 if job is NULL or the platform doesn't
+ *    support eventfd.
+ */
+int pthreadpool_get_job_fd(pthreadpool_job_t job);
+
+/**
+ * Create an empty graph of parallelization calls.
+ *
+ * Nodes of the graph are parallelization calls, and edges are dependencies
+ * between them. pthreadpool_graph_run processes the nodes on a thread pool
+ * without returning to the caller between nodes: threads start a node as soon
+ * as all its dependencies complete, so that independent nodes share the
+ * threads of the thread pool. A graph may run any number of times, and must
+ * not be modified or run again while it runs.
+ *
+ * @returns  A pointer to an opaque graph object, or NULL if the graph can't be
+ *    allocated.
+ */
+pthreadpool_graph_t pthreadpool_graph_create(void);
+
+/**
+ * Add a node which processes items on a 1D grid, like
+ * pthreadpool_parallelize_1d, to a graph.
+ *
+ * The order in which items are processed is not specified, and
+ * PTHREADPOOL_FLAG_STATIC_SCHEDULE, PTHREADPOOL_FLAG_ADAPTIVE_PARTITION and
+ * PTHREADPOOL_FLAG_CPU_AFFINITY have no effect on nodes.
+ *
+ * @param graph     the graph to modify.
+ * @param function  the function to call for each item.
+ * @param context   the first argument passed to the specified function.
+ * @param range     the number of items on the 1D grid to process.
+ * @param flags     a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS)
+ *
+ * @returns  The index of the node in the graph, or PTHREADPOOL_GRAPH_NODE_NONE
+ *    if the node can't be allocated.
+ */
+size_t pthreadpool_graph_add_1d(
+	pthreadpool_graph_t graph,
+	pthreadpool_task_1d_t function,
+	void* context,
+	size_t range,
+	uint32_t flags);
+
+/**
+ * Add a node which processes tiles on a 1D grid, like
+ * pthreadpool_parallelize_1d_tile_1d, to a graph.
+ *
+ * @param graph     the graph to modify.
+ * @param function  the function to call for each tile.
+ * @param context   the first argument passed to the specified function.
+ * @param range     the number of items on the 1D grid to process.
+ * @param tile      the maximum number of items on the 1D grid to process in
+ *    one function call.
+ * @param flags     a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS)
+ *
+ * @returns  The index of the node in the graph, or PTHREADPOOL_GRAPH_NODE_NONE
+ *    if the node can't be allocated.
+ */
+size_t pthreadpool_graph_add_1d_tile_1d(
+	pthreadpool_graph_t graph,
+	pthreadpool_task_1d_tile_1d_t function,
+	void* context,
+	size_t range,
+	size_t tile,
+	uint32_t flags);
+
+/**
+ * Add a node which processes items on a 2D grid, like
+ * pthreadpool_parallelize_2d, to a graph.
+ *
+ * @param graph     the graph to modify.
+ * @param function  the function to call for each item.
+ * @param context   the first argument passed to the specified function.
+ * @param range_i   the number of items to process along the first dimension
+ *    of the 2D grid.
+ * @param range_j   the number of items to process along the second dimension
+ *    of the 2D grid.
+ * @param flags     a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS)
+ *
+ * @returns  The index of the node in the graph, or PTHREADPOOL_GRAPH_NODE_NONE
+ *    if the node can't be allocated.
+ */
+size_t pthreadpool_graph_add_2d(
+	pthreadpool_graph_t graph,
+	pthreadpool_task_2d_t function,
+	void* context,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags);
+
+/**
+ * Add a node which processes tiles on a 2D grid, like
+ * pthreadpool_parallelize_2d_tile_2d, to a graph.
+ *
+ * @param graph     the graph to modify.
+ * @param function  the function to call for each tile.
+ * @param context   the first argument passed to the specified function.
+ * @param range_i   the number of items to process along the first dimension
+ *    of the 2D grid.
+ * @param range_j   the number of items to process along the second dimension
+ *    of the 2D grid.
+ * @param tile_i    the maximum number of items along the first dimension of
+ *    the 2D grid to process in one function call.
+ * @param tile_j    the maximum number of items along the second dimension of
+ *    the 2D grid to process in one function call.
+ * @param flags     a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_MORTON_ORDER)
+ *
+ * @returns  The index of the node in the graph, or PTHREADPOOL_GRAPH_NODE_NONE
+ *    if the node can't be allocated.
+ */
+size_t pthreadpool_graph_add_2d_tile_2d(
+	pthreadpool_graph_t graph,
+	pthreadpool_task_2d_tile_2d_t function,
+	void* context,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
+	uint32_t flags);
+
+/**
+ * Make a node of a graph start only after another node of the graph
+ * completes.
+ *
+ * @param graph        the graph to modify.
+ * @param predecessor  the index of the node to complete first.
+ * @param successor    the index of the node which depends on the predecessor.
+ *    Nodes may only depend on nodes added before them, which keeps graphs
+ *    acyclic.
+ *
+ * @returns  1 if the dependency was added, 0 if the successor doesn't follow
+ *    the predecessor in the graph or the dependency can't be allocated.
+ */
+int pthreadpool_graph_add_dependency(
+	pthreadpool_graph_t graph,
+	size_t predecessor,
+	size_t successor);
+
+/**
+ * Process all nodes of a graph.
+ *
+ * When the function returns, all nodes have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * With PTHREADPOOL_FLAG_TRY, if the thread pool is busy, all nodes are
+ * processed serially on the calling thread, and
+ * pthreadpool_last_try_ran_inline reports it. PTHREADPOOL_FLAG_DISABLE_DENORMALS
+ * applies to the items of every node. Other flags, e.g. the scheduling flags,
+ * are ignored: they are specified for every node when the node is added.
+ *
+ * @note If multiple threads call this function or parallelization functions
+ *    with the same thread pool, the calls are serialized.
+ *
+ * @note When called from a task of a computation on the same thread pool, the
+ *    nodes are processed sequentially in the order they were added, even if
+ *    they don't depend on each other. The items of each node are still
+ *    processed in parallel by the threads which become idle.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all nodes are processed serially on the calling thread.
+ * @param graph       the graph to process.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS, PTHREADPOOL_FLAG_YIELD_WORKERS or
+ *    PTHREADPOOL_FLAG_TRY)
+ */
+void pthreadpool_graph_run(
+	pthreadpool_t threadpool,
+	pthreadpool_graph_t graph,
+	uint32_t flags);
+
+/**
+ * Destroy a graph and release its resources.
+ *
+ * @param graph  the graph to destroy, or NULL.
+ */
+void pthreadpool_graph_destroy(pthreadpool_graph_t graph);
+
+/**
+ * Create a task group which runs tasks on a thread pool.
+ *
+ * Tasks of a group may spawn more tasks into the same or other groups, and wait
+ * for them, which fits recursive divide-and-conquer algorithms. Every thread of
+ * the thread pool keeps the tasks it spawned in its own deque, and threads
+ * which run out of work steal tasks from the deques of other threads. A thread
+ * which waits for a group runs tasks until all tasks of the group complete.
+ *
+ * @param threadpool  the thread pool to run the tasks on. If threadpool is
+ *    NULL or has only one thread, tasks run on the calling thread as soon as
+ *    they are spawned.
+ *
+ * @returns  A pointer to an opaque task group object, or NULL if the task group
+ *    can't be allocated.
+ */
+pthreadpool_task_group_t pthreadpool_task_group_create(pthreadpool_t threadpool);
+
+/**
+ * Spawn a task into a task group.
+ *
+ * The task may run on any thread of the thread pool at any time before
+ * pthreadpool_task_group_wait for the group returns. Tasks spawned outside of
+ * the tasks of the thread pool start when the group is waited for, and only
+ * the thread which created the group may spawn them.
+ *
+ * @param group     the task group to spawn the task into.
+ * @param function  the function to call.
+ * @param context   the argument passed to the specified function.
+ */
+void pthreadpool_task_group_spawn(
+	pthreadpool_task_group_t group,
+	pthreadpool_spawn_task_t function,
+	void* context);
+
+/**
+ * Wait until all tasks spawned into a task group complete, running tasks of the
+ * thread pool on the calling thread meanwhile.
+ *
+ * @note When called outside of the tasks of the thread pool, the tasks run as a
+ *    computation on all threads of the thread pool, and concurrent calls with
+ *    the same thread pool are serialized like parallelization calls.
+ *
+ * @param group  the task group to wait for.
+ */
+void pthreadpool_task_group_wait(pthreadpool_task_group_t group);
+
+/**
+ * Destroy a task group and release its resources.
+ *
+ * @warning  All tasks of the group must complete before it is destroyed: wait
+ *    for the group if tasks were spawned since the last wait.
+ *
+ * @param group  the task group to destroy, or NULL.
+ */
+void pthreadpool_task_group_destroy(pthreadpool_task_group_t group);
+
 /**
  * Terminates threads in the thread pool and releases associated resources.
  *
@@ -1508,6 +2726,36 @@ void call_wrapper_1d_tile_1d(void* arg, size_t range_i, size_t tile_i) {
 	(*static_cast<const T*>(arg))(range_i, tile_i);
 }
 
+template<class T, class Index>
+void call_wrapper_1d_indexed_tile_1d(void* functor, const Index* indices, size_t count) {
+	(*static_cast<const T*>(functor))(indices, count);
+}
+
+template<class T>
+void call_wrapper_ragged_2d_tile_1d(void* functor, size_t i, size_t start_k, size_t count_k) {
+	(*static_cast<const T*>(functor))(i, start_k, count_k);
+}
+
+template<class T>
+void call_wrapper_1d_range(void* functor, size_t start, size_t end) {
+	(*static_cast<const T*>(functor))(start, end);
+}
+
+template<class T>
+void call_wrapper_2d_range(void* functor, size_t i, size_t start_j, size_t end_j) {
+	(*static_cast<const T*>(functor))(i, start_j, end_j);
+}
+
+template<class T>
+void call_wrapper_nd(void* functor, const size_t* index, const size_t* tile) {
+	(*static_cast<const T*>(functor))(index, tile);
+}
+
+template<class T>
+void call_wrapper_nd_range(void* functor, const size_t* index, size_t start, size_t end) {
+	(*static_cast<const T*>(functor))(index, start, end);
+}
+
 template<class T>
 void call_wrapper_2d(void* functor, size_t i, size_t j) {
 	(*static_cast<const T*>(functor))(i, j);
@@ -1612,17 +2860,305 @@ void call_wrapper_6d_tile_2d(void* functor,
 	(*static_cast<const T*>(functor))(i, j, k, l, range_m, range_n, tile_m, tile_n);
 }
 
-}  /* namespace */
-}  /* namespace detail */
-}  /* namespace libpthreadpool */
+}  /* namespace */
+}  /* namespace detail */
+}  /* namespace libpthreadpool */
+
+/**
+ * Process items on a 1D grid.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < range; i++)
+ *     functor(i);
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param functor     the functor to call for each item.
+ * @param range       the number of items on the 1D grid to process. The
+ *    specified functor will be called once for each item.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+template<class T>
+inline void pthreadpool_parallelize_1d(
+	pthreadpool_t threadpool,
+	const T& functor,
+	size_t range,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_1d(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_1d<const T>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		range,
+		flags);
+}
+
+/**
+ * Process items with different costs on a 1D grid.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < range; i++)
+ *     functor(i);
+ *
+ * Items are split between threads by their total weight rather than by count.
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool          the thread pool to use for parallelisation. If
+ *    threadpool is NULL, all items are processed serially on the calling
+ *    thread.
+ * @param functor             the functor to call for each item.
+ * @param cumulative_weights  the prefix sums of the weights of items:
+ *    cumulative_weights[i] is the total weight of items 0..i, inclusive. The
+ *    array must contain range non-decreasing elements.
+ * @param range               the number of items on the 1D grid to process.
+ *    The specified functor will be called once for each item.
+ * @param flags               a bitwise combination of zero or more optional
+ *    flags (PTHREADPOOL_FLAG_DISABLE_DENORMALS or
+ *    PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+template<class T>
+inline void pthreadpool_parallelize_1d_weighted(
+	pthreadpool_t threadpool,
+	const T& functor,
+	const size_t* cumulative_weights,
+	size_t range,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_1d_weighted(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_1d<const T>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		cumulative_weights,
+		range,
+		flags);
+}
+
+/**
+ * Process items on a 1D grid with specified maximum tile size.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < range; i += tile)
+ *     functor(i, min(range - i, tile));
+ *
+ * When the call returns, all items have been processed and the thread pool is
+ * ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool,
+ *    the calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param functor     the functor to call for each tile.
+ * @param range       the number of items on the 1D grid to process.
+ * @param tile        the maximum number of items on the 1D grid to process in
+ *    one functor call.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+template<class T>
+inline void pthreadpool_parallelize_1d_tile_1d(
+	pthreadpool_t threadpool,
+	const T& functor,
+	size_t range,
+	size_t tile,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_1d_tile_1d(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_1d_tile_1d<const T>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		range,
+		tile,
+		flags);
+}
+
+/**
+ * Process items on a 1D grid in contiguous runs of the longest length
+ * available to each thread.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   functor(0, range);
+ *
+ * where the range is split into runs [start, end) which are passed to the
+ * functor in parallel. Run boundaries, except the end of the range, are
+ * multiples of the alignment.
+ *
+ * When the call returns, all items have been processed and the thread pool is
+ * ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool,
+ *    the calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param functor     the functor to call for each run of items.
+ * @param range       the number of items on the 1D grid to process.
+ * @param alignment   the granularity of run boundaries. Zero is treated as 1.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+template<class T>
+inline void pthreadpool_parallelize_1d_range(
+	pthreadpool_t threadpool,
+	const T& functor,
+	size_t range,
+	size_t alignment = 1,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_1d_range(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_1d_range<const T>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		range,
+		alignment,
+		flags);
+}
+
+/**
+ * Process items from a list of indices.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t p = 0; p < count; p++)
+ *     functor(indices[p]);
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param functor     the functor to call for each index in the list.
+ * @param indices     the list of indices of items to process.
+ * @param count       the number of indices in the list.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+template<class T>
+inline void pthreadpool_parallelize_1d_indexed(
+	pthreadpool_t threadpool,
+	const T& functor,
+	const size_t* indices,
+	size_t count,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_1d_indexed(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_1d<const T>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		indices,
+		count,
+		flags);
+}
+
+template<class T>
+inline void pthreadpool_parallelize_1d_indexed(
+	pthreadpool_t threadpool,
+	const T& functor,
+	const uint32_t* indices,
+	size_t count,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_1d_indexed_u32(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_1d<const T>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		indices,
+		count,
+		flags);
+}
+
+/**
+ * Process slices of a list of indices with specified maximum slice size.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t p = 0; p < count; p += tile)
+ *     functor(indices + p, min(count - p, tile));
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param functor     the functor to call for each slice of the list.
+ * @param indices     the list of indices of items to process.
+ * @param count       the number of indices in the list.
+ * @param tile        the maximum number of indices to process in one functor
+ *    call.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+template<class T>
+inline void pthreadpool_parallelize_1d_indexed_tile_1d(
+	pthreadpool_t threadpool,
+	const T& functor,
+	const size_t* indices,
+	size_t count,
+	size_t tile,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_1d_indexed_tile_1d(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_1d_indexed_tile_1d<const T, size_t>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		indices,
+		count,
+		tile,
+		flags);
+}
+
+template<class T>
+inline void pthreadpool_parallelize_1d_indexed_tile_1d(
+	pthreadpool_t threadpool,
+	const T& functor,
+	const uint32_t* indices,
+	size_t count,
+	size_t tile,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_1d_indexed_u32_tile_1d(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_1d_indexed_tile_1d<const T, uint32_t>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		indices,
+		count,
+		tile,
+		flags);
+}
 
 /**
- * Process items on a 1D grid.
+ * Process items on a ragged 2D grid described by row offsets.
  *
  * The function implements a parallel version of the following snippet:
  *
- *   for (size_t i = 0; i < range; i++)
- *     functor(i);
+ *   for (size_t i = 0; i < rows; i++)
+ *     for (size_t k = 0; k < row_offsets[i + 1] - row_offsets[i]; k++)
+ *       functor(i, k);
+ *
+ * Items of all rows are linearized, and split between threads by count of
+ * items rather than by count of rows.
  *
  * When the function returns, all items have been processed and the thread pool
  * is ready for a new task.
@@ -1630,65 +3166,74 @@ void call_wrapper_6d_tile_2d(void* functor,
  * @note If multiple threads call this function with the same thread pool, the
  *    calls are serialized.
  *
- * @param threadpool  the thread pool to use for parallelisation. If threadpool
- *    is NULL, all items are processed serially on the calling thread.
- * @param functor     the functor to call for each item.
- * @param range       the number of items on the 1D grid to process. The
- *    specified functor will be called once for each item.
- * @param flags       a bitwise combination of zero or more optional flags
+ * @param threadpool   the thread pool to use for parallelisation. If
+ *    threadpool is NULL, all items are processed serially on the calling
+ *    thread.
+ * @param functor      the functor to call for each item.
+ * @param row_offsets  the array of rows + 1 non-decreasing offsets of rows:
+ *    row i contains row_offsets[i + 1] - row_offsets[i] items.
+ * @param rows         the number of rows on the ragged 2D grid to process.
+ * @param flags        a bitwise combination of zero or more optional flags
  *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
  */
 template<class T>
-inline void pthreadpool_parallelize_1d(
+inline void pthreadpool_parallelize_ragged_2d(
 	pthreadpool_t threadpool,
 	const T& functor,
-	size_t range,
+	const size_t* row_offsets,
+	size_t rows,
 	uint32_t flags = 0)
 {
-	pthreadpool_parallelize_1d(
+	pthreadpool_parallelize_ragged_2d(
 		threadpool,
-		&libpthreadpool::detail::call_wrapper_1d<const T>,
+		&libpthreadpool::detail::call_wrapper_2d<const T>,
 		const_cast<void*>(static_cast<const void*>(&functor)),
-		range,
+		row_offsets,
+		rows,
 		flags);
 }
 
 /**
- * Process items on a 1D grid with specified maximum tile size.
- *
- * The function implements a parallel version of the following snippet:
+ * Process segments of rows on a ragged 2D grid described by row offsets.
  *
- *   for (size_t i = 0; i < range; i += tile)
- *     functor(i, min(range - i, tile));
+ * Items of all rows are linearized, and split into tiles of up to tile items.
+ * For every row which overlaps a tile, the functor is called as
+ * functor(i, start, count), where start is the index of the first overlapping
+ * item within row i, and count is the number of overlapping items.
  *
- * When the call returns, all items have been processed and the thread pool is
- * ready for a new task.
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
  *
- * @note If multiple threads call this function with the same thread pool,
- *    the calls are serialized.
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
  *
- * @param threadpool  the thread pool to use for parallelisation. If threadpool
- *    is NULL, all items are processed serially on the calling thread.
- * @param functor     the functor to call for each tile.
- * @param range       the number of items on the 1D grid to process.
- * @param tile        the maximum number of items on the 1D grid to process in
- *    one functor call.
- * @param flags       a bitwise combination of zero or more optional flags
+ * @param threadpool   the thread pool to use for parallelisation. If
+ *    threadpool is NULL, all items are processed serially on the calling
+ *    thread.
+ * @param functor      the functor to call for each segment of a row.
+ * @param row_offsets  the array of rows + 1 non-decreasing offsets of rows:
+ *    row i contains row_offsets[i + 1] - row_offsets[i] items.
+ * @param rows         the number of rows on the ragged 2D grid to process.
+ * @param tile         the maximum number of items of the linearized grid to
+ *    process in one tile.
+ * @param flags        a bitwise combination of zero or more optional flags
  *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
  */
 template<class T>
-inline void pthreadpool_parallelize_1d_tile_1d(
+inline void pthreadpool_parallelize_ragged_2d_tile_1d(
 	pthreadpool_t threadpool,
 	const T& functor,
-	size_t range,
+	const size_t* row_offsets,
+	size_t rows,
 	size_t tile,
 	uint32_t flags = 0)
 {
-	pthreadpool_parallelize_1d_tile_1d(
+	pthreadpool_parallelize_ragged_2d_tile_1d(
 		threadpool,
-		&libpthreadpool::detail::call_wrapper_1d_tile_1d<const T>,
+		&libpthreadpool::detail::call_wrapper_ragged_2d_tile_1d<const T>,
 		const_cast<void*>(static_cast<const void*>(&functor)),
-		range,
+		row_offsets,
+		rows,
 		tile,
 		flags);
 }
@@ -1782,6 +3327,56 @@ inline void pthreadpool_parallelize_2d_tile_1d(
 		flags);
 }
 
+/**
+ * Process items on a 2D grid in contiguous runs along the last grid dimension.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < range_i; i++)
+ *     functor(i, 0, range_j);
+ *
+ * where each row is split into runs [start_j, end_j) which are passed to the
+ * functor in parallel. Run boundaries, except the end of a row, are multiples
+ * of alignment_j.
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool   the thread pool to use for parallelisation. If
+ *    threadpool is NULL, all items are processed serially on the calling
+ *    thread.
+ * @param functor      the functor to call for each run of items.
+ * @param range_i      the number of items to process along the first
+ *    dimension of the 2D grid.
+ * @param range_j      the number of items to process along the second
+ *    dimension of the 2D grid.
+ * @param alignment_j  the granularity of run boundaries along the second
+ *    dimension of the 2D grid. Zero is treated as 1.
+ * @param flags        a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+template<class T>
+inline void pthreadpool_parallelize_2d_range(
+	pthreadpool_t threadpool,
+	const T& functor,
+	size_t range_i,
+	size_t range_j,
+	size_t alignment_j = 1,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_2d_range(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_2d_range<const T>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		range_i,
+		range_j,
+		alignment_j,
+		flags);
+}
+
 /**
  * Process items on a 2D grid with the specified maximum tile size along each
  * grid dimension.
@@ -1834,6 +3429,143 @@ inline void pthreadpool_parallelize_2d_tile_2d(
 		flags);
 }
 
+/**
+ * Process items on the upper triangle, including the diagonal, of a square 2D
+ * grid.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t j = 0; j < range; j++)
+ *     for (size_t i = 0; i <= j; i++)
+ *       functor(i, j);
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param functor     the functor to call for each item.
+ * @param range       the number of items to process along each dimension of
+ *    the 2D grid.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+template<class T>
+inline void pthreadpool_parallelize_2d_triangular(
+	pthreadpool_t threadpool,
+	const T& functor,
+	size_t range,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_2d_triangular(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_2d<const T>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		range,
+		flags);
+}
+
+/**
+ * Process tiles on the upper triangle, including the diagonal, of a square 2D
+ * grid with the specified maximum tile size along both grid dimensions.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t j = 0; j < range; j += tile)
+ *     for (size_t i = 0; i <= j; i += tile)
+ *       functor(i, j, min(range - i, tile), min(range - j, tile));
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param functor     the functor to call for each tile.
+ * @param range       the number of items to process along each dimension of
+ *    the 2D grid.
+ * @param tile        the maximum number of items along each dimension of the
+ *    2D grid to process in one functor call.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+template<class T>
+inline void pthreadpool_parallelize_2d_tile_2d_triangular(
+	pthreadpool_t threadpool,
+	const T& functor,
+	size_t range,
+	size_t tile,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_2d_tile_2d_triangular(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_2d_tile_2d<const T>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		range,
+		tile,
+		flags);
+}
+
+/**
+ * Process items on a 2D grid with the specified maximum tile size along each
+ * grid dimension, where each tile depends on the results of the tile above and
+ * the tile to the left of it.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < range_i; i += tile_i)
+ *     for (size_t j = 0; j < range_j; j += tile_j)
+ *       functor(i, j, min(range_i - i, tile_i), min(range_j - j, tile_j));
+ *
+ * A tile is processed only after the tiles (i - tile_i, j) and (i, j - tile_j)
+ * are processed, and it observes all of their memory writes.
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param functor     the functor to call for each tile.
+ * @param range_i     the number of items to process along the first dimension
+ *    of the 2D grid.
+ * @param range_j     the number of items to process along the second dimension
+ *    of the 2D grid.
+ * @param tile_i      the maximum number of items along the first dimension of
+ *    the 2D grid to process in one functor call.
+ * @param tile_j      the maximum number of items along the second dimension of
+ *    the 2D grid to process in one functor call.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+template<class T>
+inline void pthreadpool_parallelize_2d_tile_2d_wavefront(
+	pthreadpool_t threadpool,
+	const T& functor,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_2d_tile_2d_wavefront(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_2d_tile_2d<const T>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		range_i,
+		range_j,
+		tile_i,
+		tile_j,
+		flags);
+}
+
 /**
  * Process items on a 3D grid.
  *
@@ -2550,6 +4282,98 @@ inline void pthreadpool_parallelize_6d_tile_2d(
 		flags);
 }
 
+/**
+ * Process items on an N-dimensional grid with the specified maximum tile size
+ * along each grid dimension.
+ *
+ * The functor receives the start of the tile and the size of the tile along
+ * every dimension as arrays of num_dims elements. The arrays are only valid
+ * during the functor call.
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param functor     the functor to call for each tile.
+ * @param num_dims    the number of dimensions of the grid, at most
+ *    PTHREADPOOL_MAX_DIMENSIONS.
+ * @param range       the number of items to process along each dimension of
+ *    the grid.
+ * @param tile        the maximum number of items along each dimension of the
+ *    grid to process in one functor call. If tile is NULL, the functor
+ *    processes one item at a time.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+template<class T>
+inline void pthreadpool_parallelize_nd(
+	pthreadpool_t threadpool,
+	const T& functor,
+	size_t num_dims,
+	const size_t* range,
+	const size_t* tile = nullptr,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_nd(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_nd<const T>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		num_dims,
+		range,
+		tile,
+		flags);
+}
+
+/**
+ * Process items on an N-dimensional grid in contiguous runs along the last
+ * grid dimension.
+ *
+ * The functor receives the index along the first num_dims - 1 dimensions as
+ * an array, which is only valid during the functor call, and a run
+ * [start, end) along the last dimension. Run boundaries, except the end of a
+ * row, are multiples of alignment.
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls are serialized.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param functor     the functor to call for each run of items.
+ * @param num_dims    the number of dimensions of the grid, at least 1 and at
+ *    most PTHREADPOOL_MAX_DIMENSIONS.
+ * @param range       the number of items to process along each dimension of
+ *    the grid.
+ * @param alignment   the granularity of run boundaries along the last
+ *    dimension of the grid. Zero is treated as 1.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+template<class T>
+inline void pthreadpool_parallelize_nd_range(
+	pthreadpool_t threadpool,
+	const T& functor,
+	size_t num_dims,
+	const size_t* range,
+	size_t alignment = 1,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_nd_range(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_nd_range<const T>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		num_dims,
+		range,
+		alignment,
+		flags);
+}
+
 #endif  /* __cplusplus */
 
 #endif /* PTHREADPOOL_H_ */
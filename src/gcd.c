@@ -35,7 +35,10 @@ static void thread_main(void* arg, size_t thread_index) {
 		disable_fpu_denormals();
 	}
 
+	/* Dispatch threads are shared with other work, and serve the thread pool only during this call */
+	struct thread_info* previous_thread = pthreadpool_set_current_thread(thread);
 	thread_function(threadpool, thread);
+	pthreadpool_set_current_thread(previous_thread);
 
 	if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 		set_fpu_state(saved_fpu_state);
@@ -64,7 +67,9 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 	threadpool->threads_count = fxdiv_init_size_t(threads_count);
 	for (size_t tid = 0; tid < threads_count; tid++) {
 		threadpool->threads[tid].thread_number = tid;
+		threadpool->threads[tid].threadpool = threadpool;
 	}
+	pthreadpool_detect_topology(threadpool, false);
 
 	/* Thread pool with a single thread computes everything on the caller thread. */
 	if (threads_count > 1) {
@@ -73,6 +78,11 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 	return threadpool;
 }
 
+struct pthreadpool* pthreadpool_create_pinned(size_t threads_count) {
+	/* Grand Central Dispatch manages its own threads, which can't be pinned */
+	return pthreadpool_create(threads_count);
+}
+
 PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	struct pthreadpool* threadpool,
 	thread_function_t thread_function,
@@ -88,8 +98,26 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	assert(task != NULL);
 	assert(linear_range > 1);
 
-	/* Protect the global threadpool structures */
-	dispatch_semaphore_wait(threadpool->execution_semaphore, DISPATCH_TIME_FOREVER);
+	/* A task of the current computation already holds the execution semaphore */
+	struct thread_info* current_thread = pthreadpool_get_current_thread();
+	if (current_thread != NULL && current_thread->threadpool == threadpool) {
+		pthreadpool_parallelize_nested(
+			threadpool, current_thread, thread_function, params, params_size, task, context, linear_range, flags);
+		return;
+	}
+
+	if (flags & PTHREADPOOL_FLAG_TRY) {
+		const bool busy = dispatch_semaphore_wait(threadpool->execution_semaphore, DISPATCH_TIME_NOW) != 0;
+		pthreadpool_set_last_try_inline(busy);
+		if (busy) {
+			/* Thread number 0 matches the computations without a thread pool */
+			pthreadpool_parallelize_inline(0, thread_function, params, params_size, task, context, linear_range, flags);
+			return;
+		}
+	} else {
+		/* Protect the global threadpool structures */
+		dispatch_semaphore_wait(threadpool->execution_semaphore, DISPATCH_TIME_FOREVER);
+	}
 
 	/* Setup global arguments */
 	pthreadpool_store_relaxed_void_p(&threadpool->thread_function, (void*) thread_function);
@@ -105,19 +133,7 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	}
 
 	/* Spread the work between threads */
-	const struct fxdiv_result_size_t range_params = fxdiv_divide_size_t(linear_range, threads_count);
-	size_t range_start = 0;
-	for (size_t tid = 0; tid < threads_count.value; tid++) {
-		struct thread_info* thread = &threadpool->threads[tid];
-		const size_t range_length = range_params.quotient + (size_t) (tid < range_params.remainder);
-		const size_t range_end = range_start + range_length;
-		pthreadpool_store_relaxed_size_t(&thread->range_start, range_start);
-		pthreadpool_store_relaxed_size_t(&thread->range_end, range_end);
-		pthreadpool_store_relaxed_size_t(&thread->range_length, range_length);
-
-		/* The next subrange starts where the previous ended */
-		range_start = range_end;
-	}
+	pthreadpool_assign_ranges(threadpool, linear_range, params_size, flags);
 
 	dispatch_apply_f(threads_count.value, DISPATCH_APPLY_AUTO, threadpool, thread_main);
 
@@ -125,6 +141,25 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	dispatch_semaphore_signal(threadpool->execution_semaphore);
 }
 
+PTHREADPOOL_INTERNAL struct pthreadpool_job* pthreadpool_parallelize_async(
+	struct pthreadpool* threadpool,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	uint32_t flags)
+{
+	/* Grand Central Dispatch has no idle threads of its own to hand the items to: process them before returning */
+	pthreadpool_parallelize(threadpool, thread_function, params, params_size, task, context, linear_range, flags);
+	return NULL;
+}
+
+void pthreadpool_wait(pthreadpool_job_t job) {
+	assert(job == NULL);
+}
+
 void pthreadpool_destroy(struct pthreadpool* threadpool) {
 	if (threadpool != NULL) {
 		if (threadpool->execution_semaphore != NULL) {
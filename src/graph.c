@@ -0,0 +1,303 @@
+/* Standard C headers */
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Library header */
+#include <pthreadpool.h>
+
+/* Internal library headers */
+#include "threadpool-atomics.h"
+#include "threadpool-common.h"
+#include "threadpool-object.h"
+#include "threadpool-utils.h"
+
+
+struct pthreadpool_graph_node {
+	/**
+	 * Parallelization of the items of the node, as passed to pthreadpool_parallelize.
+	 */
+	thread_function_t thread_function;
+	union pthreadpool_params params;
+	size_t params_size;
+	void* task;
+	void* context;
+	size_t linear_range;
+	uint32_t flags;
+	/**
+	 * Indices of the nodes which depend on this node. Successors always follow their predecessors in the graph.
+	 */
+	size_t* successors;
+	size_t successors_count;
+	size_t successors_capacity;
+	/**
+	 * The number of dependencies of this node.
+	 */
+	size_t predecessors_count;
+	/**
+	 * The number of dependencies of this node which didn't complete yet in the current run.
+	 */
+	pthreadpool_atomic_size_t pending_predecessors;
+	/**
+	 * 1 if a thread started this node in the current run, 0 otherwise.
+	 */
+	pthreadpool_atomic_size_t claimed;
+	/**
+	 * The graph which the node belongs to. Set at the start of each run, because adding nodes moves them.
+	 */
+	struct pthreadpool_graph* graph;
+};
+
+struct pthreadpool_graph {
+	struct pthreadpool_graph_node* nodes;
+	size_t nodes_count;
+	size_t nodes_capacity;
+	/**
+	 * The number of nodes which didn't complete yet in the current run.
+	 */
+	pthreadpool_atomic_size_t remaining_nodes;
+	/**
+	 * Hint for the search of ready nodes: all nodes before this index are claimed.
+	 */
+	pthreadpool_atomic_size_t first_unclaimed_node;
+	/**
+	 * Flags passed to pthreadpool_graph_run which apply to the computations of all nodes in the current run.
+	 */
+	uint32_t node_flags;
+};
+
+pthreadpool_graph_t pthreadpool_graph_create(void) {
+	return calloc(1, sizeof(struct pthreadpool_graph));
+}
+
+PTHREADPOOL_INTERNAL size_t pthreadpool_graph_add_node(
+	struct pthreadpool_graph* graph,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	uint32_t flags)
+{
+	assert(graph != NULL);
+	assert(thread_function != NULL);
+	assert(task != NULL);
+	assert(params_size <= sizeof(union pthreadpool_params));
+
+	if (graph->nodes_count == graph->nodes_capacity) {
+		const size_t nodes_capacity = graph->nodes_capacity != 0 ? graph->nodes_capacity * 2 : 16;
+		struct pthreadpool_graph_node* nodes = realloc(graph->nodes, nodes_capacity * sizeof(struct pthreadpool_graph_node));
+		if (nodes == NULL) {
+			return PTHREADPOOL_GRAPH_NODE_NONE;
+		}
+		graph->nodes = nodes;
+		graph->nodes_capacity = nodes_capacity;
+	}
+
+	struct pthreadpool_graph_node* node = &graph->nodes[graph->nodes_count];
+	memset(node, 0, sizeof(struct pthreadpool_graph_node));
+	node->thread_function = thread_function;
+	if (params_size != 0) {
+		memcpy(&node->params, params, params_size);
+	}
+	node->params_size = params_size;
+	node->task = task;
+	node->context = context;
+	node->linear_range = linear_range;
+	node->flags = flags;
+	return graph->nodes_count++;
+}
+
+int pthreadpool_graph_add_dependency(
+	pthreadpool_graph_t graph,
+	size_t predecessor,
+	size_t successor)
+{
+	/* Requiring predecessors to be added first keeps the graph acyclic, and the order of nodes topological */
+	if (graph == NULL || predecessor >= successor || successor >= graph->nodes_count) {
+		return 0;
+	}
+
+	struct pthreadpool_graph_node* node = &graph->nodes[predecessor];
+	if (node->successors_count == node->successors_capacity) {
+		const size_t successors_capacity = node->successors_capacity != 0 ? node->successors_capacity * 2 : 4;
+		size_t* successors = realloc(node->successors, successors_capacity * sizeof(size_t));
+		if (successors == NULL) {
+			return 0;
+		}
+		node->successors = successors;
+		node->successors_capacity = successors_capacity;
+	}
+	node->successors[node->successors_count++] = successor;
+	graph->nodes[successor].predecessors_count += 1;
+	return 1;
+}
+
+/*
+ * Called once all items of the node are processed: under the lock by the last thread which processed the items, or by
+ * the thread which processed the node alone.
+ */
+static void complete_node(void* context) {
+	struct pthreadpool_graph_node* node = (struct pthreadpool_graph_node*) context;
+	struct pthreadpool_graph* graph = node->graph;
+	for (size_t i = 0; i < node->successors_count; i++) {
+		pthreadpool_decrement_fetch_release_size_t(&graph->nodes[node->successors[i]].pending_predecessors);
+	}
+	pthreadpool_decrement_fetch_release_size_t(&graph->remaining_nodes);
+}
+
+static struct pthreadpool_graph_node* claim_ready_node(struct pthreadpool_graph* graph) {
+	const size_t nodes_count = graph->nodes_count;
+	const size_t first_node = pthreadpool_load_relaxed_size_t(&graph->first_unclaimed_node);
+	for (size_t i = first_node; i < nodes_count; i++) {
+		struct pthreadpool_graph_node* node = &graph->nodes[i];
+		if (pthreadpool_load_relaxed_size_t(&node->claimed) != 0 ||
+			pthreadpool_load_acquire_size_t(&node->pending_predecessors) != 0)
+		{
+			continue;
+		}
+
+		size_t unclaimed = 0;
+		if (pthreadpool_compare_exchange_relaxed_size_t(&node->claimed, &unclaimed, 1)) {
+			if (i == first_node) {
+				size_t expected_node = first_node;
+				pthreadpool_compare_exchange_relaxed_size_t(&graph->first_unclaimed_node, &expected_node, i + 1);
+			}
+			return node;
+		}
+	}
+	return NULL;
+}
+
+static void run_node_inline(
+	size_t thread_number,
+	const struct pthreadpool_graph* graph,
+	const struct pthreadpool_graph_node* node)
+{
+	if (node->linear_range != 0) {
+		pthreadpool_parallelize_inline(
+			thread_number, node->thread_function, &node->params, node->params_size, node->task, node->context,
+			node->linear_range, node->flags | graph->node_flags);
+	}
+}
+
+/* Processes all nodes on the calling thread: nodes are in topological order */
+static void run_graph_inline(
+	size_t thread_number,
+	const struct pthreadpool_graph* graph)
+{
+	for (size_t i = 0; i < graph->nodes_count; i++) {
+		run_node_inline(thread_number, graph, &graph->nodes[i]);
+	}
+}
+
+static void start_node(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread,
+	struct pthreadpool_graph_node* node)
+{
+	struct pthreadpool_graph* graph = node->graph;
+	if (node->linear_range > 1) {
+		/* Threads of the graph help to process the items, and the last one completes the node */
+		struct pthreadpool* computation = pthreadpool_start_concurrent_computation(
+			threadpool, node->thread_function, &node->params, node->params_size, node->task, node->context,
+			node->linear_range, node->flags | graph->node_flags, true, &complete_node, node);
+		if (computation != NULL) {
+			return;
+		}
+	}
+
+	run_node_inline(thread->thread_number, graph, node);
+	complete_node(node);
+}
+
+/*
+ * Runs on every thread of the thread pool. Threads start nodes as soon as their dependencies complete, and help to
+ * process the items of started nodes, until all nodes complete.
+ */
+static void thread_run_graph(struct pthreadpool* threadpool, struct thread_info* thread) {
+	struct pthreadpool_graph* graph = (struct pthreadpool_graph*) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	if (threadpool->threads_count.value == 1) {
+		/* PTHREADPOOL_FLAG_TRY found the thread pool busy, and the calling thread processes the graph alone */
+		run_graph_inline(thread->thread_number, graph);
+		return;
+	}
+
+	while (pthreadpool_load_acquire_size_t(&graph->remaining_nodes) != 0) {
+		struct pthreadpool_graph_node* node = claim_ready_node(graph);
+		if (node != NULL) {
+			start_node(threadpool, thread, node);
+		} else if (!pthreadpool_help_nested_computation(threadpool) && !pthreadpool_help_task_groups(threadpool)) {
+			pthreadpool_yield();
+		}
+	}
+}
+
+void pthreadpool_graph_run(
+	pthreadpool_t threadpool,
+	pthreadpool_graph_t graph,
+	uint32_t flags)
+{
+	assert(graph != NULL);
+
+	pthreadpool_reset_last_try_inline(flags);
+
+	const size_t nodes_count = graph->nodes_count;
+	if (nodes_count == 0) {
+		return;
+	}
+
+	/* Scheduling flags don't apply to the run: they are passed for every node when the node is added */
+	graph->node_flags = flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS;
+
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1) {
+		/* No thread pool used: execute nodes sequentially on the calling thread */
+		run_graph_inline(0, graph);
+		return;
+	}
+
+	struct thread_info* current_thread = pthreadpool_get_current_thread();
+	if (current_thread != NULL && current_thread->threadpool == threadpool) {
+		/* A task of the current computation can't run on all threads: process nodes one by one as nested computations */
+		for (size_t i = 0; i < nodes_count; i++) {
+			const struct pthreadpool_graph_node* node = &graph->nodes[i];
+			if (node->linear_range > 1) {
+				pthreadpool_parallelize(
+					threadpool, node->thread_function, &node->params, node->params_size, node->task, node->context,
+					node->linear_range, node->flags | graph->node_flags);
+			} else {
+				run_node_inline(current_thread->thread_number, graph, node);
+			}
+		}
+		return;
+	}
+
+	for (size_t i = 0; i < nodes_count; i++) {
+		struct pthreadpool_graph_node* node = &graph->nodes[i];
+		pthreadpool_store_relaxed_size_t(&node->pending_predecessors, node->predecessors_count);
+		pthreadpool_store_relaxed_size_t(&node->claimed, 0);
+		node->graph = graph;
+	}
+	pthreadpool_store_relaxed_size_t(&graph->remaining_nodes, nodes_count);
+	pthreadpool_store_relaxed_size_t(&graph->first_unclaimed_node, 0);
+
+	/* Every thread runs the graph: the range only makes the computation span all threads */
+	pthreadpool_parallelize(
+		threadpool, &thread_run_graph, NULL, 0, (void*) graph, NULL, threads_count,
+		flags & (PTHREADPOOL_FLAG_DISABLE_DENORMALS | PTHREADPOOL_FLAG_YIELD_WORKERS | PTHREADPOOL_FLAG_TRY));
+}
+
+void pthreadpool_graph_destroy(pthreadpool_graph_t graph) {
+	if (graph != NULL) {
+		for (size_t i = 0; i < graph->nodes_count; i++) {
+			free(graph->nodes[i].successors);
+		}
+		free(graph->nodes);
+		free(graph);
+	}
+}
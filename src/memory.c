@@ -17,50 +17,87 @@
 /* Internal library headers */
 #include "threadpool-common.h"
 #include "threadpool-object.h"
+#include "threadpool-utils.h"
 
 
-PTHREADPOOL_INTERNAL struct pthreadpool* pthreadpool_allocate(
-	size_t threads_count)
-{
-	assert(threads_count >= 1);
+static size_t get_threadpool_size(size_t threads_count) {
+	const size_t bitmap_words = divide_round_up(threads_count, PTHREADPOOL_BITMAP_WORD_BITS);
+	return sizeof(struct pthreadpool) + threads_count * sizeof(struct thread_info) +
+		bitmap_words * sizeof(pthreadpool_atomic_size_t);
+}
 
-	const size_t threadpool_size = sizeof(struct pthreadpool) + threads_count * sizeof(struct thread_info);
-	struct pthreadpool* threadpool = NULL;
+static void* allocate_aligned(size_t size) {
+	void* memory = NULL;
 	#if defined(__ANDROID__)
 		/*
 		 * Android didn't get posix_memalign until API level 17 (Android 4.2).
 		 * Use (otherwise obsolete) memalign function on Android platform.
 		 */
-		threadpool = memalign(PTHREADPOOL_CACHELINE_SIZE, threadpool_size);
-		if (threadpool == NULL) {
-			return NULL;
-		}
+		memory = memalign(PTHREADPOOL_CACHELINE_SIZE, size);
 	#elif defined(_WIN32)
-		threadpool = _aligned_malloc(threadpool_size, PTHREADPOOL_CACHELINE_SIZE);
-		if (threadpool == NULL) {
-			return NULL;
-		}
+		memory = _aligned_malloc(size, PTHREADPOOL_CACHELINE_SIZE);
 	#else
-		if (posix_memalign((void**) &threadpool, PTHREADPOOL_CACHELINE_SIZE, threadpool_size) != 0) {
+		if (posix_memalign(&memory, PTHREADPOOL_CACHELINE_SIZE, size) != 0) {
 			return NULL;
 		}
 	#endif
+	return memory;
+}
+
+static void free_aligned(void* memory) {
+	#ifdef _WIN32
+		_aligned_free(memory);
+	#else
+		free(memory);
+	#endif
+}
+
+PTHREADPOOL_INTERNAL struct pthreadpool* pthreadpool_allocate(
+	size_t threads_count)
+{
+	assert(threads_count >= 1);
+
+	const size_t threadpool_size = get_threadpool_size(threads_count);
+	struct pthreadpool* threadpool = allocate_aligned(threadpool_size);
+	if (threadpool == NULL) {
+		return NULL;
+	}
 	memset(threadpool, 0, threadpool_size);
+	threadpool->busy_threads = (pthreadpool_atomic_size_t*) &threadpool->threads[threads_count];
 	return threadpool;
 }
 
+PTHREADPOOL_INTERNAL struct pthreadpool_task_deque* pthreadpool_allocate_task_deque(void) {
+	struct pthreadpool_task_deque* deque = allocate_aligned(sizeof(struct pthreadpool_task_deque));
+	if (deque != NULL) {
+		memset(deque, 0, sizeof(struct pthreadpool_task_deque));
+	}
+	return deque;
+}
+
 
 PTHREADPOOL_INTERNAL void pthreadpool_deallocate(
 	struct pthreadpool* threadpool)
 {
 	assert(threadpool != NULL);
 
-	const size_t threadpool_size = sizeof(struct pthreadpool) + threadpool->threads_count.value * sizeof(struct thread_info);
-	memset(threadpool, 0, threadpool_size);
+	free(threadpool->history);
+	free(threadpool->cpu_caches);
 
-	#ifdef _WIN32
-		_aligned_free(threadpool);
-	#else
-		free(threadpool);
-	#endif
+	struct pthreadpool* nested_threadpool = threadpool->spare_nested_threadpools;
+	while (nested_threadpool != NULL) {
+		struct pthreadpool* next_nested_threadpool =
+			(struct pthreadpool*) pthreadpool_load_relaxed_void_p(&nested_threadpool->next_nested);
+		pthreadpool_deallocate(nested_threadpool);
+		nested_threadpool = next_nested_threadpool;
+	}
+
+	const size_t threads_count = threadpool->threads_count.value;
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		free_aligned(pthreadpool_load_relaxed_void_p(&threadpool->threads[tid].task_deque));
+	}
+
+	const size_t threadpool_size = get_threadpool_size(threads_count);
+	memset(threadpool, 0, threadpool_size);
+	free_aligned(threadpool);
 }
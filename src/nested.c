@@ -0,0 +1,536 @@
+/* Standard C headers */
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Linux headers */
+#if defined(__linux__)
+	#include <sys/eventfd.h>
+	#include <unistd.h>
+#endif
+
+/* Dependencies */
+#include <fxdiv.h>
+
+/* Library header */
+#include <pthreadpool.h>
+
+/* Internal library headers */
+#include "threadpool-atomics.h"
+#include "threadpool-common.h"
+#include "threadpool-object.h"
+#include "threadpool-utils.h"
+
+
+/* Thread information structure of the calling system thread in the current computation */
+static PTHREADPOOL_THREAD_LOCAL struct thread_info* current_thread = NULL;
+
+/* Whether the last call of the calling thread with PTHREADPOOL_FLAG_TRY found the thread pool busy */
+static PTHREADPOOL_THREAD_LOCAL bool last_try_inline = false;
+
+int pthreadpool_last_try_ran_inline(void) {
+	return last_try_inline;
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_set_last_try_inline(bool ran_inline) {
+	last_try_inline = ran_inline;
+}
+
+PTHREADPOOL_INTERNAL struct thread_info* pthreadpool_get_current_thread(void) {
+	return current_thread;
+}
+
+PTHREADPOOL_INTERNAL struct thread_info* pthreadpool_set_current_thread(
+	struct thread_info* thread)
+{
+	struct thread_info* previous_thread = current_thread;
+	current_thread = thread;
+	return previous_thread;
+}
+
+static void lock_nested_computations(struct pthreadpool* threadpool) {
+	for (;;) {
+		size_t unlocked = 0;
+		if (pthreadpool_load_relaxed_size_t(&threadpool->nested_lock) == 0 &&
+			pthreadpool_compare_exchange_relaxed_size_t(&threadpool->nested_lock, &unlocked, 1))
+		{
+			break;
+		}
+		pthreadpool_yield();
+	}
+	pthreadpool_fence_acquire();
+}
+
+static void unlock_nested_computations(struct pthreadpool* threadpool) {
+	pthreadpool_store_release_size_t(&threadpool->nested_lock, 0);
+}
+
+static struct pthreadpool* acquire_nested_threadpool(struct pthreadpool* threadpool) {
+	lock_nested_computations(threadpool);
+	struct pthreadpool* nested_threadpool = threadpool->spare_nested_threadpools;
+	if (nested_threadpool != NULL) {
+		threadpool->spare_nested_threadpools =
+			(struct pthreadpool*) pthreadpool_load_relaxed_void_p(&nested_threadpool->next_nested);
+	}
+	unlock_nested_computations(threadpool);
+	if (nested_threadpool != NULL) {
+		return nested_threadpool;
+	}
+
+	const size_t threads_count = threadpool->threads_count.value;
+	nested_threadpool = pthreadpool_allocate(threads_count);
+	if (nested_threadpool == NULL) {
+		return NULL;
+	}
+
+	/* Nested computations steal in the same order as the computations of the thread pool */
+	nested_threadpool->parent_threadpool = threadpool;
+	nested_threadpool->threads_count = threadpool->threads_count;
+	nested_threadpool->total_capacity = threadpool->total_capacity;
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		const struct thread_info* thread = &threadpool->threads[tid];
+		struct thread_info* nested_thread = &nested_threadpool->threads[tid];
+		nested_thread->thread_number = tid;
+		nested_thread->threadpool = nested_threadpool;
+		nested_thread->cpu_id = thread->cpu_id;
+		/* Threads of the thread pool update their seeds concurrently, so nested computations start from fresh ones */
+		nested_thread->victim_seed = ((uint32_t) tid + 1) * UINT32_C(0x9E3779B9);
+		for (size_t level = 0; level < threadpool_topology_levels; level++) {
+			nested_thread->domain_start[level] = thread->domain_start[level];
+			nested_thread->domain_end[level] = thread->domain_end[level];
+		}
+		nested_thread->capacity_end = thread->capacity_end;
+	}
+	return nested_threadpool;
+}
+
+/* Assigns all items to one thread: other threads may only steal them */
+static void assign_all_items(
+	struct pthreadpool* threadpool,
+	size_t thread_number,
+	size_t linear_range)
+{
+	const size_t threads_count = threadpool->threads_count.value;
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		struct thread_info* thread = &threadpool->threads[tid];
+		const size_t range_length = tid == thread_number ? linear_range : 0;
+		thread->stolen_items = 0;
+		pthreadpool_store_relaxed_size_t(&thread->range_start, 0);
+		pthreadpool_store_relaxed_size_t(&thread->range_end, range_length);
+		pthreadpool_store_relaxed_size_t(&thread->range_length, range_length);
+	}
+	pthreadpool_mark_busy_threads(threadpool);
+}
+
+static void setup_computation(
+	struct pthreadpool* threadpool,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	uint32_t flags)
+{
+	pthreadpool_store_relaxed_void_p(&threadpool->thread_function, (void*) thread_function);
+	pthreadpool_store_relaxed_void_p(&threadpool->task, task);
+	pthreadpool_store_relaxed_void_p(&threadpool->argument, context);
+	pthreadpool_store_relaxed_uint32_t(&threadpool->flags, flags);
+	if (params_size != 0) {
+		memcpy(&threadpool->params, params, params_size);
+	}
+}
+
+static void run_thread_function(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread)
+{
+	const uint32_t flags = pthreadpool_load_relaxed_uint32_t(&threadpool->flags);
+	const thread_function_t thread_function =
+		(thread_function_t) pthreadpool_load_relaxed_void_p(&threadpool->thread_function);
+
+	struct fpu_state saved_fpu_state = { 0 };
+	if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+		saved_fpu_state = get_fpu_state();
+		disable_fpu_denormals();
+	}
+
+	thread->running = true;
+	thread_function(threadpool, thread);
+	thread->running = false;
+
+	if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+		set_fpu_state(saved_fpu_state);
+	}
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_parallelize_inline(
+	size_t thread_number,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	uint32_t flags)
+{
+	assert(thread_function != NULL);
+	assert(task != NULL);
+
+	union {
+		struct pthreadpool threadpool;
+		char storage[sizeof(struct pthreadpool) + sizeof(struct thread_info) + sizeof(pthreadpool_atomic_size_t)];
+	} single_thread;
+	memset(&single_thread, 0, sizeof(single_thread));
+
+	struct pthreadpool* threadpool = &single_thread.threadpool;
+	threadpool->threads_count = fxdiv_init_size_t(1);
+	threadpool->busy_threads = (pthreadpool_atomic_size_t*) &threadpool->threads[1];
+	threadpool->threads[0].threadpool = threadpool;
+
+	/* Static schedule never looks for victims, thus the thread number needs no structure of its own */
+	flags &= ~(PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE | PTHREADPOOL_FLAG_GUIDED_SCHEDULE);
+	flags |= PTHREADPOOL_FLAG_STATIC_SCHEDULE;
+	setup_computation(threadpool, thread_function, params, params_size, task, context, flags);
+	assign_all_items(threadpool, 0, linear_range);
+	threadpool->threads[0].thread_number = thread_number;
+
+	run_thread_function(threadpool, &threadpool->threads[0]);
+}
+
+static void release_nested_threadpool(
+	struct pthreadpool* threadpool,
+	struct pthreadpool* nested_threadpool)
+{
+	lock_nested_computations(threadpool);
+	pthreadpool_store_relaxed_void_p(&nested_threadpool->next_nested, threadpool->spare_nested_threadpools);
+	threadpool->spare_nested_threadpools = nested_threadpool;
+	unlock_nested_computations(threadpool);
+}
+
+/* Makes the computation visible to idle threads. Must be called after the computation is fully set up */
+static void publish_computation(
+	struct pthreadpool* threadpool,
+	struct pthreadpool* nested_threadpool,
+	bool async_job,
+	completion_function_t job_completion,
+	void* job_completion_context)
+{
+	pthreadpool_store_relaxed_size_t(&nested_threadpool->nested_helpers, 0);
+
+	lock_nested_computations(threadpool);
+	nested_threadpool->async_job = async_job;
+	nested_threadpool->job_completed = false;
+	nested_threadpool->job_event_fd = -1;
+	nested_threadpool->job_completion = job_completion;
+	nested_threadpool->job_completion_context = job_completion_context;
+	pthreadpool_store_relaxed_void_p(&nested_threadpool->next_nested,
+		pthreadpool_load_relaxed_void_p(&threadpool->nested_computations));
+	pthreadpool_store_relaxed_void_p(&threadpool->nested_computations, nested_threadpool);
+	unlock_nested_computations(threadpool);
+}
+
+/* Removes the computation from the list, so that no more threads join it. Must be called under the lock */
+static void unpublish_computation(
+	struct pthreadpool* threadpool,
+	struct pthreadpool* nested_threadpool)
+{
+	pthreadpool_atomic_void_p* link = &threadpool->nested_computations;
+	while (pthreadpool_load_relaxed_void_p(link) != nested_threadpool) {
+		link = &((struct pthreadpool*) pthreadpool_load_relaxed_void_p(link))->next_nested;
+	}
+	pthreadpool_store_relaxed_void_p(link, pthreadpool_load_relaxed_void_p(&nested_threadpool->next_nested));
+}
+
+static bool has_unclaimed_items(struct pthreadpool* nested_threadpool) {
+	return pthreadpool_has_busy_threads(nested_threadpool) ||
+		pthreadpool_has_shared_items(
+			nested_threadpool, pthreadpool_load_relaxed_size_t(&nested_threadpool->remaining_items.value));
+}
+
+/* Counts the calling thread as a helper of the computation. Must be called under the lock */
+static void join_computation(struct pthreadpool* nested_threadpool) {
+	/* Helping threads may leave concurrently */
+	size_t helpers = pthreadpool_load_relaxed_size_t(&nested_threadpool->nested_helpers);
+	while (!pthreadpool_compare_exchange_relaxed_size_t(&nested_threadpool->nested_helpers, &helpers, helpers + 1));
+}
+
+static void signal_job_event(struct pthreadpool* job) {
+	#if defined(__linux__)
+		if (job->job_event_fd >= 0) {
+			eventfd_write(job->job_event_fd, 1);
+		}
+	#endif
+}
+
+/*
+ * Unpublishes the asynchronous job and signals its file descriptor or calls its completion function once all items were
+ * processed, so that finished jobs which the caller didn't wait for yet don't wake up idle threads. Must be called under
+ * the lock.
+ */
+static void complete_async_job(
+	struct pthreadpool* threadpool,
+	struct pthreadpool* job)
+{
+	if (job->job_completed || has_unclaimed_items(job) ||
+		pthreadpool_load_acquire_size_t(&job->nested_helpers) != 0)
+	{
+		return;
+	}
+	job->job_completed = true;
+	unpublish_computation(threadpool, job);
+	if (job->job_completion != NULL) {
+		job->job_completion(job->job_completion_context);
+
+		/* Nobody waits for the job: release the structure under the same lock */
+		pthreadpool_store_relaxed_void_p(&job->next_nested, threadpool->spare_nested_threadpools);
+		threadpool->spare_nested_threadpools = job;
+		return;
+	}
+	signal_job_event(job);
+}
+
+/*
+ * Processes items of a joined computation, and leaves it. Each system thread processes published computations in the
+ * structure with its own thread number, thus the structures are never shared between the threads.
+ */
+static void help_computation(
+	struct pthreadpool* nested_threadpool,
+	struct thread_info* thread)
+{
+	/* The flag was set under the lock before the thread joined, and can't change until the thread leaves */
+	const bool async_job = nested_threadpool->async_job;
+
+	run_thread_function(nested_threadpool, &nested_threadpool->threads[thread->thread_number]);
+	pthreadpool_decrement_fetch_release_size_t(&nested_threadpool->nested_helpers);
+
+	/* Once the thread left, the structure may be completed or even reused, but completion rechecks it under the lock */
+	if (async_job) {
+		struct pthreadpool* threadpool = nested_threadpool->parent_threadpool;
+		lock_nested_computations(threadpool);
+		complete_async_job(threadpool, nested_threadpool);
+		unlock_nested_computations(threadpool);
+	}
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_parallelize_nested(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	uint32_t flags)
+{
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+	assert(thread_function != NULL);
+	assert(task != NULL);
+	assert(linear_range > 1);
+
+	/* Partitions and processors of the outer computation don't carry over to nested computations */
+	flags &= ~(PTHREADPOOL_FLAG_ADAPTIVE_PARTITION | PTHREADPOOL_FLAG_CPU_AFFINITY);
+
+	struct pthreadpool* nested_threadpool = acquire_nested_threadpool(threadpool);
+	if (nested_threadpool == NULL) {
+		pthreadpool_parallelize_inline(
+			thread->thread_number, thread_function, params, params_size, task, context, linear_range, flags);
+		return;
+	}
+
+	setup_computation(nested_threadpool, thread_function, params, params_size, task, context, flags);
+	if (flags & (PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE | PTHREADPOOL_FLAG_GUIDED_SCHEDULE)) {
+		pthreadpool_assign_ranges(nested_threadpool, linear_range, params_size, flags);
+	} else {
+		/* Work-first: the calling thread starts on the items, and idle threads steal the upper halves */
+		assign_all_items(nested_threadpool, thread->thread_number, linear_range);
+	}
+	publish_computation(threadpool, nested_threadpool, false, NULL, NULL);
+
+	run_thread_function(nested_threadpool, &nested_threadpool->threads[thread->thread_number]);
+
+	/* All items are claimed: unpublish the nested computation, and wait until the helping threads finish their items */
+	lock_nested_computations(threadpool);
+	unpublish_computation(threadpool, nested_threadpool);
+	unlock_nested_computations(threadpool);
+
+	while (pthreadpool_load_acquire_size_t(&nested_threadpool->nested_helpers) != 0) {
+		pthreadpool_yield();
+	}
+
+	/* Make changes by other threads visible to this thread */
+	pthreadpool_fence_acquire();
+
+	release_nested_threadpool(threadpool, nested_threadpool);
+}
+
+PTHREADPOOL_INTERNAL struct pthreadpool* pthreadpool_start_concurrent_computation(
+	struct pthreadpool* threadpool,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	uint32_t flags,
+	bool async_job,
+	completion_function_t job_completion,
+	void* job_completion_context)
+{
+	assert(threadpool != NULL);
+	assert(thread_function != NULL);
+	assert(task != NULL);
+	assert(linear_range > 1);
+
+	/* Threads which never join the computation can't process their own parts, thus the parts must be stealable */
+	flags &= ~(PTHREADPOOL_FLAG_STATIC_SCHEDULE | PTHREADPOOL_FLAG_ADAPTIVE_PARTITION | PTHREADPOOL_FLAG_CPU_AFFINITY);
+
+	struct pthreadpool* nested_threadpool = acquire_nested_threadpool(threadpool);
+	if (nested_threadpool == NULL) {
+		return NULL;
+	}
+
+	setup_computation(nested_threadpool, thread_function, params, params_size, task, context, flags);
+	pthreadpool_assign_ranges(nested_threadpool, linear_range, params_size, flags);
+	publish_computation(threadpool, nested_threadpool, async_job, job_completion, job_completion_context);
+	return nested_threadpool;
+}
+
+PTHREADPOOL_INTERNAL bool pthreadpool_help_concurrent_computation(
+	struct pthreadpool* threadpool,
+	struct pthreadpool* computation,
+	struct thread_info* thread)
+{
+	assert(threadpool != NULL);
+	assert(computation != NULL);
+	assert(thread != NULL);
+
+	lock_nested_computations(threadpool);
+	/* Like in pthreadpool_help_nested_computation, the thread never joins a computation it already runs */
+	const bool unclaimed_items =
+		!computation->threads[thread->thread_number].running && has_unclaimed_items(computation);
+	if (unclaimed_items) {
+		join_computation(computation);
+	}
+	unlock_nested_computations(threadpool);
+
+	if (unclaimed_items) {
+		help_computation(computation, thread);
+	}
+	return unclaimed_items;
+}
+
+PTHREADPOOL_INTERNAL bool pthreadpool_finish_concurrent_computation(
+	struct pthreadpool* threadpool,
+	struct pthreadpool* computation)
+{
+	assert(threadpool != NULL);
+	assert(computation != NULL);
+
+	/* Helpers process all items they claimed before they leave, and only join while there are unclaimed items */
+	lock_nested_computations(threadpool);
+	const bool finished = !has_unclaimed_items(computation) &&
+		pthreadpool_load_acquire_size_t(&computation->nested_helpers) == 0;
+	if (finished && !computation->job_completed) {
+		unpublish_computation(threadpool, computation);
+	}
+	unlock_nested_computations(threadpool);
+	if (!finished) {
+		return false;
+	}
+
+	/* Make changes by other threads visible to this thread */
+	pthreadpool_fence_acquire();
+
+	#if defined(__linux__)
+		if (computation->job_event_fd >= 0) {
+			close(computation->job_event_fd);
+		}
+	#endif
+
+	release_nested_threadpool(threadpool, computation);
+	return true;
+}
+
+PTHREADPOOL_INTERNAL bool pthreadpool_help_nested_computation(
+	struct pthreadpool* threadpool)
+{
+	assert(threadpool != NULL);
+
+	/*
+	 * Structures of nested computations are never freed before the thread pool, so the list can be checked without
+	 * the lock, and only joining a computation needs it.
+	 */
+	if (pthreadpool_load_relaxed_void_p(&threadpool->nested_computations) == NULL) {
+		return false;
+	}
+
+	struct thread_info* thread = current_thread;
+	if (thread == NULL || thread->threadpool != threadpool) {
+		return false;
+	}
+
+	lock_nested_computations(threadpool);
+	struct pthreadpool* nested_threadpool =
+		(struct pthreadpool*) pthreadpool_load_relaxed_void_p(&threadpool->nested_computations);
+	/*
+	 * A task which waits for other work may run inside computations of the calling thread, which keep the positions in
+	 * their ranges in local variables: joining them again would process the items from stale positions.
+	 */
+	while (nested_threadpool != NULL &&
+		(nested_threadpool->threads[thread->thread_number].running || !has_unclaimed_items(nested_threadpool)))
+	{
+		nested_threadpool = (struct pthreadpool*) pthreadpool_load_relaxed_void_p(&nested_threadpool->next_nested);
+	}
+	if (nested_threadpool != NULL) {
+		join_computation(nested_threadpool);
+	}
+	unlock_nested_computations(threadpool);
+	if (nested_threadpool == NULL) {
+		return false;
+	}
+
+	help_computation(nested_threadpool, thread);
+	return true;
+}
+
+int pthreadpool_test(pthreadpool_job_t job) {
+	if (job == NULL) {
+		return 1;
+	}
+
+	struct pthreadpool* computation = (struct pthreadpool*) job;
+	struct pthreadpool* threadpool = computation->parent_threadpool;
+	lock_nested_computations(threadpool);
+	complete_async_job(threadpool, computation);
+	const bool completed = computation->job_completed;
+	unlock_nested_computations(threadpool);
+	return completed;
+}
+
+int pthreadpool_get_job_fd(pthreadpool_job_t job) {
+	#if defined(__linux__)
+		if (job == NULL) {
+			return -1;
+		}
+
+		/* The job is signalled either here or by the thread which completes it, whichever comes last */
+		struct pthreadpool* computation = (struct pthreadpool*) job;
+		struct pthreadpool* threadpool = computation->parent_threadpool;
+		lock_nested_computations(threadpool);
+		if (computation->job_event_fd < 0) {
+			computation->job_event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+			if (computation->job_completed) {
+				signal_job_event(computation);
+			}
+		}
+		const int event_fd = computation->job_event_fd;
+		unlock_nested_computations(threadpool);
+		return event_fd;
+	#else
+		return -1;
+	#endif
+}
@@ -1,6 +1,7 @@
 /* Standard C headers */
 #include <assert.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -29,6 +30,15 @@ size_t pthreadpool_get_threads_count(struct pthreadpool* threadpool) {
 	return threadpool->threads_count.value;
 }
 
+void pthreadpool_set_thread_capacities(
+	struct pthreadpool* threadpool,
+	const uint32_t* capacities)
+{
+	if (threadpool != NULL) {
+		pthreadpool_set_capacities(threadpool, capacities);
+	}
+}
+
 static void thread_parallelize_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
@@ -38,20 +48,20 @@ static void thread_parallelize_1d(struct pthreadpool* threadpool, struct thread_
 
 	/* Process thread's own range of items */
 	size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
 		task(argument, range_start++);
 	}
 
 	/* There still may be other threads with work */
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
+		size_t index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &index)) {
 			task(argument, index);
 		}
 	}
@@ -70,19 +80,19 @@ static void thread_parallelize_1d_with_thread(struct pthreadpool* threadpool, st
 	const size_t thread_number = thread->thread_number;
 	/* Process thread's own range of items */
 	size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
 		task(argument, thread_number, range_start++);
 	}
 
 	/* There still may be other threads with work */
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
+		size_t index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &index)) {
 			task(argument, thread_number, index);
 		}
 	}
@@ -109,20 +119,20 @@ static void thread_parallelize_1d_with_uarch(struct pthreadpool* threadpool, str
 
 	/* Process thread's own range of items */
 	size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
 		task(argument, uarch_index, range_start++);
 	}
 
 	/* There still may be other threads with work */
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
+		size_t index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &index)) {
 			task(argument, uarch_index, index);
 		}
 	}
@@ -144,21 +154,21 @@ static void thread_parallelize_1d_tile_1d(struct pthreadpool* threadpool, struct
 	size_t tile_start = range_start * tile;
 
 	const size_t range = threadpool->params.parallelize_1d_tile_1d.range;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
 		task(argument, tile_start, min(range - tile_start, tile));
 		tile_start += tile;
 	}
 
 	/* There still may be other threads with work */
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t tile_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
+		size_t tile_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &tile_index)) {
 			const size_t tile_start = tile_index * tile;
 			task(argument, tile_start, min(range - tile_start, tile));
 		}
@@ -168,6 +178,309 @@ static void thread_parallelize_1d_tile_1d(struct pthreadpool* threadpool, struct
 	pthreadpool_fence_release();
 }
 
+/* All stages of a tile run back to back on the same thread, while the data of the tile is still in its cache */
+static inline void process_pipeline_tile(
+	const pthreadpool_task_1d_tile_1d_t* stages,
+	size_t stages_count,
+	void* argument,
+	size_t tile_start,
+	size_t tile_size)
+{
+	for (size_t stage = 0; stage < stages_count; stage++) {
+		stages[stage](argument, tile_start, tile_size);
+	}
+}
+
+static void thread_parallelize_1d_tile_1d_pipeline(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_1d_tile_1d_t* stages = threadpool->params.parallelize_1d_tile_1d_pipeline.stages;
+	const size_t stages_count = threadpool->params.parallelize_1d_tile_1d_pipeline.stages_count;
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	/* Process thread's own range of items */
+	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+	const size_t tile = threadpool->params.parallelize_1d_tile_1d_pipeline.tile;
+	size_t tile_start = range_start * tile;
+
+	const size_t range = threadpool->params.parallelize_1d_tile_1d_pipeline.range;
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
+		process_pipeline_tile(stages, stages_count, argument, tile_start, min(range - tile_start, tile));
+		tile_start += tile;
+	}
+
+	/* There still may be other threads with work */
+	const size_t thread_number = thread->thread_number;
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
+		tid != thread_number;
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
+	{
+		struct thread_info* other_thread = &threadpool->threads[tid];
+		size_t tile_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &tile_index)) {
+			const size_t tile_start = tile_index * tile;
+			process_pipeline_tile(stages, stages_count, argument, tile_start, min(range - tile_start, tile));
+		}
+	}
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_1d_range(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_1d_range_t task = (pthreadpool_task_1d_range_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	/* Process thread's own range of items, passing each reserved batch to the task at once */
+	const size_t range = threadpool->params.parallelize_1d_range.range;
+	const size_t alignment = threadpool->params.parallelize_1d_range.alignment;
+	size_t start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+	size_t count;
+	while ((count = pthreadpool_reserve_batch(threadpool, &thread->range_length)) != 0) {
+		task(argument, start * alignment, min((start + count) * alignment, range));
+		start += count;
+	}
+
+	/* There still may be other threads with work */
+	const size_t thread_number = thread->thread_number;
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
+		tid != thread_number;
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
+	{
+		struct thread_info* other_thread = &threadpool->threads[tid];
+		while ((count = pthreadpool_steal_items(threadpool, thread, other_thread, &start)) != 0) {
+			task(argument, start * alignment, min((start + count) * alignment, range));
+		}
+	}
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static inline size_t load_index(const void* indices, bool u32_indices, size_t position) {
+	if (u32_indices) {
+		return (size_t) ((const uint32_t*) indices)[position];
+	} else {
+		return ((const size_t*) indices)[position];
+	}
+}
+
+static void thread_parallelize_1d_indexed(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_1d_t task = (pthreadpool_task_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	/* Process thread's own range of items */
+	const void* indices = threadpool->params.parallelize_1d_indexed.indices;
+	const bool u32_indices = threadpool->params.parallelize_1d_indexed.u32_indices;
+	size_t position = pthreadpool_load_relaxed_size_t(&thread->range_start);
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
+		task(argument, load_index(indices, u32_indices, position++));
+	}
+
+	/* There still may be other threads with work */
+	const size_t thread_number = thread->thread_number;
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
+		tid != thread_number;
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
+	{
+		struct thread_info* other_thread = &threadpool->threads[tid];
+		size_t index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &index)) {
+			task(argument, load_index(indices, u32_indices, index));
+		}
+	}
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static inline void call_indexed_tile_1d(
+	void* task,
+	void* argument,
+	const void* indices,
+	bool u32_indices,
+	size_t position,
+	size_t count)
+{
+	if (u32_indices) {
+		((pthreadpool_task_1d_indexed_u32_tile_1d_t) task)(argument, (const uint32_t*) indices + position, count);
+	} else {
+		((pthreadpool_task_1d_indexed_tile_1d_t) task)(argument, (const size_t*) indices + position, count);
+	}
+}
+
+static void thread_parallelize_1d_indexed_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	void *const task = pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	/* Process thread's own range of items */
+	const void* indices = threadpool->params.parallelize_1d_indexed_tile_1d.indices;
+	const bool u32_indices = threadpool->params.parallelize_1d_indexed_tile_1d.u32_indices;
+	const size_t count = threadpool->params.parallelize_1d_indexed_tile_1d.count;
+	const size_t tile = threadpool->params.parallelize_1d_indexed_tile_1d.tile;
+	size_t tile_start = pthreadpool_load_relaxed_size_t(&thread->range_start) * tile;
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
+		call_indexed_tile_1d(task, argument, indices, u32_indices, tile_start, min(count - tile_start, tile));
+		tile_start += tile;
+	}
+
+	/* There still may be other threads with work */
+	const size_t thread_number = thread->thread_number;
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
+		tid != thread_number;
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
+	{
+		struct thread_info* other_thread = &threadpool->threads[tid];
+		size_t tile_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &tile_index)) {
+			const size_t tile_start = tile_index * tile;
+			call_indexed_tile_1d(task, argument, indices, u32_indices, tile_start, min(count - tile_start, tile));
+		}
+	}
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+/*
+ * Returns the row which contains the item at the specified offset, i.e. the last row i such that
+ * row_offsets[i] <= offset < row_offsets[i + 1]. Empty rows never contain items and are skipped.
+ */
+static size_t find_ragged_row(const size_t* row_offsets, size_t rows, size_t offset) {
+	size_t row_start = 0;
+	size_t row_end = rows;
+	while (row_end - row_start > 1) {
+		const size_t row_middle = row_start + (row_end - row_start) / 2;
+		if (row_offsets[row_middle] <= offset) {
+			row_start = row_middle;
+		} else {
+			row_end = row_middle;
+		}
+	}
+	return row_start;
+}
+
+static void thread_parallelize_ragged_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_ragged_2d_t task = (pthreadpool_task_ragged_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	/* Process thread's own range of items */
+	const size_t* row_offsets = threadpool->params.parallelize_ragged_2d.row_offsets;
+	const size_t rows = threadpool->params.parallelize_ragged_2d.rows;
+	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+	size_t offset = row_offsets[0] + range_start;
+	size_t i = find_ragged_row(row_offsets, rows, offset);
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
+		while (offset >= row_offsets[i + 1]) {
+			i += 1;
+		}
+		task(argument, i, offset - row_offsets[i]);
+		offset += 1;
+	}
+
+	/* There still may be other threads with work */
+	const size_t thread_number = thread->thread_number;
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
+		tid != thread_number;
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
+	{
+		struct thread_info* other_thread = &threadpool->threads[tid];
+		size_t index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &index)) {
+			const size_t offset = row_offsets[0] + index;
+			const size_t i = find_ragged_row(row_offsets, rows, offset);
+			task(argument, i, offset - row_offsets[i]);
+		}
+	}
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+/*
+ * Processes items [offset, offset + count) of the linearized ragged grid starting at row i, calling the task for each
+ * overlapping segment of a row, and returns the row which contains the last processed item.
+ */
+static size_t process_ragged_tile(
+	pthreadpool_task_ragged_2d_tile_1d_t task,
+	void* argument,
+	const size_t* row_offsets,
+	size_t i,
+	size_t offset,
+	size_t count)
+{
+	const size_t tile_end = offset + count;
+	for (;;) {
+		const size_t segment_end = min(row_offsets[i + 1], tile_end);
+		if (segment_end != offset) {
+			task(argument, i, offset - row_offsets[i], segment_end - offset);
+			offset = segment_end;
+		}
+		if (offset == tile_end) {
+			return i;
+		}
+		i += 1;
+	}
+}
+
+static void thread_parallelize_ragged_2d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_ragged_2d_tile_1d_t task = (pthreadpool_task_ragged_2d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	/* Process thread's own range of items */
+	const size_t* row_offsets = threadpool->params.parallelize_ragged_2d_tile_1d.row_offsets;
+	const size_t rows = threadpool->params.parallelize_ragged_2d_tile_1d.rows;
+	const size_t range = threadpool->params.parallelize_ragged_2d_tile_1d.range;
+	const size_t tile = threadpool->params.parallelize_ragged_2d_tile_1d.tile;
+	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+	size_t tile_start = range_start * tile;
+	size_t i = find_ragged_row(row_offsets, rows, row_offsets[0] + tile_start);
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
+		i = process_ragged_tile(task, argument, row_offsets, i, row_offsets[0] + tile_start, min(range - tile_start, tile));
+		tile_start += tile;
+	}
+
+	/* There still may be other threads with work */
+	const size_t thread_number = thread->thread_number;
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
+		tid != thread_number;
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
+	{
+		struct thread_info* other_thread = &threadpool->threads[tid];
+		size_t tile_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &tile_index)) {
+			const size_t tile_start = tile_index * tile;
+			const size_t offset = row_offsets[0] + tile_start;
+			process_ragged_tile(task, argument, row_offsets, find_ragged_row(row_offsets, rows, offset), offset,
+				min(range - tile_start, tile));
+		}
+	}
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
 static void thread_parallelize_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
@@ -182,7 +495,8 @@ static void thread_parallelize_2d(struct pthreadpool* threadpool, struct thread_
 	size_t i = index_i_j.quotient;
 	size_t j = index_i_j.remainder;
 
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
 		task(argument, i, j);
 		if (++j == range_j.value) {
 			j = 0;
@@ -192,14 +506,13 @@ static void thread_parallelize_2d(struct pthreadpool* threadpool, struct thread_
 
 	/* There still may be other threads with work */
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
+		size_t linear_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &linear_index)) {
 			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(linear_index, range_j);
 			task(argument, index_i_j.quotient, index_i_j.remainder);
 		}
@@ -224,7 +537,8 @@ static void thread_parallelize_2d_with_thread(struct pthreadpool* threadpool, st
 	size_t j = index_i_j.remainder;
 
 	const size_t thread_number = thread->thread_number;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
 		task(argument, thread_number, i, j);
 		if (++j == range_j.value) {
 			j = 0;
@@ -233,14 +547,13 @@ static void thread_parallelize_2d_with_thread(struct pthreadpool* threadpool, st
 	}
 
 	/* There still may be other threads with work */
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
+		size_t linear_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &linear_index)) {
 			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(linear_index, range_j);
 			task(argument, thread_number, index_i_j.quotient, index_i_j.remainder);
 		}
@@ -266,7 +579,8 @@ static void thread_parallelize_2d_tile_1d(struct pthreadpool* threadpool, struct
 	size_t start_j = tile_index_i_j.remainder * tile_j;
 
 	const size_t range_j = threadpool->params.parallelize_2d_tile_1d.range_j;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
 		task(argument, i, start_j, min(range_j - start_j, tile_j));
 		start_j += tile_j;
 		if (start_j >= range_j) {
@@ -277,14 +591,13 @@ static void thread_parallelize_2d_tile_1d(struct pthreadpool* threadpool, struct
 
 	/* There still may be other threads with work */
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
+		size_t linear_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &linear_index)) {
 			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(linear_index, tile_range_j);
 			const size_t start_j = tile_index_i_j.remainder * tile_j;
 			task(argument, tile_index_i_j.quotient, start_j, min(range_j - start_j, tile_j));
@@ -295,6 +608,81 @@ static void thread_parallelize_2d_tile_1d(struct pthreadpool* threadpool, struct
 	pthreadpool_fence_release();
 }
 
+/* Calls the task for a run of count aligned chunks starting at the specified linear chunk index */
+typedef void (*call_run_task_t)(
+	void* task,
+	void* argument,
+	const union pthreadpool_params* params,
+	size_t start,
+	size_t count);
+
+/*
+ * Processes the items of a computation in runs of consecutive chunks: every batch reserved from the thread's own range,
+ * and every contiguous block of stolen items, is passed to call_task at once.
+ */
+static PTHREADPOOL_ALWAYS_INLINE void thread_parallelize_runs(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread,
+	call_run_task_t call_task)
+{
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	void *const task = pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+	const union pthreadpool_params* params = &threadpool->params;
+
+	/* Process thread's own range of items, passing each reserved batch to the task at once */
+	size_t start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+	size_t count;
+	while ((count = pthreadpool_reserve_batch(threadpool, &thread->range_length)) != 0) {
+		call_task(task, argument, params, start, count);
+		start += count;
+	}
+
+	/* There still may be other threads with work */
+	const size_t thread_number = thread->thread_number;
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
+		tid != thread_number;
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
+	{
+		struct thread_info* other_thread = &threadpool->threads[tid];
+		while ((count = pthreadpool_steal_items(threadpool, thread, other_thread, &start)) != 0) {
+			call_task(task, argument, params, start, count);
+		}
+	}
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+/* Splits the run at the boundaries of rows */
+static inline void call_2d_range(
+	void* task,
+	void* argument,
+	const union pthreadpool_params* params,
+	size_t start,
+	size_t count)
+{
+	const size_t range_j = params->parallelize_2d_range.range_j;
+	const size_t alignment_j = params->parallelize_2d_range.alignment_j;
+	const struct fxdiv_divisor_size_t aligned_range_j = params->parallelize_2d_range.aligned_range_j;
+	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(start, aligned_range_j);
+	size_t i = index_i_j.quotient;
+	size_t j = index_i_j.remainder;
+	while (count != 0) {
+		const size_t row_count = min(count, aligned_range_j.value - j);
+		((pthreadpool_task_2d_range_t) task)(argument, i, j * alignment_j, min((j + row_count) * alignment_j, range_j));
+		count -= row_count;
+		i += 1;
+		j = 0;
+	}
+}
+
+static void thread_parallelize_2d_range(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_runs(threadpool, thread, call_2d_range);
+}
+
 static void thread_parallelize_2d_tile_1d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
@@ -320,7 +708,8 @@ static void thread_parallelize_2d_tile_1d_with_uarch(struct pthreadpool* threadp
 	size_t start_j = tile_index_i_j.remainder * tile_j;
 
 	const size_t range_j = threadpool->params.parallelize_2d_tile_1d_with_uarch.range_j;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
 		task(argument, uarch_index, i, start_j, min(range_j - start_j, tile_j));
 		start_j += tile_j;
 		if (start_j >= range_j) {
@@ -331,14 +720,13 @@ static void thread_parallelize_2d_tile_1d_with_uarch(struct pthreadpool* threadp
 
 	/* There still may be other threads with work */
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
+		size_t linear_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &linear_index)) {
 			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(linear_index, tile_range_j);
 			const size_t start_j = tile_index_i_j.remainder * tile_j;
 			task(argument, uarch_index, tile_index_i_j.quotient, start_j, min(range_j - start_j, tile_j));
@@ -376,7 +764,8 @@ static void thread_parallelize_2d_tile_1d_with_uarch_with_thread(struct pthreadp
 
 	const size_t thread_number = thread->thread_number;
 	const size_t range_j = threadpool->params.parallelize_2d_tile_1d_with_uarch.range_j;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
 		task(argument, uarch_index, thread_number, i, start_j, min(range_j - start_j, tile_j));
 		start_j += tile_j;
 		if (start_j >= range_j) {
@@ -386,14 +775,13 @@ static void thread_parallelize_2d_tile_1d_with_uarch_with_thread(struct pthreadp
 	}
 
 	/* There still may be other threads with work */
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
+		size_t linear_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &linear_index)) {
 			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(linear_index, tile_range_j);
 			const size_t start_j = tile_index_i_j.remainder * tile_j;
 			task(argument, uarch_index, thread_number, tile_index_i_j.quotient, start_j, min(range_j - start_j, tile_j));
@@ -422,7 +810,8 @@ static void thread_parallelize_2d_tile_2d(struct pthreadpool* threadpool, struct
 
 	const size_t range_i = threadpool->params.parallelize_2d_tile_2d.range_i;
 	const size_t range_j = threadpool->params.parallelize_2d_tile_2d.range_j;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
 		task(argument, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
 		start_j += tile_j;
 		if (start_j >= range_j) {
@@ -433,14 +822,13 @@ static void thread_parallelize_2d_tile_2d(struct pthreadpool* threadpool, struct
 
 	/* There still may be other threads with work */
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
+		size_t linear_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &linear_index)) {
 			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(linear_index, tile_range_j);
 			const size_t start_i = tile_index_i_j.quotient * tile_i;
 			const size_t start_j = tile_index_i_j.remainder * tile_j;
@@ -452,56 +840,38 @@ static void thread_parallelize_2d_tile_2d(struct pthreadpool* threadpool, struct
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_2d_tile_2d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_2d_triangular(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_2d_tile_2d_with_id_t task = (pthreadpool_task_2d_tile_2d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_2d_t task = (pthreadpool_task_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	const uint32_t default_uarch_index = threadpool->params.parallelize_2d_tile_2d_with_uarch.default_uarch_index;
-	uint32_t uarch_index = default_uarch_index;
-	#if PTHREADPOOL_USE_CPUINFO
-		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-		if (uarch_index > threadpool->params.parallelize_2d_tile_2d_with_uarch.max_uarch_index) {
-			uarch_index = default_uarch_index;
-		}
-	#endif
-
 	/* Process thread's own range of items */
-	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_2d_tile_2d_with_uarch.tile_range_j;
 	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_result_size_t index = fxdiv_divide_size_t(range_start, tile_range_j);
-	const size_t range_i = threadpool->params.parallelize_2d_tile_2d_with_uarch.range_i;
-	const size_t tile_i = threadpool->params.parallelize_2d_tile_2d_with_uarch.tile_i;
-	const size_t range_j = threadpool->params.parallelize_2d_tile_2d_with_uarch.range_j;
-	const size_t tile_j = threadpool->params.parallelize_2d_tile_2d_with_uarch.tile_j;
-	size_t start_i = index.quotient * tile_i;
-	size_t start_j = index.remainder * tile_j;
-
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, uarch_index, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
-		start_j += tile_j;
-		if (start_j >= range_j) {
-			start_j = 0;
-			start_i += tile_i;
+	size_t j = triangular_column(range_start);
+	size_t i = range_start - j * (j + 1) / 2;
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
+		task(argument, i, j);
+		if (++i > j) {
+			i = 0;
+			j += 1;
 		}
 	}
 
 	/* There still may be other threads with work */
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(linear_index, tile_range_j);
-			const size_t start_i = tile_index_i_j.quotient * tile_i;
-			const size_t start_j = tile_index_i_j.remainder * tile_j;
-			task(argument, uarch_index, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
+		size_t index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &index)) {
+			const size_t j = triangular_column(index);
+			const size_t i = index - j * (j + 1) / 2;
+			task(argument, i, j);
 		}
 	}
 
@@ -509,47 +879,44 @@ static void thread_parallelize_2d_tile_2d_with_uarch(struct pthreadpool* threadp
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_3d(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_2d_tile_2d_morton(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_3d_t task = (pthreadpool_task_3d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_2d_tile_2d_t task = (pthreadpool_task_2d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
 	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_3d.range_k;
-	const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(range_start, range_k);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_ij_k.remainder;
-
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k);
-		if (++k == range_k.value) {
-			k = 0;
-			if (++j == range_j.value) {
-				j = 0;
-				i += 1;
-			}
-		}
+	size_t tile_index = pthreadpool_load_relaxed_size_t(&thread->range_start);
+	const size_t tile_i = threadpool->params.parallelize_2d_tile_2d.tile_i;
+	const size_t tile_j = threadpool->params.parallelize_2d_tile_2d.tile_j;
+	const size_t range_i = threadpool->params.parallelize_2d_tile_2d.range_i;
+	const size_t range_j = threadpool->params.parallelize_2d_tile_2d.range_j;
+	const size_t tile_rows = divide_round_up(range_i, tile_i);
+	const size_t tile_columns = threadpool->params.parallelize_2d_tile_2d.tile_range_j.value;
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
+		size_t index_i, index_j;
+		morton_tile(tile_index++, tile_rows, tile_columns, &index_i, &index_j);
+		const size_t start_i = index_i * tile_i;
+		const size_t start_j = index_j * tile_j;
+		task(argument, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
 	}
 
 	/* There still may be other threads with work */
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(linear_index, range_k);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_ij_k.remainder);
+		size_t linear_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &linear_index)) {
+			size_t index_i, index_j;
+			morton_tile(linear_index, tile_rows, tile_columns, &index_i, &index_j);
+			const size_t start_i = index_i * tile_i;
+			const size_t start_j = index_j * tile_j;
+			task(argument, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
 		}
 	}
 
@@ -557,51 +924,45 @@ static void thread_parallelize_3d(struct pthreadpool* threadpool, struct thread_
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_3d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_2d_tile_2d_triangular(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_3d_tile_1d_t task = (pthreadpool_task_3d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_2d_tile_2d_t task = (pthreadpool_task_2d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
 	/* Process thread's own range of items */
 	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_1d.tile_range_k;
-	const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d_tile_1d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-	const size_t tile_k = threadpool->params.parallelize_3d_tile_1d.tile_k;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t start_k = tile_index_ij_k.remainder * tile_k;
-
-	const size_t range_k = threadpool->params.parallelize_3d_tile_1d.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, start_k, min(range_k - start_k, tile_k));
-		start_k += tile_k;
-		if (start_k >= range_k) {
-			start_k = 0;
-			if (++j == range_j.value) {
-				j = 0;
-				i += 1;
-			}
+	const size_t range = threadpool->params.parallelize_2d_tile_2d_triangular.range;
+	const size_t tile = threadpool->params.parallelize_2d_tile_2d_triangular.tile;
+	size_t tile_j = triangular_column(range_start);
+	size_t tile_i = range_start - tile_j * (tile_j + 1) / 2;
+	size_t start_i = tile_i * tile;
+	size_t start_j = tile_j * tile;
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
+		task(argument, start_i, start_j, min(range - start_i, tile), min(range - start_j, tile));
+		start_i += tile;
+		if (start_i > start_j) {
+			start_i = 0;
+			start_j += tile;
 		}
 	}
 
 	/* There still may be other threads with work */
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(linear_index, tile_range_k);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-			const size_t start_k = tile_index_ij_k.remainder * tile_k;
-			task(argument, index_i_j.quotient, index_i_j.remainder, start_k, min(range_k - start_k, tile_k));
+		size_t tile_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &tile_index)) {
+			const size_t tile_j = triangular_column(tile_index);
+			const size_t tile_i = tile_index - tile_j * (tile_j + 1) / 2;
+			const size_t start_i = tile_i * tile;
+			const size_t start_j = tile_j * tile;
+			task(argument, start_i, start_j, min(range - start_i, tile), min(range - start_j, tile));
 		}
 	}
 
@@ -609,174 +970,138 @@ static void thread_parallelize_3d_tile_1d(struct pthreadpool* threadpool, struct
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_3d_tile_1d_with_thread(struct pthreadpool* threadpool, struct thread_info* thread) {
+/*
+ * Returns the tile at the specified position in the wavefront order of a grid with tile_rows x tile_columns tiles.
+ * Tiles are ordered by anti-diagonal d = tile_i + tile_j, and by tile_i within an anti-diagonal. With m and M denoting
+ * the smaller and larger grid dimension, anti-diagonals grow by one tile up to length m, keep length m until
+ * anti-diagonal M - 1, and then shrink symmetrically, so the first and the last m - 1 anti-diagonals form triangles.
+ */
+static void wavefront_tile(size_t position, size_t tile_rows, size_t tile_columns, size_t* tile_i, size_t* tile_j) {
+	const size_t m = min(tile_rows, tile_columns);
+	const size_t m_triangle = m * (m + 1) / 2;
+	const size_t band_end = m_triangle + (max(tile_rows, tile_columns) - m) * m;
+	size_t diagonal, offset;
+	if (position < m_triangle) {
+		diagonal = triangular_column(position);
+		offset = position - diagonal * (diagonal + 1) / 2;
+	} else if (position < band_end) {
+		const size_t band_position = position - m_triangle;
+		diagonal = m + band_position / m;
+		offset = band_position % m;
+	} else {
+		const size_t reverse_position = tile_rows * tile_columns - 1 - position;
+		const size_t reverse_diagonal = triangular_column(reverse_position);
+		diagonal = tile_rows + tile_columns - 2 - reverse_diagonal;
+		offset = reverse_diagonal - (reverse_position - reverse_diagonal * (reverse_diagonal + 1) / 2);
+	}
+	const size_t first_i = diagonal >= tile_columns ? diagonal - (tile_columns - 1) : 0;
+	*tile_i = first_i + offset;
+	*tile_j = diagonal - *tile_i;
+}
+
+static void thread_parallelize_2d_tile_2d_wavefront(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
-	assert(thread != NULL);
+	/* Tiles are claimed from a shared counter, thus the thread has no range of its own */
+	(void) thread;
 
-	const pthreadpool_task_3d_tile_1d_with_thread_t task = (pthreadpool_task_3d_tile_1d_with_thread_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_2d_tile_2d_t task = (pthreadpool_task_2d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_1d.tile_range_k;
-	const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d_tile_1d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-	const size_t tile_k = threadpool->params.parallelize_3d_tile_1d.tile_k;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t start_k = tile_index_ij_k.remainder * tile_k;
+	const size_t range_i = threadpool->params.parallelize_2d_tile_2d_wavefront.range_i;
+	const size_t tile_i = threadpool->params.parallelize_2d_tile_2d_wavefront.tile_i;
+	const size_t range_j = threadpool->params.parallelize_2d_tile_2d_wavefront.range_j;
+	const size_t tile_j = threadpool->params.parallelize_2d_tile_2d_wavefront.tile_j;
+	const size_t tile_rows = divide_round_up(range_i, tile_i);
+	const size_t tile_columns = divide_round_up(range_j, tile_j);
+	const size_t tile_count = tile_rows * tile_columns;
+	pthreadpool_atomic_size_t* remaining_tiles = threadpool->params.parallelize_2d_tile_2d_wavefront.remaining_tiles;
+	pthreadpool_atomic_size_t* row_progress = threadpool->params.parallelize_2d_tile_2d_wavefront.row_progress;
 
-	const size_t thread_number = thread->thread_number;
-	const size_t range_k = threadpool->params.parallelize_3d_tile_1d.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, thread_number, i, j, start_k, min(range_k - start_k, tile_k));
-		start_k += tile_k;
-		if (start_k >= range_k) {
-			start_k = 0;
-			if (++j == range_j.value) {
-				j = 0;
-				i += 1;
-			}
-		}
-	}
-
-	/* There still may be other threads with work */
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(linear_index, tile_range_k);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-			const size_t start_k = tile_index_ij_k.remainder * tile_k;
-			task(argument, thread_number, index_i_j.quotient, index_i_j.remainder, start_k, min(range_k - start_k, tile_k));
-		}
-	}
-
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
-}
-
-static void thread_parallelize_3d_tile_1d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
-
-	const pthreadpool_task_3d_tile_1d_with_id_t task = (pthreadpool_task_3d_tile_1d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
-
-	const uint32_t default_uarch_index = threadpool->params.parallelize_3d_tile_1d_with_uarch.default_uarch_index;
-	uint32_t uarch_index = default_uarch_index;
-	#if PTHREADPOOL_USE_CPUINFO
-		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-		if (uarch_index > threadpool->params.parallelize_3d_tile_1d_with_uarch.max_uarch_index) {
-			uarch_index = default_uarch_index;
+	/*
+	 * Tiles are claimed one at a time in wavefront order, thus dependencies of a tile are always claimed earlier, and
+	 * waiting for them can not deadlock: the earliest unfinished tile always has all of its dependencies satisfied.
+	 */
+	for (;;) {
+		const size_t remaining = pthreadpool_fetch_sub_relaxed_size_t(remaining_tiles, 1);
+		if (remaining == 0 || remaining > tile_count) {
+			break;
 		}
-	#endif
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.tile_range_k;
-	const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d_tile_1d_with_uarch.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-	const size_t tile_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.tile_k;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t start_k = tile_index_ij_k.remainder * tile_k;
+		size_t ti, tj;
+		wavefront_tile(tile_count - remaining, tile_rows, tile_columns, &ti, &tj);
 
-	const size_t range_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, uarch_index, i, j, start_k, min(range_k - start_k, tile_k));
-		start_k += tile_k;
-		if (start_k >= range_k) {
-			start_k = 0;
-			if (++j == range_j.value) {
-				j = 0;
-				i += 1;
+		/* Wait until tiles (ti - 1, tj) and (ti, tj - 1) are processed */
+		if (ti != 0) {
+			while (pthreadpool_load_acquire_size_t(&row_progress[ti - 1]) <= tj) {
+				pthreadpool_yield();
 			}
 		}
-	}
-
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(linear_index, tile_range_k);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-			const size_t start_k = tile_index_ij_k.remainder * tile_k;
-			task(argument, uarch_index, index_i_j.quotient, index_i_j.remainder, start_k, min(range_k - start_k, tile_k));
+		while (pthreadpool_load_acquire_size_t(&row_progress[ti]) < tj) {
+			pthreadpool_yield();
 		}
+
+		const size_t start_i = ti * tile_i;
+		const size_t start_j = tj * tile_j;
+		task(argument, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
+
+		/* Tiles within a row complete in order, so the row progress doubles as a dependency counter for its tiles */
+		pthreadpool_store_release_size_t(&row_progress[ti], tj + 1);
 	}
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_3d_tile_1d_with_uarch_with_thread(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_2d_tile_2d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_3d_tile_1d_with_id_with_thread_t task =
-		(pthreadpool_task_3d_tile_1d_with_id_with_thread_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_2d_tile_2d_with_id_t task = (pthreadpool_task_2d_tile_2d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	const uint32_t default_uarch_index = threadpool->params.parallelize_3d_tile_1d_with_uarch.default_uarch_index;
+	const uint32_t default_uarch_index = threadpool->params.parallelize_2d_tile_2d_with_uarch.default_uarch_index;
 	uint32_t uarch_index = default_uarch_index;
 	#if PTHREADPOOL_USE_CPUINFO
 		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-		if (uarch_index > threadpool->params.parallelize_3d_tile_1d_with_uarch.max_uarch_index) {
+		if (uarch_index > threadpool->params.parallelize_2d_tile_2d_with_uarch.max_uarch_index) {
 			uarch_index = default_uarch_index;
 		}
 	#endif
 
 	/* Process thread's own range of items */
+	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_2d_tile_2d_with_uarch.tile_range_j;
 	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.tile_range_k;
-	const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d_tile_1d_with_uarch.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-	const size_t tile_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.tile_k;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t start_k = tile_index_ij_k.remainder * tile_k;
+	const struct fxdiv_result_size_t index = fxdiv_divide_size_t(range_start, tile_range_j);
+	const size_t range_i = threadpool->params.parallelize_2d_tile_2d_with_uarch.range_i;
+	const size_t tile_i = threadpool->params.parallelize_2d_tile_2d_with_uarch.tile_i;
+	const size_t range_j = threadpool->params.parallelize_2d_tile_2d_with_uarch.range_j;
+	const size_t tile_j = threadpool->params.parallelize_2d_tile_2d_with_uarch.tile_j;
+	size_t start_i = index.quotient * tile_i;
+	size_t start_j = index.remainder * tile_j;
 
-	const size_t thread_number = thread->thread_number;
-	const size_t range_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, uarch_index, thread_number, i, j, start_k, min(range_k - start_k, tile_k));
-		start_k += tile_k;
-		if (start_k >= range_k) {
-			start_k = 0;
-			if (++j == range_j.value) {
-				j = 0;
-				i += 1;
-			}
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
+		task(argument, uarch_index, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
+		start_j += tile_j;
+		if (start_j >= range_j) {
+			start_j = 0;
+			start_i += tile_i;
 		}
 	}
 
 	/* There still may be other threads with work */
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	const size_t thread_number = thread->thread_number;
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(linear_index, tile_range_k);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-			const size_t start_k = tile_index_ij_k.remainder * tile_k;
-			task(argument, uarch_index, thread_number, index_i_j.quotient, index_i_j.remainder, start_k, min(range_k - start_k, tile_k));
+		size_t linear_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &linear_index)) {
+			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(linear_index, tile_range_j);
+			const size_t start_i = tile_index_i_j.quotient * tile_i;
+			const size_t start_j = tile_index_i_j.remainder * tile_j;
+			task(argument, uarch_index, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
 		}
 	}
 
@@ -784,7 +1109,7 @@ static void thread_parallelize_3d_tile_1d_with_uarch_with_thread(struct pthreadp
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_3d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_3d_tile_2d_morton(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
@@ -793,46 +1118,43 @@ static void thread_parallelize_3d_tile_2d(struct pthreadpool* threadpool, struct
 
 	/* Process thread's own range of items */
 	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_2d.tile_range_k;
-	const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
-	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_3d_tile_2d.tile_range_j;
-	const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, tile_range_j);
-	const size_t tile_j = threadpool->params.parallelize_3d_tile_2d.tile_j;
-	const size_t tile_k = threadpool->params.parallelize_3d_tile_2d.tile_k;
-	size_t i = tile_index_i_j.quotient;
-	size_t start_j = tile_index_i_j.remainder * tile_j;
-	size_t start_k = tile_index_ij_k.remainder * tile_k;
-
-	const size_t range_k = threadpool->params.parallelize_3d_tile_2d.range_k;
-	const size_t range_j = threadpool->params.parallelize_3d_tile_2d.range_j;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+	const size_t tile_rows = threadpool->params.parallelize_nd.dims[1].tile_range.value;
+	const size_t tile_columns = threadpool->params.parallelize_nd.dims[2].tile_range.value;
+	const size_t plane_tiles = tile_rows * tile_columns;
+	const size_t tile_j = threadpool->params.parallelize_nd.dims[1].tile;
+	const size_t tile_k = threadpool->params.parallelize_nd.dims[2].tile;
+	size_t i = range_start / plane_tiles;
+	size_t plane_index = range_start % plane_tiles;
+
+	const size_t range_k = threadpool->params.parallelize_nd.dims[2].range;
+	const size_t range_j = threadpool->params.parallelize_nd.dims[1].range;
+	size_t batch = 0;
+	while (pthreadpool_claim_item(threadpool, thread, &batch)) {
+		size_t index_j, index_k;
+		morton_tile(plane_index, tile_rows, tile_columns, &index_j, &index_k);
+		const size_t start_j = index_j * tile_j;
+		const size_t start_k = index_k * tile_k;
 		task(argument, i, start_j, start_k, min(range_j - start_j, tile_j), min(range_k - start_k, tile_k));
-		start_k += tile_k;
-		if (start_k >= range_k) {
-			start_k = 0;
-			start_j += tile_j;
-			if (start_j >= range_j) {
-				start_j = 0;
-				i += 1;
-			}
+		if (++plane_index == plane_tiles) {
+			plane_index = 0;
+			i += 1;
 		}
 	}
 
 	/* There still may be other threads with work */
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(linear_index, tile_range_k);
-			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, tile_range_j);
-			const size_t start_j = tile_index_i_j.remainder * tile_j;
-			const size_t start_k = tile_index_ij_k.remainder * tile_k;
-			task(argument, tile_index_i_j.quotient, start_j, start_k, min(range_j - start_j, tile_j), min(range_k - start_k, tile_k));
+		size_t linear_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &linear_index)) {
+			size_t index_j, index_k;
+			morton_tile(linear_index % plane_tiles, tile_rows, tile_columns, &index_j, &index_k);
+			const size_t start_j = index_j * tile_j;
+			const size_t start_k = index_k * tile_k;
+			task(argument, linear_index / plane_tiles, start_j, start_k, min(range_j - start_j, tile_j), min(range_k - start_k, tile_k));
 		}
 	}
 
@@ -840,64 +1162,121 @@ static void thread_parallelize_3d_tile_2d(struct pthreadpool* threadpool, struct
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_3d_tile_2d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
-
-	const pthreadpool_task_3d_tile_2d_with_id_t task = (pthreadpool_task_3d_tile_2d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+/* Task of a computation over the tiles of a multi-dimensional range, and the arguments passed to it besides the tile */
+struct tile_task {
+	void* task;
+	void* argument;
+	uint32_t uarch_index;
+	size_t thread_number;
+};
+
+/* Start and size of a tile of a multi-dimensional range along every dimension */
+struct tile_position {
+	size_t start[PTHREADPOOL_MAX_DIMENSIONS];
+	size_t size[PTHREADPOOL_MAX_DIMENSIONS];
+};
+
+/* Calls the task of the computation for the specified tile */
+typedef void (*call_tile_task_t)(const struct tile_task* task, const struct tile_position* tile);
+
+/* Computes the start and the size of the tile with the specified linear index along every dimension */
+static inline void decompose_tile_index(
+	const struct pthreadpool_nd_params* params,
+	size_t num_dims,
+	size_t linear_index,
+	size_t* start,
+	size_t* size)
+{
+	for (size_t d = num_dims - 1; d != 0; d--) {
+		const struct fxdiv_result_size_t tile_index = fxdiv_divide_size_t(linear_index, params->dims[d].tile_range);
+		start[d] = tile_index.remainder * params->dims[d].tile;
+		size[d] = min(params->dims[d].range - start[d], params->dims[d].tile);
+		linear_index = tile_index.quotient;
+	}
+	start[0] = linear_index * params->dims[0].tile;
+	size[0] = min(params->dims[0].range - start[0], params->dims[0].tile);
+}
 
-	const uint32_t default_uarch_index = threadpool->params.parallelize_3d_tile_2d_with_uarch.default_uarch_index;
+/*
+ * Returns the microarchitecture index of the calling core, or the default index if it exceeds the maximum index passed
+ * to the parallelization function.
+ */
+static inline uint32_t get_tile_uarch_index(const struct pthreadpool* threadpool) {
+	const uint32_t default_uarch_index = threadpool->params.parallelize_nd.default_uarch_index;
 	uint32_t uarch_index = default_uarch_index;
 	#if PTHREADPOOL_USE_CPUINFO
 		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-		if (uarch_index > threadpool->params.parallelize_3d_tile_2d_with_uarch.max_uarch_index) {
+		if (uarch_index > threadpool->params.parallelize_nd.max_uarch_index) {
 			uarch_index = default_uarch_index;
 		}
 	#endif
+	return uarch_index;
+}
+
+/*
+ * Common implementation of the thread functions of the 3D-6D and N-dimensional computations. Items are the tiles of the
+ * range described by the pthreadpool_nd_params structure in row-major order, and call_task passes every tile to the
+ * task. Thread functions pass constant num_dims, fastpath, and call_task arguments, which lets the compiler unroll the
+ * loops over dimensions and inline the task call.
+ */
+static PTHREADPOOL_ALWAYS_INLINE void thread_parallelize_tiles(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread,
+	size_t num_dims,
+	bool fastpath,
+	uint32_t uarch_index,
+	call_tile_task_t call_task)
+{
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+	assert(num_dims != 0);
+
+	const struct tile_task task = {
+		.task = pthreadpool_load_relaxed_void_p(&threadpool->task),
+		.argument = pthreadpool_load_relaxed_void_p(&threadpool->argument),
+		.uarch_index = uarch_index,
+		.thread_number = thread->thread_number,
+	};
+	const struct pthreadpool_nd_params* params = &threadpool->params.parallelize_nd;
+	size_t range[PTHREADPOOL_MAX_DIMENSIONS];
+	size_t tile[PTHREADPOOL_MAX_DIMENSIONS];
+	for (size_t d = 0; d < num_dims; d++) {
+		range[d] = params->dims[d].range;
+		tile[d] = params->dims[d].tile;
+	}
 
 	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_2d_with_uarch.tile_range_k;
-	const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
-	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_3d_tile_2d_with_uarch.tile_range_j;
-	const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, tile_range_j);
-	const size_t tile_j = threadpool->params.parallelize_3d_tile_2d_with_uarch.tile_j;
-	const size_t tile_k = threadpool->params.parallelize_3d_tile_2d_with_uarch.tile_k;
-	size_t i = tile_index_i_j.quotient;
-	size_t start_j = tile_index_i_j.remainder * tile_j;
-	size_t start_k = tile_index_ij_k.remainder * tile_k;
+	struct tile_position position;
+	decompose_tile_index(params, num_dims, pthreadpool_load_relaxed_size_t(&thread->range_start), position.start, position.size);
+	size_t batch = 0;
+	while (fastpath ? pthreadpool_claim_item_fastpath(threadpool, thread, &batch) : pthreadpool_claim_item(threadpool, thread, &batch)) {
+		call_task(&task, &position);
+		advance_tile_index(num_dims, range, tile, position.start, position.size);
+	}
 
-	const size_t range_k = threadpool->params.parallelize_3d_tile_2d_with_uarch.range_k;
-	const size_t range_j = threadpool->params.parallelize_3d_tile_2d_with_uarch.range_j;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, uarch_index, i, start_j, start_k, min(range_j - start_j, tile_j), min(range_k - start_k, tile_k));
-		start_k += tile_k;
-		if (start_k >= range_k) {
-			start_k = 0;
-			start_j += tile_j;
-			if (start_j >= range_j) {
-				start_j = 0;
-				i += 1;
-			}
-		}
+	/* Start of the last tile along every dimension, where retreat_tile_index wraps around */
+	size_t last[PTHREADPOOL_MAX_DIMENSIONS];
+	for (size_t d = 0; d < num_dims; d++) {
+		last[d] = (params->dims[d].tile_range.value - 1) * tile[d];
 	}
+	size_t previous_index = 0;
 
 	/* There still may be other threads with work */
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
+	for (size_t tid = pthreadpool_first_victim(threadpool, thread);
 		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+		tid = pthreadpool_next_victim(threadpool, thread, tid))
 	{
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(linear_index, tile_range_k);
-			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, tile_range_j);
-			const size_t start_j = tile_index_i_j.remainder * tile_j;
-			const size_t start_k = tile_index_ij_k.remainder * tile_k;
-			task(argument, uarch_index, tile_index_i_j.quotient, start_j, start_k, min(range_j - start_j, tile_j), min(range_k - start_k, tile_k));
+		size_t linear_index;
+		while (pthreadpool_steal_item(threadpool, thread, other_thread, &linear_index)) {
+			if (linear_index + 1 == previous_index) {
+				retreat_tile_index(num_dims, range, last, tile, position.start, position.size);
+			} else {
+				decompose_tile_index(params, num_dims, linear_index, position.start, position.size);
+			}
+			previous_index = linear_index;
+			call_task(&task, &position);
 		}
 	}
 
@@ -905,683 +1284,387 @@ static void thread_parallelize_3d_tile_2d_with_uarch(struct pthreadpool* threadp
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_4d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+static inline void call_3d(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_3d_t) task->task)(task->argument, tile->start[0], tile->start[1], tile->start[2]);
+}
 
-	const pthreadpool_task_4d_t task = (pthreadpool_task_4d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+static void thread_parallelize_3d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, false, 0, call_3d);
+}
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t range_kl = threadpool->params.parallelize_4d.range_kl;
-	const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(range_start, range_kl);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_4d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
-	const struct fxdiv_divisor_size_t range_l = threadpool->params.parallelize_4d.range_l;
-	const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_k_l.quotient;
-	size_t l = index_k_l.remainder;
-
-	const size_t range_k = threadpool->params.parallelize_4d.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, l);
-		if (++l == range_l.value) {
-			l = 0;
-			if (++k == range_k) {
-				k = 0;
-				if (++j == range_j.value) {
-					j = 0;
-					i += 1;
-				}
-			}
-		}
-	}
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_3d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, true, 0, call_3d);
+}
+#endif
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(linear_index, range_kl);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
-			const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_k_l.quotient, index_k_l.remainder);
-		}
-	}
+static inline void call_3d_tile_1d(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_3d_tile_1d_t) task->task)(task->argument, tile->start[0], tile->start[1], tile->start[2], tile->size[2]);
+}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+static void thread_parallelize_3d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, false, 0, call_3d_tile_1d);
 }
 
-static void thread_parallelize_4d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_3d_tile_1d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, true, 0, call_3d_tile_1d);
+}
+#endif
 
-	const pthreadpool_task_4d_tile_1d_t task = (pthreadpool_task_4d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+static inline void call_3d_tile_1d_with_thread(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_3d_tile_1d_with_thread_t) task->task)(task->argument, task->thread_number, tile->start[0], tile->start[1], tile->start[2], tile->size[2]);
+}
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_kl = threadpool->params.parallelize_4d_tile_1d.tile_range_kl;
-	const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(range_start, tile_range_kl);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_4d_tile_1d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
-	const struct fxdiv_divisor_size_t tile_range_l = threadpool->params.parallelize_4d_tile_1d.tile_range_l;
-	const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
-	const size_t tile_l = threadpool->params.parallelize_4d_tile_1d.tile_l;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = tile_index_k_l.quotient;
-	size_t start_l = tile_index_k_l.remainder * tile_l;
-
-	const size_t range_k = threadpool->params.parallelize_4d_tile_1d.range_k;
-	const size_t range_l = threadpool->params.parallelize_4d_tile_1d.range_l;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, start_l, min(range_l - start_l, tile_l));
-		start_l += tile_l;
-		if (start_l >= range_l) {
-			start_l = 0;
-			if (++k == range_k) {
-				k = 0;
-				if (++j == range_j.value) {
-					j = 0;
-					i += 1;
-				}
-			}
-		}
-	}
+static void thread_parallelize_3d_tile_1d_with_thread(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, false, 0, call_3d_tile_1d_with_thread);
+}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(linear_index, tile_range_kl);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
-			const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
-			const size_t start_l = tile_index_k_l.remainder * tile_l;
-			task(argument, index_i_j.quotient, index_i_j.remainder, tile_index_k_l.quotient, start_l, min(range_l - start_l, tile_l));
-		}
-	}
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_3d_tile_1d_with_thread_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, true, 0, call_3d_tile_1d_with_thread);
+}
+#endif
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+static inline void call_3d_tile_1d_with_uarch(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_3d_tile_1d_with_id_t) task->task)(task->argument, task->uarch_index, tile->start[0], tile->start[1], tile->start[2], tile->size[2]);
 }
 
-static void thread_parallelize_4d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+static void thread_parallelize_3d_tile_1d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, false, get_tile_uarch_index(threadpool), call_3d_tile_1d_with_uarch);
+}
 
-	const pthreadpool_task_4d_tile_2d_t task = (pthreadpool_task_4d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_3d_tile_1d_with_uarch_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, true, get_tile_uarch_index(threadpool), call_3d_tile_1d_with_uarch);
+}
+#endif
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_kl = threadpool->params.parallelize_4d_tile_2d.tile_range_kl;
-	const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(range_start, tile_range_kl);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_4d_tile_2d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
-	const struct fxdiv_divisor_size_t tile_range_l = threadpool->params.parallelize_4d_tile_2d.tile_range_l;
-	const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
-	const size_t tile_k = threadpool->params.parallelize_4d_tile_2d.tile_k;
-	const size_t tile_l = threadpool->params.parallelize_4d_tile_2d.tile_l;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t start_k = tile_index_k_l.quotient * tile_k;
-	size_t start_l = tile_index_k_l.remainder * tile_l;
-
-	const size_t range_l = threadpool->params.parallelize_4d_tile_2d.range_l;
-	const size_t range_k = threadpool->params.parallelize_4d_tile_2d.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, start_k, start_l, min(range_k - start_k, tile_k), min(range_l - start_l, tile_l));
-		start_l += tile_l;
-		if (start_l >= range_l) {
-			start_l = 0;
-			start_k += tile_k;
-			if (start_k >= range_k) {
-				start_k = 0;
-				if (++j == range_j.value) {
-					j = 0;
-					i += 1;
-				}
-			}
-		}
-	}
+static inline void call_3d_tile_1d_with_uarch_with_thread(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_3d_tile_1d_with_id_with_thread_t) task->task)(task->argument, task->uarch_index, task->thread_number, tile->start[0], tile->start[1], tile->start[2], tile->size[2]);
+}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(linear_index, tile_range_kl);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
-			const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
-			const size_t start_k = tile_index_k_l.quotient * tile_k;
-			const size_t start_l = tile_index_k_l.remainder * tile_l;
-			task(argument, index_i_j.quotient, index_i_j.remainder, start_k, start_l, min(range_k - start_k, tile_k), min(range_l - start_l, tile_l));
-		}
-	}
+static void thread_parallelize_3d_tile_1d_with_uarch_with_thread(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, false, get_tile_uarch_index(threadpool), call_3d_tile_1d_with_uarch_with_thread);
+}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_3d_tile_1d_with_uarch_with_thread_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, true, get_tile_uarch_index(threadpool), call_3d_tile_1d_with_uarch_with_thread);
 }
+#endif
 
-static void thread_parallelize_4d_tile_2d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+static inline void call_3d_tile_2d(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_3d_tile_2d_t) task->task)(task->argument, tile->start[0], tile->start[1], tile->start[2], tile->size[1], tile->size[2]);
+}
 
-	const pthreadpool_task_4d_tile_2d_with_id_t task = (pthreadpool_task_4d_tile_2d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+static void thread_parallelize_3d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, false, 0, call_3d_tile_2d);
+}
 
-	const uint32_t default_uarch_index = threadpool->params.parallelize_4d_tile_2d_with_uarch.default_uarch_index;
-	uint32_t uarch_index = default_uarch_index;
-	#if PTHREADPOOL_USE_CPUINFO
-		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-		if (uarch_index > threadpool->params.parallelize_4d_tile_2d_with_uarch.max_uarch_index) {
-			uarch_index = default_uarch_index;
-		}
-	#endif
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_3d_tile_2d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, true, 0, call_3d_tile_2d);
+}
+#endif
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_kl = threadpool->params.parallelize_4d_tile_2d_with_uarch.tile_range_kl;
-	const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(range_start, tile_range_kl);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_4d_tile_2d_with_uarch.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
-	const struct fxdiv_divisor_size_t tile_range_l = threadpool->params.parallelize_4d_tile_2d_with_uarch.tile_range_l;
-	const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
-	const size_t tile_k = threadpool->params.parallelize_4d_tile_2d_with_uarch.tile_k;
-	const size_t tile_l = threadpool->params.parallelize_4d_tile_2d_with_uarch.tile_l;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t start_k = tile_index_k_l.quotient * tile_k;
-	size_t start_l = tile_index_k_l.remainder * tile_l;
-
-	const size_t range_l = threadpool->params.parallelize_4d_tile_2d_with_uarch.range_l;
-	const size_t range_k = threadpool->params.parallelize_4d_tile_2d_with_uarch.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, uarch_index, i, j, start_k, start_l, min(range_k - start_k, tile_k), min(range_l - start_l, tile_l));
-		start_l += tile_l;
-		if (start_l >= range_l) {
-			start_l = 0;
-			start_k += tile_k;
-			if (start_k >= range_k) {
-				start_k = 0;
-				if (++j == range_j.value) {
-					j = 0;
-					i += 1;
-				}
-			}
-		}
-	}
+static inline void call_3d_tile_2d_with_uarch(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_3d_tile_2d_with_id_t) task->task)(task->argument, task->uarch_index, tile->start[0], tile->start[1], tile->start[2], tile->size[1], tile->size[2]);
+}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(linear_index, tile_range_kl);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
-			const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
-			const size_t start_k = tile_index_k_l.quotient * tile_k;
-			const size_t start_l = tile_index_k_l.remainder * tile_l;
-			task(argument, uarch_index, index_i_j.quotient, index_i_j.remainder, start_k, start_l, min(range_k - start_k, tile_k), min(range_l - start_l, tile_l));
-		}
-	}
+static void thread_parallelize_3d_tile_2d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, false, get_tile_uarch_index(threadpool), call_3d_tile_2d_with_uarch);
+}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_3d_tile_2d_with_uarch_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, true, get_tile_uarch_index(threadpool), call_3d_tile_2d_with_uarch);
 }
+#endif
 
-static void thread_parallelize_5d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+static inline void call_4d(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_4d_t) task->task)(task->argument, tile->start[0], tile->start[1], tile->start[2], tile->start[3]);
+}
 
-	const pthreadpool_task_5d_t task = (pthreadpool_task_5d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+static void thread_parallelize_4d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 4, false, 0, call_4d);
+}
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t range_lm = threadpool->params.parallelize_5d.range_lm;
-	const struct fxdiv_result_size_t index_ijk_lm = fxdiv_divide_size_t(range_start, range_lm);
-	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_5d.range_k;
-	const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(index_ijk_lm.quotient, range_k);
-	const struct fxdiv_divisor_size_t range_m = threadpool->params.parallelize_5d.range_m;
-	const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(index_ijk_lm.remainder, range_m);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_5d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_ij_k.remainder;
-	size_t l = index_l_m.quotient;
-	size_t m = index_l_m.remainder;
-
-	const size_t range_l = threadpool->params.parallelize_5d.range_l;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, l, m);
-		if (++m == range_m.value) {
-			m = 0;
-			if (++l == range_l) {
-				l = 0;
-				if (++k == range_k.value) {
-					k = 0;
-					if (++j == range_j.value) {
-						j = 0;
-						i += 1;
-					}
-				}
-			}
-		}
-	}
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_4d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 4, true, 0, call_4d);
+}
+#endif
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t index_ijk_lm = fxdiv_divide_size_t(linear_index, range_lm);
-			const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(index_ijk_lm.quotient, range_k);
-			const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(index_ijk_lm.remainder, range_m);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_ij_k.remainder, index_l_m.quotient, index_l_m.remainder);
-		}
-	}
+static inline void call_4d_tile_1d(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_4d_tile_1d_t) task->task)(task->argument, tile->start[0], tile->start[1], tile->start[2], tile->start[3], tile->size[3]);
+}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+static void thread_parallelize_4d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 4, false, 0, call_4d_tile_1d);
 }
 
-static void thread_parallelize_5d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_4d_tile_1d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 4, true, 0, call_4d_tile_1d);
+}
+#endif
 
-	const pthreadpool_task_5d_tile_1d_t task = (pthreadpool_task_5d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+static inline void call_4d_tile_2d(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_4d_tile_2d_t) task->task)(task->argument, tile->start[0], tile->start[1], tile->start[2], tile->start[3], tile->size[2], tile->size[3]);
+}
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_m = threadpool->params.parallelize_5d_tile_1d.tile_range_m;
-	const struct fxdiv_result_size_t tile_index_ijkl_m = fxdiv_divide_size_t(range_start, tile_range_m);
-	const struct fxdiv_divisor_size_t range_kl = threadpool->params.parallelize_5d_tile_1d.range_kl;
-	const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(tile_index_ijkl_m.quotient, range_kl);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_5d_tile_1d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
-	const struct fxdiv_divisor_size_t range_l = threadpool->params.parallelize_5d_tile_1d.range_l;
-	const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
-	const size_t tile_m = threadpool->params.parallelize_5d_tile_1d.tile_m;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_k_l.quotient;
-	size_t l = index_k_l.remainder;
-	size_t start_m = tile_index_ijkl_m.remainder * tile_m;
-
-	const size_t range_m = threadpool->params.parallelize_5d_tile_1d.range_m;
-	const size_t range_k = threadpool->params.parallelize_5d_tile_1d.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, l, start_m, min(range_m - start_m, tile_m));
-		start_m += tile_m;
-		if (start_m >= range_m) {
-			start_m = 0;
-			if (++l == range_l.value) {
-				l = 0;
-				if (++k == range_k) {
-					k = 0;
-					if (++j == range_j.value) {
-						j = 0;
-						i += 1;
-					}
-				}
-			}
-		}
-	}
+static void thread_parallelize_4d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 4, false, 0, call_4d_tile_2d);
+}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ijkl_m = fxdiv_divide_size_t(linear_index, tile_range_m);
-			const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(tile_index_ijkl_m.quotient, range_kl);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
-			const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
-			size_t start_m = tile_index_ijkl_m.remainder * tile_m;
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_k_l.quotient, index_k_l.remainder, start_m,
-				min(range_m - start_m, tile_m));
-		}
-	}
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_4d_tile_2d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 4, true, 0, call_4d_tile_2d);
+}
+#endif
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+static inline void call_4d_tile_2d_with_uarch(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_4d_tile_2d_with_id_t) task->task)(task->argument, task->uarch_index, tile->start[0], tile->start[1], tile->start[2], tile->start[3], tile->size[2], tile->size[3]);
 }
 
-static void thread_parallelize_5d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+static void thread_parallelize_4d_tile_2d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 4, false, get_tile_uarch_index(threadpool), call_4d_tile_2d_with_uarch);
+}
 
-	const pthreadpool_task_5d_tile_2d_t task = (pthreadpool_task_5d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_4d_tile_2d_with_uarch_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 4, true, get_tile_uarch_index(threadpool), call_4d_tile_2d_with_uarch);
+}
+#endif
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_lm = threadpool->params.parallelize_5d_tile_2d.tile_range_lm;
-	const struct fxdiv_result_size_t tile_index_ijk_lm = fxdiv_divide_size_t(range_start, tile_range_lm);
-	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_5d_tile_2d.range_k;
-	const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(tile_index_ijk_lm.quotient, range_k);
-	const struct fxdiv_divisor_size_t tile_range_m = threadpool->params.parallelize_5d_tile_2d.tile_range_m;
-	const struct fxdiv_result_size_t tile_index_l_m = fxdiv_divide_size_t(tile_index_ijk_lm.remainder, tile_range_m);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_5d_tile_2d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-	const size_t tile_l = threadpool->params.parallelize_5d_tile_2d.tile_l;
-	const size_t tile_m = threadpool->params.parallelize_5d_tile_2d.tile_m;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_ij_k.remainder;
-	size_t start_l = tile_index_l_m.quotient * tile_l;
-	size_t start_m = tile_index_l_m.remainder * tile_m;
-
-	const size_t range_m = threadpool->params.parallelize_5d_tile_2d.range_m;
-	const size_t range_l = threadpool->params.parallelize_5d_tile_2d.range_l;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, start_l, start_m, min(range_l - start_l, tile_l), min(range_m - start_m, tile_m));
-		start_m += tile_m;
-		if (start_m >= range_m) {
-			start_m = 0;
-			start_l += tile_l;
-			if (start_l >= range_l) {
-				start_l = 0;
-				if (++k == range_k.value) {
-					k = 0;
-					if (++j == range_j.value) {
-						j = 0;
-						i += 1;
-					}
-				}
-			}
-		}
-	}
+static inline void call_5d(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_5d_t) task->task)(task->argument, tile->start[0], tile->start[1], tile->start[2], tile->start[3], tile->start[4]);
+}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ijk_lm = fxdiv_divide_size_t(linear_index, tile_range_lm);
-			const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(tile_index_ijk_lm.quotient, range_k);
-			const struct fxdiv_result_size_t tile_index_l_m = fxdiv_divide_size_t(tile_index_ijk_lm.remainder, tile_range_m);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-			const size_t start_l = tile_index_l_m.quotient * tile_l;
-			const size_t start_m = tile_index_l_m.remainder * tile_m;
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_ij_k.remainder,
-				start_l, start_m, min(range_l - start_l, tile_l), min(range_m - start_m, tile_m));
-		}
-	}
+static void thread_parallelize_5d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 5, false, 0, call_5d);
+}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_5d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 5, true, 0, call_5d);
 }
+#endif
 
-static void thread_parallelize_6d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+static inline void call_5d_tile_1d(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_5d_tile_1d_t) task->task)(task->argument, tile->start[0], tile->start[1], tile->start[2], tile->start[3], tile->start[4], tile->size[4]);
+}
 
-	const pthreadpool_task_6d_t task = (pthreadpool_task_6d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+static void thread_parallelize_5d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 5, false, 0, call_5d_tile_1d);
+}
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t range_lmn = threadpool->params.parallelize_6d.range_lmn;
-	const struct fxdiv_result_size_t index_ijk_lmn = fxdiv_divide_size_t(range_start, range_lmn);
-	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_6d.range_k;
-	const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(index_ijk_lmn.quotient, range_k);
-	const struct fxdiv_divisor_size_t range_n = threadpool->params.parallelize_6d.range_n;
-	const struct fxdiv_result_size_t index_lm_n = fxdiv_divide_size_t(index_ijk_lmn.remainder, range_n);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_6d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-	const struct fxdiv_divisor_size_t range_m = threadpool->params.parallelize_6d.range_m;
-	const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(index_lm_n.quotient, range_m);
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_ij_k.remainder;
-	size_t l = index_l_m.quotient;
-	size_t m = index_l_m.remainder;
-	size_t n = index_lm_n.remainder;
-
-	const size_t range_l = threadpool->params.parallelize_6d.range_l;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, l, m, n);
-		if (++n == range_n.value) {
-			n = 0;
-			if (++m == range_m.value) {
-				m = 0;
-				if (++l == range_l) {
-					l = 0;
-					if (++k == range_k.value) {
-						k = 0;
-						if (++j == range_j.value) {
-							j = 0;
-							i += 1;
-						}
-					}
-				}
-			}
-		}
-	}
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_5d_tile_1d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 5, true, 0, call_5d_tile_1d);
+}
+#endif
 
+static inline void call_5d_tile_2d(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_5d_tile_2d_t) task->task)(task->argument, tile->start[0], tile->start[1], tile->start[2], tile->start[3], tile->start[4], tile->size[3], tile->size[4]);
+}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t index_ijk_lmn = fxdiv_divide_size_t(linear_index, range_lmn);
-			const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(index_ijk_lmn.quotient, range_k);
-			const struct fxdiv_result_size_t index_lm_n = fxdiv_divide_size_t(index_ijk_lmn.remainder, range_n);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-			const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(index_lm_n.quotient, range_m);
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_ij_k.remainder, index_l_m.quotient, index_l_m.remainder, index_lm_n.remainder);
-		}
-	}
+static void thread_parallelize_5d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 5, false, 0, call_5d_tile_2d);
+}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_5d_tile_2d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 5, true, 0, call_5d_tile_2d);
 }
+#endif
 
-static void thread_parallelize_6d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+static inline void call_6d(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_6d_t) task->task)(task->argument, tile->start[0], tile->start[1], tile->start[2], tile->start[3], tile->start[4], tile->start[5]);
+}
 
-	const pthreadpool_task_6d_tile_1d_t task = (pthreadpool_task_6d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+static void thread_parallelize_6d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 6, false, 0, call_6d);
+}
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_lmn = threadpool->params.parallelize_6d_tile_1d.tile_range_lmn;
-	const struct fxdiv_result_size_t tile_index_ijk_lmn = fxdiv_divide_size_t(range_start, tile_range_lmn);
-	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_6d_tile_1d.range_k;
-	const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(tile_index_ijk_lmn.quotient, range_k);
-	const struct fxdiv_divisor_size_t tile_range_n = threadpool->params.parallelize_6d_tile_1d.tile_range_n;
-	const struct fxdiv_result_size_t tile_index_lm_n = fxdiv_divide_size_t(tile_index_ijk_lmn.remainder, tile_range_n);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_6d_tile_1d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-	const struct fxdiv_divisor_size_t range_m = threadpool->params.parallelize_6d_tile_1d.range_m;
-	const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(tile_index_lm_n.quotient, range_m);
-	const size_t tile_n = threadpool->params.parallelize_6d_tile_1d.tile_n;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_ij_k.remainder;
-	size_t l = index_l_m.quotient;
-	size_t m = index_l_m.remainder;
-	size_t start_n = tile_index_lm_n.remainder * tile_n;
-
-	const size_t range_n = threadpool->params.parallelize_6d_tile_1d.range_n;
-	const size_t range_l = threadpool->params.parallelize_6d_tile_1d.range_l;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, l, m, start_n, min(range_n - start_n, tile_n));
-		start_n += tile_n;
-		if (start_n >= range_n) {
-			start_n = 0;
-			if (++m == range_m.value) {
-				m = 0;
-				if (++l == range_l) {
-					l = 0;
-					if (++k == range_k.value) {
-						k = 0;
-						if (++j == range_j.value) {
-							j = 0;
-							i += 1;
-						}
-					}
-				}
-			}
-		}
-	}
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_6d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 6, true, 0, call_6d);
+}
+#endif
 
+static inline void call_6d_tile_1d(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_6d_tile_1d_t) task->task)(task->argument, tile->start[0], tile->start[1], tile->start[2], tile->start[3], tile->start[4], tile->start[5], tile->size[5]);
+}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ijk_lmn = fxdiv_divide_size_t(linear_index, tile_range_lmn);
-			const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(tile_index_ijk_lmn.quotient, range_k);
-			const struct fxdiv_result_size_t tile_index_lm_n = fxdiv_divide_size_t(tile_index_ijk_lmn.remainder, tile_range_n);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-			const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(tile_index_lm_n.quotient, range_m);
-			const size_t start_n = tile_index_lm_n.remainder * tile_n;
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_ij_k.remainder, index_l_m.quotient, index_l_m.remainder,
-				start_n, min(range_n - start_n, tile_n));
-		}
-	}
+static void thread_parallelize_6d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 6, false, 0, call_6d_tile_1d);
+}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_6d_tile_1d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 6, true, 0, call_6d_tile_1d);
+}
+#endif
+
+static inline void call_6d_tile_2d(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_6d_tile_2d_t) task->task)(task->argument, tile->start[0], tile->start[1], tile->start[2], tile->start[3], tile->start[4], tile->start[5], tile->size[4], tile->size[5]);
 }
 
 static void thread_parallelize_6d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+	thread_parallelize_tiles(threadpool, thread, 6, false, 0, call_6d_tile_2d);
+}
 
-	const pthreadpool_task_6d_tile_2d_t task = (pthreadpool_task_6d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_6d_tile_2d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 6, true, 0, call_6d_tile_2d);
+}
+#endif
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_mn = threadpool->params.parallelize_6d_tile_2d.tile_range_mn;
-	const struct fxdiv_result_size_t tile_index_ijkl_mn = fxdiv_divide_size_t(range_start, tile_range_mn);
-	const struct fxdiv_divisor_size_t range_kl = threadpool->params.parallelize_6d_tile_2d.range_kl;
-	const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(tile_index_ijkl_mn.quotient, range_kl);
-	const struct fxdiv_divisor_size_t tile_range_n = threadpool->params.parallelize_6d_tile_2d.tile_range_n;
-	const struct fxdiv_result_size_t tile_index_m_n = fxdiv_divide_size_t(tile_index_ijkl_mn.remainder, tile_range_n);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_6d_tile_2d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
-	const struct fxdiv_divisor_size_t range_l = threadpool->params.parallelize_6d_tile_2d.range_l;
-	const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
-	const size_t tile_m = threadpool->params.parallelize_6d_tile_2d.tile_m;
-	const size_t tile_n = threadpool->params.parallelize_6d_tile_2d.tile_n;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_k_l.quotient;
-	size_t l = index_k_l.remainder;
-	size_t start_m = tile_index_m_n.quotient * tile_m;
-	size_t start_n = tile_index_m_n.remainder * tile_n;
-
-	const size_t range_n = threadpool->params.parallelize_6d_tile_2d.range_n;
-	const size_t range_m = threadpool->params.parallelize_6d_tile_2d.range_m;
-	const size_t range_k = threadpool->params.parallelize_6d_tile_2d.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, l, start_m, start_n, min(range_m - start_m, tile_m), min(range_n - start_n, tile_n));
-		start_n += tile_n;
-		if (start_n >= range_n) {
-			start_n = 0;
-			start_m += tile_m;
-			if (start_m >= range_m) {
-				start_m = 0;
-				if (++l == range_l.value) {
-					l = 0;
-					if (++k == range_k) {
-						k = 0;
-						if (++j == range_j.value) {
-							j = 0;
-							i += 1;
-						}
-					}
-				}
-			}
+static inline void call_nd(const struct tile_task* task, const struct tile_position* tile) {
+	((pthreadpool_task_nd_t) task->task)(task->argument, tile->start, tile->size);
+}
+
+static void thread_parallelize_nd(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, threadpool->params.parallelize_nd.num_dims, false, 0, call_nd);
+}
+
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_nd_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, threadpool->params.parallelize_nd.num_dims, true, 0, call_nd);
+}
+#endif
+
+static void thread_parallelize_nd_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 1, false, 0, call_nd);
+}
+
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_nd_1d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 1, true, 0, call_nd);
+}
+#endif
+
+static void thread_parallelize_nd_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 2, false, 0, call_nd);
+}
+
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_nd_2d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 2, true, 0, call_nd);
+}
+#endif
+
+static void thread_parallelize_nd_3d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, false, 0, call_nd);
+}
+
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_nd_3d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 3, true, 0, call_nd);
+}
+#endif
+
+static void thread_parallelize_nd_4d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 4, false, 0, call_nd);
+}
+
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_nd_4d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 4, true, 0, call_nd);
+}
+#endif
+
+static void thread_parallelize_nd_5d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 5, false, 0, call_nd);
+}
+
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_nd_5d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 5, true, 0, call_nd);
+}
+#endif
+
+static void thread_parallelize_nd_6d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 6, false, 0, call_nd);
+}
+
+#if PTHREADPOOL_USE_FASTPATH
+static void thread_parallelize_nd_6d_fastpath(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_tiles(threadpool, thread, 6, true, 0, call_nd);
+}
+#endif
+
+/* Moves the index along the outer dimensions of an N-dimensional range computation to the next row */
+static inline void advance_row_index(const struct pthreadpool_nd_params* outer, size_t* index) {
+	for (size_t d = outer->num_dims; d != 0; d--) {
+		if (++index[d - 1] != outer->dims[d - 1].range) {
+			return;
 		}
+		index[d - 1] = 0;
 	}
+}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ijkl_mn = fxdiv_divide_size_t(linear_index, tile_range_mn);
-			const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(tile_index_ijkl_mn.quotient, range_kl);
-			const struct fxdiv_result_size_t tile_index_m_n = fxdiv_divide_size_t(tile_index_ijkl_mn.remainder, tile_range_n);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
-			const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
-			const size_t start_m = tile_index_m_n.quotient * tile_m;
-			const size_t start_n = tile_index_m_n.remainder * tile_n;
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_k_l.quotient, index_k_l.remainder,
-				start_m, start_n, min(range_m - start_m, tile_m), min(range_n - start_n, tile_n));
+/* Splits the run at the boundaries of rows along the last dimension */
+static inline void call_nd_range(
+	void* task,
+	void* argument,
+	const union pthreadpool_params* params,
+	size_t start,
+	size_t count)
+{
+	const struct pthreadpool_nd_range_params* nd_range = &params->parallelize_nd_range;
+	const struct fxdiv_result_size_t row_chunk = fxdiv_divide_size_t(start, nd_range->aligned_range);
+	size_t index[PTHREADPOOL_MAX_DIMENSIONS];
+	size_t size[PTHREADPOOL_MAX_DIMENSIONS];
+	if (nd_range->outer.num_dims != 0) {
+		decompose_tile_index(&nd_range->outer, nd_range->outer.num_dims, row_chunk.quotient, index, size);
+	}
+	size_t chunk = row_chunk.remainder;
+	while (count != 0) {
+		const size_t row_count = min(count, nd_range->aligned_range.value - chunk);
+		((pthreadpool_task_nd_range_t) task)(argument, index,
+			chunk * nd_range->alignment, min((chunk + row_count) * nd_range->alignment, nd_range->range));
+		count -= row_count;
+		chunk = 0;
+		if (count != 0) {
+			advance_row_index(&nd_range->outer, index);
 		}
 	}
+}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+static void thread_parallelize_nd_range(struct pthreadpool* threadpool, struct thread_info* thread) {
+	thread_parallelize_runs(threadpool, thread, call_nd_range);
+}
+
+/* Returns the size of the leading part of the pthreadpool_nd_params structure used by a computation */
+static inline size_t get_nd_params_size(size_t num_dims) {
+	return offsetof(struct pthreadpool_nd_params, dims) + num_dims * sizeof(struct pthreadpool_nd_dimension);
+}
+
+/*
+ * Initializes the parameters of a computation over the tiles of a multi-dimensional range, and returns the number of
+ * tiles. If tile is NULL, every tile is a single item.
+ */
+static inline size_t init_nd_params(
+	struct pthreadpool_nd_params* params,
+	size_t num_dims,
+	const size_t* range,
+	const size_t* tile)
+{
+	/* Padding bytes are zeroed too, as PTHREADPOOL_FLAG_ADAPTIVE_PARTITION hashes the parameters */
+	memset(params, 0, get_nd_params_size(num_dims));
+	params->num_dims = num_dims;
+	size_t tile_range = 1;
+	for (size_t d = 0; d < num_dims; d++) {
+		params->dims[d].range = range[d];
+		params->dims[d].tile = tile != NULL ? tile[d] : 1;
+		const size_t dim_tile_range = divide_round_up(params->dims[d].range, params->dims[d].tile);
+		params->dims[d].tile_range = fxdiv_init_size_t(dim_tile_range);
+		tile_range *= dim_tile_range;
+	}
+	return tile_range;
 }
 
 void pthreadpool_parallelize_1d(
@@ -1591,6 +1674,8 @@ void pthreadpool_parallelize_1d(
 	size_t range,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -1619,381 +1704,1076 @@ void pthreadpool_parallelize_1d(
 	}
 }
 
-void pthreadpool_parallelize_1d_with_thread(
-	struct pthreadpool* threadpool,
-	pthreadpool_task_1d_with_thread_t task,
+pthreadpool_job_t pthreadpool_parallelize_1d_async(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
+		pthreadpool_parallelize_1d(threadpool, task, argument, range, flags);
+		return NULL;
+	}
+
+	thread_function_t parallelize_1d = &thread_parallelize_1d;
+	#if PTHREADPOOL_USE_FASTPATH
+		const size_t range_threshold = -threads_count;
+		if (range < range_threshold) {
+			parallelize_1d = &pthreadpool_thread_parallelize_1d_fastpath;
+		}
+	#endif
+	return pthreadpool_parallelize_async(
+		threadpool, parallelize_1d, NULL, 0,
+		(void*) task, argument, range, flags);
+}
+
+size_t pthreadpool_graph_add_1d(
+	pthreadpool_graph_t graph,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags)
+{
+	return pthreadpool_graph_add_node(
+		graph, &thread_parallelize_1d, NULL, 0,
+		(void*) task, argument, range, flags);
+}
+
+void pthreadpool_parallelize_1d_weighted(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	const size_t* cumulative_weights,
+	size_t range,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range; i++) {
+			task(argument, i);
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		/* Items are processed as in pthreadpool_parallelize_1d, only the split of items between threads differs */
+		thread_function_t parallelize_1d = &thread_parallelize_1d;
+		#if PTHREADPOOL_USE_FASTPATH
+			const size_t range_threshold = -threads_count;
+			if (range < range_threshold) {
+				parallelize_1d = &pthreadpool_thread_parallelize_1d_fastpath;
+			}
+		#endif
+		const struct pthreadpool_1d_weighted_params params = {
+			.cumulative_weights = cumulative_weights,
+		};
+		pthreadpool_parallelize(
+			threadpool, parallelize_1d, &params, sizeof(params),
+			(void*) task, argument, range, flags | PTHREADPOOL_FLAG_WEIGHTED_ITEMS);
+	}
+}
+
+void pthreadpool_parallelize_1d_with_thread(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_with_thread_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range; i++) {
+			task(argument, 0, i);
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		thread_function_t parallelize_1d_with_thread = &thread_parallelize_1d_with_thread;
+		#if PTHREADPOOL_USE_FASTPATH
+			const size_t range_threshold = -threads_count;
+			if (range < range_threshold) {
+				parallelize_1d_with_thread = &pthreadpool_thread_parallelize_1d_with_thread_fastpath;
+			}
+		#endif
+		pthreadpool_parallelize(
+			threadpool, parallelize_1d_with_thread, NULL, 0,
+			(void*) task, argument, range, flags);
+	}
+}
+
+void pthreadpool_parallelize_1d_with_uarch(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_with_id_t task,
+	void* argument,
+	uint32_t default_uarch_index,
+	uint32_t max_uarch_index,
+	size_t range,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+
+		uint32_t uarch_index = default_uarch_index;
+		#if PTHREADPOOL_USE_CPUINFO
+			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+			if (uarch_index > max_uarch_index) {
+				uarch_index = default_uarch_index;
+			}
+		#endif
+
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range; i++) {
+			task(argument, uarch_index, i);
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		const struct pthreadpool_1d_with_uarch_params params = {
+			.default_uarch_index = default_uarch_index,
+			.max_uarch_index = max_uarch_index,
+		};
+		thread_function_t parallelize_1d_with_uarch = &thread_parallelize_1d_with_uarch;
+		#if PTHREADPOOL_USE_FASTPATH
+			const size_t range_threshold = -threads_count;
+			if (range < range_threshold) {
+				parallelize_1d_with_uarch = &pthreadpool_thread_parallelize_1d_with_uarch_fastpath;
+			}
+		#endif
+		pthreadpool_parallelize(
+			threadpool, parallelize_1d_with_uarch, &params, sizeof(params),
+			task, argument, range, flags);
+	}
+}
+
+void pthreadpool_parallelize_1d_tile_1d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_tile_1d_t task,
+	void* argument,
+	size_t range,
+	size_t tile,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= tile) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range; i += tile) {
+			task(argument, i, min(range - i, tile));
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		const size_t tile_range = divide_round_up(range, tile);
+		const struct pthreadpool_1d_tile_1d_params params = {
+			.range = range,
+			.tile = tile,
+		};
+		thread_function_t parallelize_1d_tile_1d = &thread_parallelize_1d_tile_1d;
+		#if PTHREADPOOL_USE_FASTPATH
+			const size_t range_threshold = -threads_count;
+			if (range < range_threshold) {
+				parallelize_1d_tile_1d = &pthreadpool_thread_parallelize_1d_tile_1d_fastpath;
+			}
+		#endif
+		pthreadpool_parallelize(
+			threadpool, parallelize_1d_tile_1d, &params, sizeof(params),
+			task, argument, tile_range, flags);
+	}
+}
+
+size_t pthreadpool_graph_add_1d_tile_1d(
+	pthreadpool_graph_t graph,
+	pthreadpool_task_1d_tile_1d_t task,
+	void* argument,
+	size_t range,
+	size_t tile,
+	uint32_t flags)
+{
+	const size_t tile_range = divide_round_up(range, tile);
+	const struct pthreadpool_1d_tile_1d_params params = {
+		.range = range,
+		.tile = tile,
+	};
+	return pthreadpool_graph_add_node(
+		graph, &thread_parallelize_1d_tile_1d, &params, sizeof(params),
+		task, argument, tile_range, flags);
+}
+
+void pthreadpool_parallelize_1d_tile_1d_pipeline(
+	pthreadpool_t threadpool,
+	const pthreadpool_task_1d_tile_1d_t* stages,
+	size_t stages_count,
+	void* argument,
+	size_t range,
+	size_t tile,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	if (stages_count == 0) {
+		return;
+	}
+
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= tile) {
+		/* No thread pool used: execute stages sequentially on the calling thread, tile by tile */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range; i += tile) {
+			process_pipeline_tile(stages, stages_count, argument, i, min(range - i, tile));
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		const size_t tile_range = divide_round_up(range, tile);
+		const struct pthreadpool_1d_tile_1d_pipeline_params params = {
+			.range = range,
+			.tile = tile,
+			.stages = stages,
+			.stages_count = stages_count,
+		};
+		/* Stages are passed in the parameters: the first one stands for the task of the computation */
+		pthreadpool_parallelize(
+			threadpool, &thread_parallelize_1d_tile_1d_pipeline, &params, sizeof(params),
+			(void*) stages[0], argument, tile_range, flags);
+	}
+}
+
+static void parallelize_1d_indexed(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	const void* indices,
+	bool u32_indices,
+	size_t count,
+	uint32_t flags)
+{
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || count <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t p = 0; p < count; p++) {
+			task(argument, load_index(indices, u32_indices, p));
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		const struct pthreadpool_1d_indexed_params params = {
+			.indices = indices,
+			.u32_indices = u32_indices,
+		};
+		pthreadpool_parallelize(
+			threadpool, &thread_parallelize_1d_indexed, &params, sizeof(params),
+			(void*) task, argument, count, flags);
+	}
+}
+
+void pthreadpool_parallelize_1d_range(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_range_t task,
+	void* argument,
+	size_t range,
+	size_t alignment,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	size_t threads_count;
+	if (alignment == 0) {
+		alignment = 1;
+	}
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= alignment) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		if (range != 0) {
+			task(argument, 0, range);
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		const size_t aligned_range = divide_round_up(range, alignment);
+		const struct pthreadpool_1d_range_params params = {
+			.range = range,
+			.alignment = alignment,
+		};
+		/* Chunks are reserved in shrinking batches, and each batch is passed to the task as a single run */
+		pthreadpool_parallelize(
+			threadpool, &thread_parallelize_1d_range, &params, sizeof(params),
+			(void*) task, argument, aligned_range, flags | PTHREADPOOL_FLAG_BATCH_CLAIMS);
+	}
+}
+
+void pthreadpool_parallelize_1d_indexed(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	const size_t* indices,
+	size_t count,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	parallelize_1d_indexed(threadpool, task, argument, indices, false, count, flags);
+}
+
+void pthreadpool_parallelize_1d_indexed_u32(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	const uint32_t* indices,
+	size_t count,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	parallelize_1d_indexed(threadpool, task, argument, indices, true, count, flags);
+}
+
+static void parallelize_1d_indexed_tile_1d(
+	pthreadpool_t threadpool,
+	void* task,
+	void* argument,
+	const void* indices,
+	bool u32_indices,
+	size_t count,
+	size_t tile,
+	uint32_t flags)
+{
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || count <= tile) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t p = 0; p < count; p += tile) {
+			call_indexed_tile_1d(task, argument, indices, u32_indices, p, min(count - p, tile));
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		const size_t tile_range = divide_round_up(count, tile);
+		const struct pthreadpool_1d_indexed_tile_1d_params params = {
+			.indices = indices,
+			.u32_indices = u32_indices,
+			.count = count,
+			.tile = tile,
+		};
+		pthreadpool_parallelize(
+			threadpool, &thread_parallelize_1d_indexed_tile_1d, &params, sizeof(params),
+			task, argument, tile_range, flags);
+	}
+}
+
+void pthreadpool_parallelize_1d_indexed_tile_1d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_indexed_tile_1d_t task,
+	void* argument,
+	const size_t* indices,
+	size_t count,
+	size_t tile,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	parallelize_1d_indexed_tile_1d(threadpool, (void*) task, argument, indices, false, count, tile, flags);
+}
+
+void pthreadpool_parallelize_1d_indexed_u32_tile_1d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_indexed_u32_tile_1d_t task,
+	void* argument,
+	const uint32_t* indices,
+	size_t count,
+	size_t tile,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	parallelize_1d_indexed_tile_1d(threadpool, (void*) task, argument, indices, true, count, tile, flags);
+}
+
+void pthreadpool_parallelize_ragged_2d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_ragged_2d_t task,
+	void* argument,
+	const size_t* row_offsets,
+	size_t rows,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	const size_t range = rows == 0 ? 0 : row_offsets[rows] - row_offsets[0];
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < rows; i++) {
+			const size_t row_length = row_offsets[i + 1] - row_offsets[i];
+			for (size_t k = 0; k < row_length; k++) {
+				task(argument, i, k);
+			}
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		const struct pthreadpool_ragged_2d_params params = {
+			.row_offsets = row_offsets,
+			.rows = rows,
+		};
+		pthreadpool_parallelize(
+			threadpool, &thread_parallelize_ragged_2d, &params, sizeof(params),
+			task, argument, range, flags);
+	}
+}
+
+void pthreadpool_parallelize_ragged_2d_tile_1d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_ragged_2d_tile_1d_t task,
+	void* argument,
+	const size_t* row_offsets,
+	size_t rows,
+	size_t tile,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	const size_t range = rows == 0 ? 0 : row_offsets[rows] - row_offsets[0];
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= tile) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		size_t i = 0;
+		for (size_t tile_start = 0; tile_start < range; tile_start += tile) {
+			i = process_ragged_tile(task, argument, row_offsets, i, row_offsets[0] + tile_start, min(range - tile_start, tile));
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		const size_t tile_range = divide_round_up(range, tile);
+		const struct pthreadpool_ragged_2d_tile_1d_params params = {
+			.row_offsets = row_offsets,
+			.rows = rows,
+			.range = range,
+			.tile = tile,
+		};
+		pthreadpool_parallelize(
+			threadpool, &thread_parallelize_ragged_2d_tile_1d, &params, sizeof(params),
+			task, argument, tile_range, flags);
+	}
+}
+
+void pthreadpool_parallelize_2d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j) <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range_i; i++) {
+			for (size_t j = 0; j < range_j; j++) {
+				task(argument, i, j);
+			}
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		const size_t range = range_i * range_j;
+		const struct pthreadpool_2d_params params = {
+			.range_j = fxdiv_init_size_t(range_j),
+		};
+		thread_function_t parallelize_2d = &thread_parallelize_2d;
+		#if PTHREADPOOL_USE_FASTPATH
+			const size_t range_threshold = -threads_count;
+			if (range < range_threshold) {
+				parallelize_2d = &pthreadpool_thread_parallelize_2d_fastpath;
+			}
+		#endif
+		pthreadpool_parallelize(
+			threadpool, parallelize_2d, &params, sizeof(params),
+			task, argument, range, flags);
+	}
+}
+
+pthreadpool_job_t pthreadpool_parallelize_2d_async(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_t task,
 	void* argument,
-	size_t range,
+	size_t range_i,
+	size_t range_j,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j) <= 1) {
+		pthreadpool_parallelize_2d(threadpool, task, argument, range_i, range_j, flags);
+		return NULL;
+	}
+
+	const size_t range = range_i * range_j;
+	const struct pthreadpool_2d_params params = {
+		.range_j = fxdiv_init_size_t(range_j),
+	};
+	thread_function_t parallelize_2d = &thread_parallelize_2d;
+	#if PTHREADPOOL_USE_FASTPATH
+		const size_t range_threshold = -threads_count;
+		if (range < range_threshold) {
+			parallelize_2d = &pthreadpool_thread_parallelize_2d_fastpath;
+		}
+	#endif
+	return pthreadpool_parallelize_async(
+		threadpool, parallelize_2d, &params, sizeof(params),
+		task, argument, range, flags);
+}
+
+size_t pthreadpool_graph_add_2d(
+	pthreadpool_graph_t graph,
+	pthreadpool_task_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags)
+{
+	const struct pthreadpool_2d_params params = {
+		.range_j = fxdiv_init_size_t(range_j),
+	};
+	return pthreadpool_graph_add_node(
+		graph, &thread_parallelize_2d, &params, sizeof(params),
+		task, argument, range_i * range_j, flags);
+}
+
+void pthreadpool_parallelize_2d_with_thread(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_with_thread_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j) <= 1) {
 		/* No thread pool used: execute task sequentially on the calling thread */
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
-		for (size_t i = 0; i < range; i++) {
-			task(argument, 0, i);
+		for (size_t i = 0; i < range_i; i++) {
+			for (size_t j = 0; j < range_j; j++) {
+				task(argument, 0, i, j);
+			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		thread_function_t parallelize_1d_with_thread = &thread_parallelize_1d_with_thread;
+		const size_t range = range_i * range_j;
+		const struct pthreadpool_2d_params params = {
+			.range_j = fxdiv_init_size_t(range_j),
+		};
+		thread_function_t parallelize_2d_with_thread = &thread_parallelize_2d_with_thread;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (range < range_threshold) {
-				parallelize_1d_with_thread = &pthreadpool_thread_parallelize_1d_with_thread_fastpath;
+				parallelize_2d_with_thread = &pthreadpool_thread_parallelize_2d_with_thread_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_1d_with_thread, NULL, 0,
-			(void*) task, argument, range, flags);
+			threadpool, parallelize_2d_with_thread, &params, sizeof(params),
+			task, argument, range, flags);
 	}
 }
 
-void pthreadpool_parallelize_1d_with_uarch(
+void pthreadpool_parallelize_2d_tile_1d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_1d_with_id_t task,
+	pthreadpool_task_2d_tile_1d_t task,
 	void* argument,
-	uint32_t default_uarch_index,
-	uint32_t max_uarch_index,
-	size_t range,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_j,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
-
-		uint32_t uarch_index = default_uarch_index;
-		#if PTHREADPOOL_USE_CPUINFO
-			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-			if (uarch_index > max_uarch_index) {
-				uarch_index = default_uarch_index;
-			}
-		#endif
-
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
-		for (size_t i = 0; i < range; i++) {
-			task(argument, uarch_index, i);
+		for (size_t i = 0; i < range_i; i++) {
+			for (size_t j = 0; j < range_j; j += tile_j) {
+				task(argument, i, j, min(range_j - j, tile_j));
+			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const struct pthreadpool_1d_with_uarch_params params = {
-			.default_uarch_index = default_uarch_index,
-			.max_uarch_index = max_uarch_index,
+		const size_t tile_range_j = divide_round_up(range_j, tile_j);
+		const size_t tile_range = range_i * tile_range_j;
+		const struct pthreadpool_2d_tile_1d_params params = {
+			.range_j = range_j,
+			.tile_j = tile_j,
+			.tile_range_j = fxdiv_init_size_t(tile_range_j),
 		};
-		thread_function_t parallelize_1d_with_uarch = &thread_parallelize_1d_with_uarch;
+		thread_function_t parallelize_2d_tile_1d = &thread_parallelize_2d_tile_1d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_1d_with_uarch = &pthreadpool_thread_parallelize_1d_with_uarch_fastpath;
+			if (tile_range < range_threshold) {
+				parallelize_2d_tile_1d = &pthreadpool_thread_parallelize_2d_tile_1d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_1d_with_uarch, &params, sizeof(params),
-			task, argument, range, flags);
+			threadpool, parallelize_2d_tile_1d, &params, sizeof(params),
+			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_1d_tile_1d(
+void pthreadpool_parallelize_2d_range(
 	pthreadpool_t threadpool,
-	pthreadpool_task_1d_tile_1d_t task,
+	pthreadpool_task_2d_range_t task,
 	void* argument,
-	size_t range,
-	size_t tile,
+	size_t range_i,
+	size_t range_j,
+	size_t alignment_j,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= tile) {
+	if (alignment_j == 0) {
+		alignment_j = 1;
+	}
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= alignment_j)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
-		for (size_t i = 0; i < range; i += tile) {
-			task(argument, i, min(range - i, tile));
+		if (range_j != 0) {
+			for (size_t i = 0; i < range_i; i++) {
+				task(argument, i, 0, range_j);
+			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range = divide_round_up(range, tile);
-		const struct pthreadpool_1d_tile_1d_params params = {
-			.range = range,
-			.tile = tile,
+		const size_t aligned_range_j = divide_round_up(range_j, alignment_j);
+		const struct pthreadpool_2d_range_params params = {
+			.range_j = range_j,
+			.alignment_j = alignment_j,
+			.aligned_range_j = fxdiv_init_size_t(aligned_range_j),
 		};
-		thread_function_t parallelize_1d_tile_1d = &thread_parallelize_1d_tile_1d;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_1d_tile_1d = &pthreadpool_thread_parallelize_1d_tile_1d_fastpath;
-			}
-		#endif
+		/* Chunks are reserved in shrinking batches, and each batch is passed to the task as a single run */
 		pthreadpool_parallelize(
-			threadpool, parallelize_1d_tile_1d, &params, sizeof(params),
-			task, argument, tile_range, flags);
+			threadpool, &thread_parallelize_2d_range, &params, sizeof(params),
+			(void*) task, argument, range_i * aligned_range_j, flags | PTHREADPOOL_FLAG_BATCH_CLAIMS);
 	}
 }
 
-void pthreadpool_parallelize_2d(
+void pthreadpool_parallelize_2d_tile_1d_with_uarch(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_t task,
+	pthreadpool_task_2d_tile_1d_with_id_t task,
 	void* argument,
+	uint32_t default_uarch_index,
+	uint32_t max_uarch_index,
 	size_t range_i,
 	size_t range_j,
+	size_t tile_j,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j) <= 1) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
+
+		uint32_t uarch_index = default_uarch_index;
+		#if PTHREADPOOL_USE_CPUINFO
+			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+			if (uarch_index > max_uarch_index) {
+				uarch_index = default_uarch_index;
+			}
+		#endif
+
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
 		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j++) {
-				task(argument, i, j);
+			for (size_t j = 0; j < range_j; j += tile_j) {
+				task(argument, uarch_index, i, j, min(range_j - j, tile_j));
 			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t range = range_i * range_j;
-		const struct pthreadpool_2d_params params = {
-			.range_j = fxdiv_init_size_t(range_j),
+		const size_t tile_range_j = divide_round_up(range_j, tile_j);
+		const size_t tile_range = range_i * tile_range_j;
+		const struct pthreadpool_2d_tile_1d_with_uarch_params params = {
+			.default_uarch_index = default_uarch_index,
+			.max_uarch_index = max_uarch_index,
+			.range_j = range_j,
+			.tile_j = tile_j,
+			.tile_range_j = fxdiv_init_size_t(tile_range_j),
 		};
-		thread_function_t parallelize_2d = &thread_parallelize_2d;
+		thread_function_t parallelize_2d_tile_1d_with_uarch = &thread_parallelize_2d_tile_1d_with_uarch;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_2d = &pthreadpool_thread_parallelize_2d_fastpath;
+			if (tile_range < range_threshold) {
+				parallelize_2d_tile_1d_with_uarch = &pthreadpool_thread_parallelize_2d_tile_1d_with_uarch_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_2d, &params, sizeof(params),
-			task, argument, range, flags);
+			threadpool, parallelize_2d_tile_1d_with_uarch, &params, sizeof(params),
+			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_2d_with_thread(
+void pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_with_thread_t task,
+	pthreadpool_task_2d_tile_1d_with_id_with_thread_t task,
 	void* argument,
+	uint32_t default_uarch_index,
+	uint32_t max_uarch_index,
 	size_t range_i,
 	size_t range_j,
+	size_t tile_j,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j) <= 1) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
+
+		uint32_t uarch_index = default_uarch_index;
+		#if PTHREADPOOL_USE_CPUINFO
+			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+			if (uarch_index > max_uarch_index) {
+				uarch_index = default_uarch_index;
+			}
+		#endif
+
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
 		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j++) {
-				task(argument, 0, i, j);
+			for (size_t j = 0; j < range_j; j += tile_j) {
+				task(argument, uarch_index, 0, i, j, min(range_j - j, tile_j));
 			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t range = range_i * range_j;
-		const struct pthreadpool_2d_params params = {
-			.range_j = fxdiv_init_size_t(range_j),
+		const size_t tile_range_j = divide_round_up(range_j, tile_j);
+		const size_t tile_range = range_i * tile_range_j;
+		const struct pthreadpool_2d_tile_1d_with_uarch_params params = {
+			.default_uarch_index = default_uarch_index,
+			.max_uarch_index = max_uarch_index,
+			.range_j = range_j,
+			.tile_j = tile_j,
+			.tile_range_j = fxdiv_init_size_t(tile_range_j),
 		};
-		thread_function_t parallelize_2d_with_thread = &thread_parallelize_2d_with_thread;
+		thread_function_t parallelize_2d_tile_1d_with_uarch_with_thread = &thread_parallelize_2d_tile_1d_with_uarch_with_thread;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_2d_with_thread = &pthreadpool_thread_parallelize_2d_with_thread_fastpath;
+			if (tile_range < range_threshold) {
+				parallelize_2d_tile_1d_with_uarch_with_thread = &pthreadpool_thread_parallelize_2d_tile_1d_with_uarch_with_thread_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_2d_with_thread, &params, sizeof(params),
-			task, argument, range, flags);
+			threadpool, parallelize_2d_tile_1d_with_uarch_with_thread, &params, sizeof(params),
+			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_2d_tile_1d(
+void pthreadpool_parallelize_2d_tile_2d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_tile_1d_t task,
+	pthreadpool_task_2d_tile_2d_t task,
 	void* argument,
 	size_t range_i,
 	size_t range_j,
+	size_t tile_i,
 	size_t tile_j,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j)) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= tile_i && range_j <= tile_j)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
-		for (size_t i = 0; i < range_i; i++) {
+		for (size_t i = 0; i < range_i; i += tile_i) {
 			for (size_t j = 0; j < range_j; j += tile_j) {
-				task(argument, i, j, min(range_j - j, tile_j));
+				task(argument, i, j, min(range_i - i, tile_i), min(range_j - j, tile_j));
 			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
+		const size_t tile_range_i = divide_round_up(range_i, tile_i);
 		const size_t tile_range_j = divide_round_up(range_j, tile_j);
-		const size_t tile_range = range_i * tile_range_j;
-		const struct pthreadpool_2d_tile_1d_params params = {
+		const size_t tile_range = tile_range_i * tile_range_j;
+		const struct pthreadpool_2d_tile_2d_params params = {
+			.range_i = range_i,
+			.tile_i = tile_i,
 			.range_j = range_j,
 			.tile_j = tile_j,
 			.tile_range_j = fxdiv_init_size_t(tile_range_j),
 		};
-		thread_function_t parallelize_2d_tile_1d = &thread_parallelize_2d_tile_1d;
+		thread_function_t parallelize_2d_tile_2d = &thread_parallelize_2d_tile_2d;
+		if (flags & PTHREADPOOL_FLAG_MORTON_ORDER) {
+			parallelize_2d_tile_2d = &thread_parallelize_2d_tile_2d_morton;
+		}
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_2d_tile_1d = &pthreadpool_thread_parallelize_2d_tile_1d_fastpath;
+			if (tile_range < range_threshold && !(flags & PTHREADPOOL_FLAG_MORTON_ORDER)) {
+				parallelize_2d_tile_2d = &pthreadpool_thread_parallelize_2d_tile_2d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_2d_tile_1d, &params, sizeof(params),
+			threadpool, parallelize_2d_tile_2d, &params, sizeof(params),
 			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_2d_tile_1d_with_uarch(
-	pthreadpool_t threadpool,
-	pthreadpool_task_2d_tile_1d_with_id_t task,
+pthreadpool_job_t pthreadpool_parallelize_2d_tile_2d_async(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= tile_i && range_j <= tile_j)) {
+		pthreadpool_parallelize_2d_tile_2d(threadpool, task, argument, range_i, range_j, tile_i, tile_j, flags);
+		return NULL;
+	}
+
+	const size_t tile_range_i = divide_round_up(range_i, tile_i);
+	const size_t tile_range_j = divide_round_up(range_j, tile_j);
+	const size_t tile_range = tile_range_i * tile_range_j;
+	const struct pthreadpool_2d_tile_2d_params params = {
+		.range_i = range_i,
+		.tile_i = tile_i,
+		.range_j = range_j,
+		.tile_j = tile_j,
+		.tile_range_j = fxdiv_init_size_t(tile_range_j),
+	};
+	thread_function_t parallelize_2d_tile_2d = &thread_parallelize_2d_tile_2d;
+	if (flags & PTHREADPOOL_FLAG_MORTON_ORDER) {
+		parallelize_2d_tile_2d = &thread_parallelize_2d_tile_2d_morton;
+	}
+	#if PTHREADPOOL_USE_FASTPATH
+		const size_t range_threshold = -threads_count;
+		if (tile_range < range_threshold && !(flags & PTHREADPOOL_FLAG_MORTON_ORDER)) {
+			parallelize_2d_tile_2d = &pthreadpool_thread_parallelize_2d_tile_2d_fastpath;
+		}
+	#endif
+	return pthreadpool_parallelize_async(
+		threadpool, parallelize_2d_tile_2d, &params, sizeof(params),
+		task, argument, tile_range, flags);
+}
+
+size_t pthreadpool_graph_add_2d_tile_2d(
+	pthreadpool_graph_t graph,
+	pthreadpool_task_2d_tile_2d_t task,
 	void* argument,
-	uint32_t default_uarch_index,
-	uint32_t max_uarch_index,
 	size_t range_i,
 	size_t range_j,
+	size_t tile_i,
 	size_t tile_j,
 	uint32_t flags)
 {
-	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j)) {
-		/* No thread pool used: execute task sequentially on the calling thread */
+	const size_t tile_range_i = divide_round_up(range_i, tile_i);
+	const size_t tile_range_j = divide_round_up(range_j, tile_j);
+	const struct pthreadpool_2d_tile_2d_params params = {
+		.range_i = range_i,
+		.tile_i = tile_i,
+		.range_j = range_j,
+		.tile_j = tile_j,
+		.tile_range_j = fxdiv_init_size_t(tile_range_j),
+	};
+	thread_function_t parallelize_2d_tile_2d = &thread_parallelize_2d_tile_2d;
+	if (flags & PTHREADPOOL_FLAG_MORTON_ORDER) {
+		parallelize_2d_tile_2d = &thread_parallelize_2d_tile_2d_morton;
+	}
+	return pthreadpool_graph_add_node(
+		graph, parallelize_2d_tile_2d, &params, sizeof(params),
+		task, argument, tile_range_i * tile_range_j, flags);
+}
 
-		uint32_t uarch_index = default_uarch_index;
-		#if PTHREADPOOL_USE_CPUINFO
-			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-			if (uarch_index > max_uarch_index) {
-				uarch_index = default_uarch_index;
-			}
-		#endif
+void pthreadpool_parallelize_2d_triangular(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
 
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
-		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j += tile_j) {
-				task(argument, uarch_index, i, j, min(range_j - j, tile_j));
+		for (size_t j = 0; j < range; j++) {
+			for (size_t i = 0; i <= j; i++) {
+				task(argument, i, j);
 			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_j = divide_round_up(range_j, tile_j);
-		const size_t tile_range = range_i * tile_range_j;
-		const struct pthreadpool_2d_tile_1d_with_uarch_params params = {
-			.default_uarch_index = default_uarch_index,
-			.max_uarch_index = max_uarch_index,
-			.range_j = range_j,
-			.tile_j = tile_j,
-			.tile_range_j = fxdiv_init_size_t(tile_range_j),
-		};
-		thread_function_t parallelize_2d_tile_1d_with_uarch = &thread_parallelize_2d_tile_1d_with_uarch;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_2d_tile_1d_with_uarch = &pthreadpool_thread_parallelize_2d_tile_1d_with_uarch_fastpath;
-			}
-		#endif
+		const size_t triangle_range = range * (range + 1) / 2;
 		pthreadpool_parallelize(
-			threadpool, parallelize_2d_tile_1d_with_uarch, &params, sizeof(params),
-			task, argument, tile_range, flags);
+			threadpool, &thread_parallelize_2d_triangular, NULL, 0,
+			(void*) task, argument, triangle_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+void pthreadpool_parallelize_2d_tile_2d_triangular(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_tile_1d_with_id_with_thread_t task,
+	pthreadpool_task_2d_tile_2d_t task,
 	void* argument,
-	uint32_t default_uarch_index,
-	uint32_t max_uarch_index,
-	size_t range_i,
-	size_t range_j,
-	size_t tile_j,
+	size_t range,
+	size_t tile,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j)) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= tile) {
 		/* No thread pool used: execute task sequentially on the calling thread */
-
-		uint32_t uarch_index = default_uarch_index;
-		#if PTHREADPOOL_USE_CPUINFO
-			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-			if (uarch_index > max_uarch_index) {
-				uarch_index = default_uarch_index;
-			}
-		#endif
-
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
-		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j += tile_j) {
-				task(argument, uarch_index, 0, i, j, min(range_j - j, tile_j));
+		for (size_t j = 0; j < range; j += tile) {
+			for (size_t i = 0; i <= j; i += tile) {
+				task(argument, i, j, min(range - i, tile), min(range - j, tile));
 			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_j = divide_round_up(range_j, tile_j);
-		const size_t tile_range = range_i * tile_range_j;
-		const struct pthreadpool_2d_tile_1d_with_uarch_params params = {
-			.default_uarch_index = default_uarch_index,
-			.max_uarch_index = max_uarch_index,
-			.range_j = range_j,
-			.tile_j = tile_j,
-			.tile_range_j = fxdiv_init_size_t(tile_range_j),
+		const size_t tile_range = divide_round_up(range, tile);
+		const size_t triangle_tile_range = tile_range * (tile_range + 1) / 2;
+		const struct pthreadpool_2d_tile_2d_triangular_params params = {
+			.range = range,
+			.tile = tile,
 		};
-		thread_function_t parallelize_2d_tile_1d_with_uarch_with_thread = &thread_parallelize_2d_tile_1d_with_uarch_with_thread;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_2d_tile_1d_with_uarch_with_thread = &pthreadpool_thread_parallelize_2d_tile_1d_with_uarch_with_thread_fastpath;
-			}
-		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_2d_tile_1d_with_uarch_with_thread, &params, sizeof(params),
-			task, argument, tile_range, flags);
+			threadpool, &thread_parallelize_2d_tile_2d_triangular, &params, sizeof(params),
+			task, argument, triangle_tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_2d_tile_2d(
+void pthreadpool_parallelize_2d_tile_2d_wavefront(
 	pthreadpool_t threadpool,
 	pthreadpool_task_2d_tile_2d_t task,
 	void* argument,
@@ -2003,9 +2783,21 @@ void pthreadpool_parallelize_2d_tile_2d(
 	size_t tile_j,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= tile_i && range_j <= tile_j)) {
-		/* No thread pool used: execute task sequentially on the calling thread */
+	pthreadpool_atomic_size_t* counters = NULL;
+	const size_t tile_rows = divide_round_up(range_i, tile_i);
+	/* Keep the shared tile counter and the row progress counters on different cache lines */
+	const size_t row_progress_offset = PTHREADPOOL_CACHELINE_SIZE / sizeof(pthreadpool_atomic_size_t);
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 ||
+		range_i <= tile_i || range_j <= tile_j ||
+		(counters = calloc(row_progress_offset + tile_rows, sizeof(pthreadpool_atomic_size_t))) == NULL)
+	{
+		/*
+		 * No thread pool used: execute task sequentially on the calling thread. A single row or column of tiles forms
+		 * a dependency chain, which leaves nothing to parallelize.
+		 */
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
@@ -2020,26 +2812,20 @@ void pthreadpool_parallelize_2d_tile_2d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_i = divide_round_up(range_i, tile_i);
-		const size_t tile_range_j = divide_round_up(range_j, tile_j);
-		const size_t tile_range = tile_range_i * tile_range_j;
-		const struct pthreadpool_2d_tile_2d_params params = {
+		const size_t tile_count = tile_rows * divide_round_up(range_j, tile_j);
+		pthreadpool_store_relaxed_size_t(&counters[0], tile_count);
+		const struct pthreadpool_2d_tile_2d_wavefront_params params = {
 			.range_i = range_i,
 			.tile_i = tile_i,
 			.range_j = range_j,
 			.tile_j = tile_j,
-			.tile_range_j = fxdiv_init_size_t(tile_range_j),
+			.remaining_tiles = &counters[0],
+			.row_progress = &counters[row_progress_offset],
 		};
-		thread_function_t parallelize_2d_tile_2d = &thread_parallelize_2d_tile_2d;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_2d_tile_2d = &pthreadpool_thread_parallelize_2d_tile_2d_fastpath;
-			}
-		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_2d_tile_2d, &params, sizeof(params),
-			task, argument, tile_range, flags);
+			threadpool, &thread_parallelize_2d_tile_2d_wavefront, &params, sizeof(params),
+			task, argument, tile_count, flags);
+		free(counters);
 	}
 }
 
@@ -2055,6 +2841,8 @@ void pthreadpool_parallelize_2d_tile_2d_with_uarch(
 	size_t tile_j,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= tile_i && range_j <= tile_j)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2115,6 +2903,8 @@ void pthreadpool_parallelize_3d(
 	size_t range_k,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j | range_k) <= 1) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2134,21 +2924,20 @@ void pthreadpool_parallelize_3d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t range = range_i * range_j * range_k;
-		const struct pthreadpool_3d_params params = {
-			.range_j = fxdiv_init_size_t(range_j),
-			.range_k = fxdiv_init_size_t(range_k),
-		};
+		const size_t range[3] = { range_i, range_j, range_k };
+		const size_t tile[3] = { 1, 1, 1 };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 3, range, tile);
 		thread_function_t parallelize_3d = &thread_parallelize_3d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_3d = &pthreadpool_thread_parallelize_3d_fastpath;
+			if (tile_range < range_threshold) {
+				parallelize_3d = &thread_parallelize_3d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_3d, &params, sizeof(params),
-			task, argument, range, flags);
+			threadpool, parallelize_3d, &params, get_nd_params_size(3),
+			task, argument, tile_range, flags);
 	}
 }
 
@@ -2162,6 +2951,8 @@ void pthreadpool_parallelize_3d_tile_1d(
 	size_t tile_k,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2181,23 +2972,19 @@ void pthreadpool_parallelize_3d_tile_1d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_k = divide_round_up(range_k, tile_k);
-		const size_t tile_range = range_i * range_j * tile_range_k;
-		const struct pthreadpool_3d_tile_1d_params params = {
-			.range_k = range_k,
-			.tile_k = tile_k,
-			.range_j = fxdiv_init_size_t(range_j),
-			.tile_range_k = fxdiv_init_size_t(tile_range_k),
-		};
+		const size_t range[3] = { range_i, range_j, range_k };
+		const size_t tile[3] = { 1, 1, tile_k };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 3, range, tile);
 		thread_function_t parallelize_3d_tile_1d = &thread_parallelize_3d_tile_1d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_3d_tile_1d = &pthreadpool_thread_parallelize_3d_tile_1d_fastpath;
+				parallelize_3d_tile_1d = &thread_parallelize_3d_tile_1d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_3d_tile_1d, &params, sizeof(params),
+			threadpool, parallelize_3d_tile_1d, &params, get_nd_params_size(3),
 			task, argument, tile_range, flags);
 	}
 }
@@ -2212,6 +2999,8 @@ void pthreadpool_parallelize_3d_tile_1d_with_thread(
 	size_t tile_k,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2231,23 +3020,19 @@ void pthreadpool_parallelize_3d_tile_1d_with_thread(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_k = divide_round_up(range_k, tile_k);
-		const size_t tile_range = range_i * range_j * tile_range_k;
-		const struct pthreadpool_3d_tile_1d_params params = {
-			.range_k = range_k,
-			.tile_k = tile_k,
-			.range_j = fxdiv_init_size_t(range_j),
-			.tile_range_k = fxdiv_init_size_t(tile_range_k),
-		};
+		const size_t range[3] = { range_i, range_j, range_k };
+		const size_t tile[3] = { 1, 1, tile_k };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 3, range, tile);
 		thread_function_t parallelize_3d_tile_1d_with_thread = &thread_parallelize_3d_tile_1d_with_thread;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_3d_tile_1d_with_thread = &pthreadpool_thread_parallelize_3d_tile_1d_with_thread_fastpath;
+				parallelize_3d_tile_1d_with_thread = &thread_parallelize_3d_tile_1d_with_thread_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_3d_tile_1d_with_thread, &params, sizeof(params),
+			threadpool, parallelize_3d_tile_1d_with_thread, &params, get_nd_params_size(3),
 			task, argument, tile_range, flags);
 	}
 }
@@ -2264,6 +3049,8 @@ void pthreadpool_parallelize_3d_tile_1d_with_uarch(
 	size_t tile_k,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2292,25 +3079,21 @@ void pthreadpool_parallelize_3d_tile_1d_with_uarch(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_k = divide_round_up(range_k, tile_k);
-		const size_t tile_range = range_i * range_j * tile_range_k;
-		const struct pthreadpool_3d_tile_1d_with_uarch_params params = {
-			.default_uarch_index = default_uarch_index,
-			.max_uarch_index = max_uarch_index,
-			.range_k = range_k,
-			.tile_k = tile_k,
-			.range_j = fxdiv_init_size_t(range_j),
-			.tile_range_k = fxdiv_init_size_t(tile_range_k),
-		};
+		const size_t range[3] = { range_i, range_j, range_k };
+		const size_t tile[3] = { 1, 1, tile_k };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 3, range, tile);
+		params.default_uarch_index = default_uarch_index;
+		params.max_uarch_index = max_uarch_index;
 		thread_function_t parallelize_3d_tile_1d_with_uarch = &thread_parallelize_3d_tile_1d_with_uarch;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_3d_tile_1d_with_uarch = &pthreadpool_thread_parallelize_3d_tile_1d_with_uarch_fastpath;
+				parallelize_3d_tile_1d_with_uarch = &thread_parallelize_3d_tile_1d_with_uarch_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_3d_tile_1d_with_uarch, &params, sizeof(params),
+			threadpool, parallelize_3d_tile_1d_with_uarch, &params, get_nd_params_size(3),
 			task, argument, tile_range, flags);
 	}
 }
@@ -2327,6 +3110,8 @@ void pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 	size_t tile_k,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2355,25 +3140,21 @@ void pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_k = divide_round_up(range_k, tile_k);
-		const size_t tile_range = range_i * range_j * tile_range_k;
-		const struct pthreadpool_3d_tile_1d_with_uarch_params params = {
-			.default_uarch_index = default_uarch_index,
-			.max_uarch_index = max_uarch_index,
-			.range_k = range_k,
-			.tile_k = tile_k,
-			.range_j = fxdiv_init_size_t(range_j),
-			.tile_range_k = fxdiv_init_size_t(tile_range_k),
-		};
+		const size_t range[3] = { range_i, range_j, range_k };
+		const size_t tile[3] = { 1, 1, tile_k };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 3, range, tile);
+		params.default_uarch_index = default_uarch_index;
+		params.max_uarch_index = max_uarch_index;
 		thread_function_t parallelize_3d_tile_1d_with_uarch_with_thread = &thread_parallelize_3d_tile_1d_with_uarch_with_thread;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_3d_tile_1d_with_uarch_with_thread = &pthreadpool_thread_parallelize_3d_tile_1d_with_uarch_with_thread_fastpath;
+				parallelize_3d_tile_1d_with_uarch_with_thread = &thread_parallelize_3d_tile_1d_with_uarch_with_thread_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_3d_tile_1d_with_uarch_with_thread, &params, sizeof(params),
+			threadpool, parallelize_3d_tile_1d_with_uarch_with_thread, &params, get_nd_params_size(3),
 			task, argument, tile_range, flags);
 	}
 }
@@ -2389,6 +3170,8 @@ void pthreadpool_parallelize_3d_tile_2d(
 	size_t tile_k,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j && range_k <= tile_k)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2408,26 +3191,22 @@ void pthreadpool_parallelize_3d_tile_2d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_j = divide_round_up(range_j, tile_j);
-		const size_t tile_range_k = divide_round_up(range_k, tile_k);
-		const size_t tile_range = range_i * tile_range_j * tile_range_k;
-		const struct pthreadpool_3d_tile_2d_params params = {
-			.range_j = range_j,
-			.tile_j = tile_j,
-			.range_k = range_k,
-			.tile_k = tile_k,
-			.tile_range_j = fxdiv_init_size_t(tile_range_j),
-			.tile_range_k = fxdiv_init_size_t(tile_range_k),
-		};
+		const size_t range[3] = { range_i, range_j, range_k };
+		const size_t tile[3] = { 1, tile_j, tile_k };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 3, range, tile);
 		thread_function_t parallelize_3d_tile_2d = &thread_parallelize_3d_tile_2d;
+		if (flags & PTHREADPOOL_FLAG_MORTON_ORDER) {
+			parallelize_3d_tile_2d = &thread_parallelize_3d_tile_2d_morton;
+		}
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_3d_tile_2d = &pthreadpool_thread_parallelize_3d_tile_2d_fastpath;
+			if (tile_range < range_threshold && !(flags & PTHREADPOOL_FLAG_MORTON_ORDER)) {
+				parallelize_3d_tile_2d = &thread_parallelize_3d_tile_2d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_3d_tile_2d, &params, sizeof(params),
+			threadpool, parallelize_3d_tile_2d, &params, get_nd_params_size(3),
 			task, argument, tile_range, flags);
 	}
 }
@@ -2445,6 +3224,8 @@ void pthreadpool_parallelize_3d_tile_2d_with_uarch(
 	size_t tile_k,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j && range_k <= tile_k)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2473,28 +3254,21 @@ void pthreadpool_parallelize_3d_tile_2d_with_uarch(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_j = divide_round_up(range_j, tile_j);
-		const size_t tile_range_k = divide_round_up(range_k, tile_k);
-		const size_t tile_range = range_i * tile_range_j * tile_range_k;
-		const struct pthreadpool_3d_tile_2d_with_uarch_params params = {
-			.default_uarch_index = default_uarch_index,
-			.max_uarch_index = max_uarch_index,
-			.range_j = range_j,
-			.tile_j = tile_j,
-			.range_k = range_k,
-			.tile_k = tile_k,
-			.tile_range_j = fxdiv_init_size_t(tile_range_j),
-			.tile_range_k = fxdiv_init_size_t(tile_range_k),
-		};
+		const size_t range[3] = { range_i, range_j, range_k };
+		const size_t tile[3] = { 1, tile_j, tile_k };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 3, range, tile);
+		params.default_uarch_index = default_uarch_index;
+		params.max_uarch_index = max_uarch_index;
 		thread_function_t parallelize_3d_tile_2d_with_uarch = &thread_parallelize_3d_tile_2d_with_uarch;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_3d_tile_2d_with_uarch = &pthreadpool_thread_parallelize_3d_tile_2d_with_uarch_fastpath;
+				parallelize_3d_tile_2d_with_uarch = &thread_parallelize_3d_tile_2d_with_uarch_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_3d_tile_2d_with_uarch, &params, sizeof(params),
+			threadpool, parallelize_3d_tile_2d_with_uarch, &params, get_nd_params_size(3),
 			task, argument, tile_range, flags);
 	}
 }
@@ -2509,6 +3283,8 @@ void pthreadpool_parallelize_4d(
 	size_t range_l,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j | range_k | range_l) <= 1) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2530,24 +3306,20 @@ void pthreadpool_parallelize_4d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t range_kl = range_k * range_l;
-		const size_t range = range_i * range_j * range_kl;
-		const struct pthreadpool_4d_params params = {
-			.range_k = range_k,
-			.range_j = fxdiv_init_size_t(range_j),
-			.range_kl = fxdiv_init_size_t(range_kl),
-			.range_l = fxdiv_init_size_t(range_l),
-		};
+		const size_t range[4] = { range_i, range_j, range_k, range_l };
+		const size_t tile[4] = { 1, 1, 1, 1 };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 4, range, tile);
 		thread_function_t parallelize_4d = &thread_parallelize_4d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_4d = &pthreadpool_thread_parallelize_4d_fastpath;
+			if (tile_range < range_threshold) {
+				parallelize_4d = &thread_parallelize_4d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_4d, &params, sizeof(params),
-			task, argument, range, flags);
+			threadpool, parallelize_4d, &params, get_nd_params_size(4),
+			task, argument, tile_range, flags);
 	}
 }
 
@@ -2562,6 +3334,8 @@ void pthreadpool_parallelize_4d_tile_1d(
 	size_t tile_l,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k) <= 1 && range_l <= tile_l)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2583,26 +3357,19 @@ void pthreadpool_parallelize_4d_tile_1d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_l = divide_round_up(range_l, tile_l);
-		const size_t tile_range_kl = range_k * tile_range_l;
-		const size_t tile_range = range_i * range_j * tile_range_kl;
-		const struct pthreadpool_4d_tile_1d_params params = {
-			.range_k = range_k,
-			.range_l = range_l,
-			.tile_l = tile_l,
-			.range_j = fxdiv_init_size_t(range_j),
-			.tile_range_kl = fxdiv_init_size_t(tile_range_kl),
-			.tile_range_l = fxdiv_init_size_t(tile_range_l),
-		};
+		const size_t range[4] = { range_i, range_j, range_k, range_l };
+		const size_t tile[4] = { 1, 1, 1, tile_l };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 4, range, tile);
 		thread_function_t parallelize_4d_tile_1d = &thread_parallelize_4d_tile_1d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_4d_tile_1d = &pthreadpool_thread_parallelize_4d_tile_1d_fastpath;
+				parallelize_4d_tile_1d = &thread_parallelize_4d_tile_1d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_4d_tile_1d, &params, sizeof(params),
+			threadpool, parallelize_4d_tile_1d, &params, get_nd_params_size(4),
 			task, argument, tile_range, flags);
 	}
 }
@@ -2619,6 +3386,8 @@ void pthreadpool_parallelize_4d_tile_2d(
 	size_t tile_l,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k && range_l <= tile_l)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2641,27 +3410,19 @@ void pthreadpool_parallelize_4d_tile_2d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_l = divide_round_up(range_l, tile_l);
-		const size_t tile_range_kl = divide_round_up(range_k, tile_k) * tile_range_l;
-		const size_t tile_range = range_i * range_j * tile_range_kl;
-		const struct pthreadpool_4d_tile_2d_params params = {
-			.range_k = range_k,
-			.tile_k = tile_k,
-			.range_l = range_l,
-			.tile_l = tile_l,
-			.range_j = fxdiv_init_size_t(range_j),
-			.tile_range_kl = fxdiv_init_size_t(tile_range_kl),
-			.tile_range_l = fxdiv_init_size_t(tile_range_l),
-		};
+		const size_t range[4] = { range_i, range_j, range_k, range_l };
+		const size_t tile[4] = { 1, 1, tile_k, tile_l };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 4, range, tile);
 		thread_function_t parallelize_4d_tile_2d = &thread_parallelize_4d_tile_2d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_4d_tile_2d = &pthreadpool_thread_parallelize_4d_tile_2d_fastpath;
+				parallelize_4d_tile_2d = &thread_parallelize_4d_tile_2d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_4d_tile_2d, &params, sizeof(params),
+			threadpool, parallelize_4d_tile_2d, &params, get_nd_params_size(4),
 			task, argument, tile_range, flags);
 	}
 }
@@ -2680,6 +3441,8 @@ void pthreadpool_parallelize_4d_tile_2d_with_uarch(
 	size_t tile_l,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k && range_l <= tile_l)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2711,29 +3474,21 @@ void pthreadpool_parallelize_4d_tile_2d_with_uarch(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_l = divide_round_up(range_l, tile_l);
-		const size_t tile_range_kl = divide_round_up(range_k, tile_k) * tile_range_l;
-		const size_t tile_range = range_i * range_j * tile_range_kl;
-		const struct pthreadpool_4d_tile_2d_with_uarch_params params = {
-			.default_uarch_index = default_uarch_index,
-			.max_uarch_index = max_uarch_index,
-			.range_k = range_k,
-			.tile_k = tile_k,
-			.range_l = range_l,
-			.tile_l = tile_l,
-			.range_j = fxdiv_init_size_t(range_j),
-			.tile_range_kl = fxdiv_init_size_t(tile_range_kl),
-			.tile_range_l = fxdiv_init_size_t(tile_range_l),
-		};
+		const size_t range[4] = { range_i, range_j, range_k, range_l };
+		const size_t tile[4] = { 1, 1, tile_k, tile_l };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 4, range, tile);
+		params.default_uarch_index = default_uarch_index;
+		params.max_uarch_index = max_uarch_index;
 		thread_function_t parallelize_4d_tile_2d_with_uarch = &thread_parallelize_4d_tile_2d_with_uarch;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_4d_tile_2d_with_uarch = &pthreadpool_thread_parallelize_4d_tile_2d_with_uarch_fastpath;
+				parallelize_4d_tile_2d_with_uarch = &thread_parallelize_4d_tile_2d_with_uarch_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_4d_tile_2d_with_uarch, &params, sizeof(params),
+			threadpool, parallelize_4d_tile_2d_with_uarch, &params, get_nd_params_size(4),
 			task, argument, tile_range, flags);
 	}
 }
@@ -2749,6 +3504,8 @@ void pthreadpool_parallelize_5d(
 	size_t range_m,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j | range_k | range_l | range_m) <= 1) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2772,25 +3529,20 @@ void pthreadpool_parallelize_5d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t range_lm = range_l * range_m;
-		const size_t range = range_i * range_j * range_k * range_lm;
-		const struct pthreadpool_5d_params params = {
-			.range_l = range_l,
-			.range_j = fxdiv_init_size_t(range_j),
-			.range_k = fxdiv_init_size_t(range_k),
-			.range_lm = fxdiv_init_size_t(range_lm),
-			.range_m = fxdiv_init_size_t(range_m),
-		};
+		const size_t range[5] = { range_i, range_j, range_k, range_l, range_m };
+		const size_t tile[5] = { 1, 1, 1, 1, 1 };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 5, range, tile);
 		thread_function_t parallelize_5d = &thread_parallelize_5d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_5d = &pthreadpool_thread_parallelize_5d_fastpath;
+			if (tile_range < range_threshold) {
+				parallelize_5d = &thread_parallelize_5d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_5d, &params, sizeof(params),
-			task, argument, range, flags);
+			threadpool, parallelize_5d, &params, get_nd_params_size(5),
+			task, argument, tile_range, flags);
 	}
 }
 
@@ -2806,6 +3558,8 @@ void pthreadpool_parallelize_5d_tile_1d(
 	size_t tile_m,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k | range_l) <= 1 && range_m <= tile_m)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2829,27 +3583,19 @@ void pthreadpool_parallelize_5d_tile_1d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_m = divide_round_up(range_m, tile_m);
-		const size_t range_kl = range_k * range_l;
-		const size_t tile_range = range_i * range_j * range_kl * tile_range_m;
-		const struct pthreadpool_5d_tile_1d_params params = {
-			.range_k = range_k,
-			.range_m = range_m,
-			.tile_m = tile_m,
-			.range_j = fxdiv_init_size_t(range_j),
-			.range_kl = fxdiv_init_size_t(range_kl),
-			.range_l = fxdiv_init_size_t(range_l),
-			.tile_range_m = fxdiv_init_size_t(tile_range_m),
-		};
+		const size_t range[5] = { range_i, range_j, range_k, range_l, range_m };
+		const size_t tile[5] = { 1, 1, 1, 1, tile_m };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 5, range, tile);
 		thread_function_t parallelize_5d_tile_1d = &thread_parallelize_5d_tile_1d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_5d_tile_1d = &pthreadpool_thread_parallelize_5d_tile_1d_fastpath;
+				parallelize_5d_tile_1d = &thread_parallelize_5d_tile_1d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_5d_tile_1d, &params, sizeof(params),
+			threadpool, parallelize_5d_tile_1d, &params, get_nd_params_size(5),
 			task, argument, tile_range, flags);
 	}
 }
@@ -2867,6 +3613,8 @@ void pthreadpool_parallelize_5d_tile_2d(
 	size_t tile_m,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k) <= 1 && range_l <= tile_l && range_m <= tile_m)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2891,28 +3639,19 @@ void pthreadpool_parallelize_5d_tile_2d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_m = divide_round_up(range_m, tile_m);
-		const size_t tile_range_lm = divide_round_up(range_l, tile_l) * tile_range_m;
-		const size_t tile_range = range_i * range_j * range_k * tile_range_lm;
-		const struct pthreadpool_5d_tile_2d_params params = {
-			.range_l = range_l,
-			.tile_l = tile_l,
-			.range_m = range_m,
-			.tile_m = tile_m,
-			.range_j = fxdiv_init_size_t(range_j),
-			.range_k = fxdiv_init_size_t(range_k),
-			.tile_range_lm = fxdiv_init_size_t(tile_range_lm),
-			.tile_range_m = fxdiv_init_size_t(tile_range_m),
-		};
+		const size_t range[5] = { range_i, range_j, range_k, range_l, range_m };
+		const size_t tile[5] = { 1, 1, 1, tile_l, tile_m };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 5, range, tile);
 		thread_function_t parallelize_5d_tile_2d = &thread_parallelize_5d_tile_2d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_5d_tile_2d = &pthreadpool_thread_parallelize_5d_tile_2d_fastpath;
+				parallelize_5d_tile_2d = &thread_parallelize_5d_tile_2d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_5d_tile_2d, &params, sizeof(params),
+			threadpool, parallelize_5d_tile_2d, &params, get_nd_params_size(5),
 			task, argument, tile_range, flags);
 	}
 }
@@ -2929,6 +3668,8 @@ void pthreadpool_parallelize_6d(
 	size_t range_n,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j | range_k | range_l | range_m | range_n) <= 1) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -2954,26 +3695,20 @@ void pthreadpool_parallelize_6d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t range_lmn = range_l * range_m * range_n;
-		const size_t range = range_i * range_j * range_k * range_lmn;
-		const struct pthreadpool_6d_params params = {
-			.range_l = range_l,
-			.range_j = fxdiv_init_size_t(range_j),
-			.range_k = fxdiv_init_size_t(range_k),
-			.range_lmn = fxdiv_init_size_t(range_lmn),
-			.range_m = fxdiv_init_size_t(range_m),
-			.range_n = fxdiv_init_size_t(range_n),
-		};
+		const size_t range[6] = { range_i, range_j, range_k, range_l, range_m, range_n };
+		const size_t tile[6] = { 1, 1, 1, 1, 1, 1 };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 6, range, tile);
 		thread_function_t parallelize_6d = &thread_parallelize_6d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_6d = &pthreadpool_thread_parallelize_6d_fastpath;
+			if (tile_range < range_threshold) {
+				parallelize_6d = &thread_parallelize_6d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_6d, &params, sizeof(params),
-			task, argument, range, flags);
+			threadpool, parallelize_6d, &params, get_nd_params_size(6),
+			task, argument, tile_range, flags);
 	}
 }
 
@@ -2990,6 +3725,8 @@ void pthreadpool_parallelize_6d_tile_1d(
 	size_t tile_n,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k | range_l | range_m) <= 1 && range_n <= tile_n)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -3015,28 +3752,19 @@ void pthreadpool_parallelize_6d_tile_1d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_n = divide_round_up(range_n, tile_n);
-		const size_t tile_range_lmn = range_l * range_m * tile_range_n;
-		const size_t tile_range = range_i * range_j * range_k * tile_range_lmn;
-		const struct pthreadpool_6d_tile_1d_params params = {
-			.range_l = range_l,
-			.range_n = range_n,
-			.tile_n = tile_n,
-			.range_j = fxdiv_init_size_t(range_j),
-			.range_k = fxdiv_init_size_t(range_k),
-			.tile_range_lmn = fxdiv_init_size_t(tile_range_lmn),
-			.range_m = fxdiv_init_size_t(range_m),
-			.tile_range_n = fxdiv_init_size_t(tile_range_n),
-		};
+		const size_t range[6] = { range_i, range_j, range_k, range_l, range_m, range_n };
+		const size_t tile[6] = { 1, 1, 1, 1, 1, tile_n };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 6, range, tile);
 		thread_function_t parallelize_6d_tile_1d = &thread_parallelize_6d_tile_1d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_6d_tile_1d = &pthreadpool_thread_parallelize_6d_tile_1d_fastpath;
+				parallelize_6d_tile_1d = &thread_parallelize_6d_tile_1d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_6d_tile_1d, &params, sizeof(params),
+			threadpool, parallelize_6d_tile_1d, &params, get_nd_params_size(6),
 			task, argument, tile_range, flags);
 	}
 }
@@ -3055,6 +3783,8 @@ void pthreadpool_parallelize_6d_tile_2d(
 	size_t tile_n,
 	uint32_t flags)
 {
+	pthreadpool_reset_last_try_inline(flags);
+
 	size_t threads_count;
 	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k | range_l) <= 1 && range_m <= tile_m && range_n <= tile_n)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
@@ -3081,31 +3811,172 @@ void pthreadpool_parallelize_6d_tile_2d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t range_kl = range_k * range_l;
-		const size_t tile_range_n = divide_round_up(range_n, tile_n);
-		const size_t tile_range_mn = divide_round_up(range_m, tile_m) * tile_range_n;
-		const size_t tile_range = range_i * range_j * range_kl * tile_range_mn;
-		const struct pthreadpool_6d_tile_2d_params params = {
-			.range_k = range_k,
-			.range_m = range_m,
-			.tile_m = tile_m,
-			.range_n = range_n,
-			.tile_n = tile_n,
-			.range_j = fxdiv_init_size_t(range_j),
-			.range_kl = fxdiv_init_size_t(range_kl),
-			.range_l = fxdiv_init_size_t(range_l),
-			.tile_range_mn = fxdiv_init_size_t(tile_range_mn),
-			.tile_range_n = fxdiv_init_size_t(tile_range_n),
-		};
+		const size_t range[6] = { range_i, range_j, range_k, range_l, range_m, range_n };
+		const size_t tile[6] = { 1, 1, 1, 1, tile_m, tile_n };
+		struct pthreadpool_nd_params params;
+		const size_t tile_range = init_nd_params(&params, 6, range, tile);
 		thread_function_t parallelize_6d_tile_2d = &thread_parallelize_6d_tile_2d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_6d_tile_2d = &pthreadpool_thread_parallelize_6d_tile_2d_fastpath;
+				parallelize_6d_tile_2d = &thread_parallelize_6d_tile_2d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_6d_tile_2d, &params, sizeof(params),
+			threadpool, parallelize_6d_tile_2d, &params, get_nd_params_size(6),
 			task, argument, tile_range, flags);
 	}
 }
+
+void pthreadpool_parallelize_nd(
+	pthreadpool_t threadpool,
+	pthreadpool_task_nd_t task,
+	void* argument,
+	size_t num_dims,
+	const size_t* range,
+	const size_t* tile,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	assert(num_dims <= PTHREADPOOL_MAX_DIMENSIONS);
+
+	struct pthreadpool_nd_params params;
+	const size_t tile_range = init_nd_params(&params, num_dims, range, tile);
+
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || tile_range <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		struct tile_position position;
+		if (num_dims == 0) {
+			task(argument, position.start, position.size);
+		} else if (tile_range != 0) {
+			size_t dims_range[PTHREADPOOL_MAX_DIMENSIONS];
+			size_t dims_tile[PTHREADPOOL_MAX_DIMENSIONS];
+			for (size_t d = 0; d < num_dims; d++) {
+				dims_range[d] = params.dims[d].range;
+				dims_tile[d] = params.dims[d].tile;
+			}
+			decompose_tile_index(&params, num_dims, 0, position.start, position.size);
+			for (size_t t = 0; t < tile_range; t++) {
+				task(argument, position.start, position.size);
+				advance_tile_index(num_dims, dims_range, dims_tile, position.start, position.size);
+			}
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		thread_function_t parallelize_nd = &thread_parallelize_nd;
+		switch (num_dims) {
+			case 1:
+				parallelize_nd = &thread_parallelize_nd_1d;
+				break;
+			case 2:
+				parallelize_nd = &thread_parallelize_nd_2d;
+				break;
+			case 3:
+				parallelize_nd = &thread_parallelize_nd_3d;
+				break;
+			case 4:
+				parallelize_nd = &thread_parallelize_nd_4d;
+				break;
+			case 5:
+				parallelize_nd = &thread_parallelize_nd_5d;
+				break;
+			case 6:
+				parallelize_nd = &thread_parallelize_nd_6d;
+				break;
+		}
+		#if PTHREADPOOL_USE_FASTPATH
+			const size_t range_threshold = -threads_count;
+			if (tile_range < range_threshold) {
+				switch (num_dims) {
+					case 1:
+						parallelize_nd = &thread_parallelize_nd_1d_fastpath;
+						break;
+					case 2:
+						parallelize_nd = &thread_parallelize_nd_2d_fastpath;
+						break;
+					case 3:
+						parallelize_nd = &thread_parallelize_nd_3d_fastpath;
+						break;
+					case 4:
+						parallelize_nd = &thread_parallelize_nd_4d_fastpath;
+						break;
+					case 5:
+						parallelize_nd = &thread_parallelize_nd_5d_fastpath;
+						break;
+					case 6:
+						parallelize_nd = &thread_parallelize_nd_6d_fastpath;
+						break;
+					default:
+						parallelize_nd = &thread_parallelize_nd_fastpath;
+						break;
+				}
+			}
+		#endif
+		pthreadpool_parallelize(
+			threadpool, parallelize_nd, &params, get_nd_params_size(num_dims),
+			(void*) task, argument, tile_range, flags);
+	}
+}
+
+void pthreadpool_parallelize_nd_range(
+	pthreadpool_t threadpool,
+	pthreadpool_task_nd_range_t task,
+	void* argument,
+	size_t num_dims,
+	const size_t* range,
+	size_t alignment,
+	uint32_t flags)
+{
+	pthreadpool_reset_last_try_inline(flags);
+
+	assert(num_dims != 0);
+	assert(num_dims <= PTHREADPOOL_MAX_DIMENSIONS);
+
+	if (alignment == 0) {
+		alignment = 1;
+	}
+	struct pthreadpool_nd_range_params params;
+	/* Padding bytes are zeroed too, as PTHREADPOOL_FLAG_ADAPTIVE_PARTITION hashes the parameters */
+	memset(&params, 0, offsetof(struct pthreadpool_nd_range_params, outer));
+	const size_t rows = init_nd_params(&params.outer, num_dims - 1, range, NULL);
+	const size_t range_last = range[num_dims - 1];
+	const size_t aligned_range = divide_round_up(range_last, alignment);
+
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || rows * aligned_range <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		if (range_last != 0) {
+			size_t index[PTHREADPOOL_MAX_DIMENSIONS] = { 0 };
+			for (size_t r = 0; r < rows; r++) {
+				task(argument, index, 0, range_last);
+				advance_row_index(&params.outer, index);
+			}
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		params.range = range_last;
+		params.alignment = alignment;
+		params.aligned_range = fxdiv_init_size_t(aligned_range);
+		/* Chunks are reserved in shrinking batches, and each batch is passed to the task as runs within rows */
+		pthreadpool_parallelize(
+			threadpool, &thread_parallelize_nd_range, &params,
+			offsetof(struct pthreadpool_nd_range_params, outer) + get_nd_params_size(num_dims - 1),
+			(void*) task, argument, rows * aligned_range, flags | PTHREADPOOL_FLAG_BATCH_CLAIMS);
+	}
+}
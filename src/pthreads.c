@@ -106,9 +106,12 @@ static void wait_worker_threads(struct pthreadpool* threadpool) {
 		}
 	#endif
 
-	/* Spin-wait */
+	/* Spin-wait, helping with nested computations and task groups of the tasks which are still running */
 	for (uint32_t i = PTHREADPOOL_SPIN_WAIT_ITERATIONS; i != 0; i--) {
 		pthreadpool_yield();
+		if (!pthreadpool_help_nested_computation(threadpool)) {
+			pthreadpool_help_task_groups(threadpool);
+		}
 
 		#if PTHREADPOOL_USE_FUTEX
 			has_active_threads = pthreadpool_load_acquire_uint32_t(&threadpool->has_active_threads);
@@ -148,9 +151,12 @@ static uint32_t wait_for_new_command(
 	}
 
 	if ((last_flags & PTHREADPOOL_FLAG_YIELD_WORKERS) == 0) {
-		/* Spin-wait loop */
+		/* Spin-wait loop, helping with nested computations and task groups of the tasks which are still running */
 		for (uint32_t i = PTHREADPOOL_SPIN_WAIT_ITERATIONS; i != 0; i--) {
 			pthreadpool_yield();
+			if (!pthreadpool_help_nested_computation(threadpool)) {
+				pthreadpool_help_task_groups(threadpool);
+			}
 
 			command = pthreadpool_load_acquire_uint32_t(&threadpool->command);
 			if (command != last_command) {
@@ -186,6 +192,9 @@ static void* thread_main(void* arg) {
 	struct fpu_state saved_fpu_state = { 0 };
 	uint32_t flags = 0;
 
+	pthreadpool_pin_thread(thread);
+	pthreadpool_set_current_thread(thread);
+
 	/* Check in */
 	checkin_worker_thread(threadpool);
 
@@ -207,12 +216,21 @@ static void* thread_main(void* arg) {
 					disable_fpu_denormals();
 				}
 
-				thread_function(threadpool, thread);
+				struct thread_info* selected_thread = thread;
+				if (flags & PTHREADPOOL_FLAG_CPU_AFFINITY) {
+					selected_thread = pthreadpool_select_thread(threadpool, thread);
+				}
+				thread_function(threadpool, selected_thread);
 				if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 					set_fpu_state(saved_fpu_state);
 				}
 				break;
 			}
+			case threadpool_command_help:
+				/* Help with asynchronous jobs until all their items are claimed. No check in: nobody waits for it */
+				while (pthreadpool_help_nested_computation(threadpool) || pthreadpool_help_task_groups(threadpool));
+				last_command = command;
+				continue;
 			case threadpool_command_shutdown:
 				/* Exit immediately: the master thread is waiting on pthread_join */
 				return NULL;
@@ -227,7 +245,7 @@ static void* thread_main(void* arg) {
 	};
 }
 
-struct pthreadpool* pthreadpool_create(size_t threads_count) {
+static struct pthreadpool* create_threadpool(size_t threads_count, bool pin_threads) {
 	#if PTHREADPOOL_USE_CPUINFO
 		if (!cpuinfo_initialize()) {
 			return NULL;
@@ -264,6 +282,7 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 		threadpool->threads[tid].thread_number = tid;
 		threadpool->threads[tid].threadpool = threadpool;
 	}
+	pthreadpool_detect_topology(threadpool, pin_threads);
 
 	/* Thread pool with a single thread computes everything on the caller thread. */
 	if (threads_count > 1) {
@@ -291,6 +310,91 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 	return threadpool;
 }
 
+struct pthreadpool* pthreadpool_create(size_t threads_count) {
+	return create_threadpool(threads_count, false);
+}
+
+struct pthreadpool* pthreadpool_create_pinned(size_t threads_count) {
+	return create_threadpool(threads_count, true);
+}
+
+/*
+ * Computes the next command value. The bits outside of the command mask count the commands, so that a worker thread
+ * which missed some commands still observes a change of the command.
+ */
+static uint32_t next_command(uint32_t old_command, enum threadpool_command command) {
+	return ((old_command | THREADPOOL_COMMAND_MASK) + 1) | (uint32_t) command;
+}
+
+/*
+ * Wakes up the worker threads to help with published asynchronous jobs. Unless the worker threads are idle, another
+ * thread holds the execution mutex, and wakes up the worker threads once it releases the mutex.
+ */
+static void wake_idle_workers(struct pthreadpool* threadpool) {
+	if (pthread_mutex_trylock(&threadpool->execution_mutex) != 0) {
+		return;
+	}
+
+	#if PTHREADPOOL_USE_FUTEX
+		const uint32_t old_command = pthreadpool_load_relaxed_uint32_t(&threadpool->command);
+		pthreadpool_store_release_uint32_t(&threadpool->command, next_command(old_command, threadpool_command_help));
+		futex_wake_all(&threadpool->command);
+	#else
+		pthread_mutex_lock(&threadpool->command_mutex);
+		const uint32_t old_command = pthreadpool_load_relaxed_uint32_t(&threadpool->command);
+		pthreadpool_store_release_uint32_t(&threadpool->command, next_command(old_command, threadpool_command_help));
+		pthread_mutex_unlock(&threadpool->command_mutex);
+		pthread_cond_broadcast(&threadpool->command_condvar);
+	#endif
+
+	pthread_mutex_unlock(&threadpool->execution_mutex);
+}
+
+static void unlock_execution_mutex(struct pthreadpool* threadpool) {
+	pthread_mutex_unlock(&threadpool->execution_mutex);
+
+	/* Asynchronous jobs started while the mutex was locked couldn't wake up the worker threads */
+	if (pthreadpool_load_relaxed_void_p(&threadpool->nested_computations) != NULL) {
+		wake_idle_workers(threadpool);
+	}
+}
+
+/*
+ * Waits until idle threads of the thread pool process the concurrent computation. Once the caller of the running
+ * computation releases the execution mutex, helps to process the remaining items as worker #0. A task of the running
+ * computation helps to process the items in the thread information structure of its own thread.
+ */
+static void wait_concurrent_computation(
+	struct pthreadpool* threadpool,
+	struct pthreadpool* computation)
+{
+	struct thread_info* current_thread = pthreadpool_get_current_thread();
+	if (current_thread != NULL && current_thread->threadpool == threadpool) {
+		while (!pthreadpool_finish_concurrent_computation(threadpool, computation)) {
+			if (!pthreadpool_help_concurrent_computation(threadpool, computation, current_thread)) {
+				pthreadpool_yield();
+			}
+		}
+		return;
+	}
+
+	bool locked = false;
+	struct thread_info* previous_thread = NULL;
+	while (!pthreadpool_finish_concurrent_computation(threadpool, computation)) {
+		if (!locked && pthread_mutex_trylock(&threadpool->execution_mutex) == 0) {
+			locked = true;
+			previous_thread = pthreadpool_set_current_thread(&threadpool->threads[0]);
+		}
+		if (!locked || !pthreadpool_help_concurrent_computation(threadpool, computation, &threadpool->threads[0])) {
+			pthreadpool_yield();
+		}
+	}
+	if (locked) {
+		pthreadpool_set_current_thread(previous_thread);
+		unlock_execution_mutex(threadpool);
+	}
+}
+
 PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	struct pthreadpool* threadpool,
 	thread_function_t thread_function,
@@ -306,8 +410,37 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	assert(task != NULL);
 	assert(linear_range > 1);
 
-	/* Protect the global threadpool structures */
-	pthread_mutex_lock(&threadpool->execution_mutex);
+	/* A task of the current computation already holds the execution mutex */
+	struct thread_info* current_thread = pthreadpool_get_current_thread();
+	if (current_thread != NULL && current_thread->threadpool == threadpool) {
+		pthreadpool_parallelize_nested(
+			threadpool, current_thread, thread_function, params, params_size, task, context, linear_range, flags);
+		return;
+	}
+
+	if (flags & PTHREADPOOL_FLAG_TRY) {
+		const bool busy = pthread_mutex_trylock(&threadpool->execution_mutex) != 0;
+		pthreadpool_set_last_try_inline(busy);
+		if (busy) {
+			/* Thread number 0 matches the computations without a thread pool */
+			pthreadpool_parallelize_inline(0, thread_function, params, params_size, task, context, linear_range, flags);
+			return;
+		}
+	} else if (flags & PTHREADPOOL_FLAG_CONCURRENT_JOBS) {
+		if (pthread_mutex_trylock(&threadpool->execution_mutex) != 0) {
+			struct pthreadpool* computation = pthreadpool_start_concurrent_computation(
+				threadpool, thread_function, params, params_size, task, context, linear_range, flags, false, NULL, NULL);
+			if (computation != NULL) {
+				wait_concurrent_computation(threadpool, computation);
+				return;
+			}
+			pthread_mutex_lock(&threadpool->execution_mutex);
+		}
+	} else {
+		/* Protect the global threadpool structures */
+		pthread_mutex_lock(&threadpool->execution_mutex);
+	}
+	struct thread_info* previous_thread = pthreadpool_set_current_thread(&threadpool->threads[0]);
 
 	#if !PTHREADPOOL_USE_FUTEX
 		/* Lock the command variables to ensure that threads don't start processing before they observe complete command with all arguments */
@@ -333,29 +466,16 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	}
 
 	/* Spread the work between threads */
-	const struct fxdiv_result_size_t range_params = fxdiv_divide_size_t(linear_range, threads_count);
-	size_t range_start = 0;
-	for (size_t tid = 0; tid < threads_count.value; tid++) {
-		struct thread_info* thread = &threadpool->threads[tid];
-		const size_t range_length = range_params.quotient + (size_t) (tid < range_params.remainder);
-		const size_t range_end = range_start + range_length;
-		pthreadpool_store_relaxed_size_t(&thread->range_start, range_start);
-		pthreadpool_store_relaxed_size_t(&thread->range_end, range_end);
-		pthreadpool_store_relaxed_size_t(&thread->range_length, range_length);
-
-		/* The next subrange starts where the previous ended */
-		range_start = range_end;
-	}
+	pthreadpool_assign_ranges(threadpool, linear_range, params_size, flags);
 
 	/*
 	 * Update the threadpool command.
 	 * Imporantly, do it after initializing command parameters (range, task, argument, flags)
-	 * ~(threadpool->command | THREADPOOL_COMMAND_MASK) flips the bits not in command mask
-	 * to ensure the unmasked command is different then the last command, because worker threads
-	 * monitor for change in the unmasked command.
+	 * next_command increments the bits not in command mask to ensure the unmasked command is
+	 * different then the last command, because worker threads monitor for change in the unmasked command.
 	 */
 	const uint32_t old_command = pthreadpool_load_relaxed_uint32_t(&threadpool->command);
-	const uint32_t new_command = ~(old_command | THREADPOOL_COMMAND_MASK) | threadpool_command_parallelize;
+	const uint32_t new_command = next_command(old_command, threadpool_command_parallelize);
 
 	/*
 	 * Store the command with release semantics to guarantee that if a worker thread observes
@@ -384,7 +504,11 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	}
 
 	/* Do computations as worker #0 */
-	thread_function(threadpool, &threadpool->threads[0]);
+	struct thread_info* thread = &threadpool->threads[0];
+	if (flags & PTHREADPOOL_FLAG_CPU_AFFINITY) {
+		thread = pthreadpool_select_thread(threadpool, thread);
+	}
+	thread_function(threadpool, thread);
 
 	/* Restore FPU denormals control, if needed */
 	if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
@@ -398,7 +522,40 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	pthreadpool_fence_acquire();
 
 	/* Unprotect the global threadpool structures */
-	pthread_mutex_unlock(&threadpool->execution_mutex);
+	pthreadpool_set_current_thread(previous_thread);
+	unlock_execution_mutex(threadpool);
+}
+
+PTHREADPOOL_INTERNAL struct pthreadpool_job* pthreadpool_parallelize_async(
+	struct pthreadpool* threadpool,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	uint32_t flags)
+{
+	assert(threadpool != NULL);
+	assert(thread_function != NULL);
+	assert(task != NULL);
+	assert(linear_range > 1);
+
+	struct pthreadpool* computation = pthreadpool_start_concurrent_computation(
+		threadpool, thread_function, params, params_size, task, context, linear_range, flags, true, NULL, NULL);
+	if (computation == NULL) {
+		pthreadpool_parallelize(threadpool, thread_function, params, params_size, task, context, linear_range, flags);
+		return NULL;
+	}
+	wake_idle_workers(threadpool);
+	return (struct pthreadpool_job*) computation;
+}
+
+void pthreadpool_wait(pthreadpool_job_t job) {
+	if (job != NULL) {
+		struct pthreadpool* computation = (struct pthreadpool*) job;
+		wait_concurrent_computation(computation->parent_threadpool, computation);
+	}
 }
 
 void pthreadpool_destroy(struct pthreadpool* threadpool) {
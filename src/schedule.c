@@ -0,0 +1,285 @@
+/* Standard C headers */
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* Dependencies */
+#include <fxdiv.h>
+
+/* Library header */
+#include <pthreadpool.h>
+
+/* Internal library headers */
+#include "threadpool-atomics.h"
+#include "threadpool-common.h"
+#include "threadpool-object.h"
+#include "threadpool-utils.h"
+
+
+/* FNV-1a hash of the parameters of a parallelization function */
+static size_t hash_params(const void* params, size_t params_size) {
+	const uint8_t* bytes = (const uint8_t*) params;
+	uint32_t hash = UINT32_C(2166136261);
+	for (size_t i = 0; i < params_size; i++) {
+		hash = (hash ^ (uint32_t) bytes[i]) * UINT32_C(16777619);
+	}
+	return (size_t) hash;
+}
+
+PTHREADPOOL_INTERNAL size_t pthreadpool_find_weight_boundary(
+	const size_t* cumulative_weights,
+	size_t start,
+	size_t end,
+	size_t weight)
+{
+	while (start != end) {
+		const size_t middle = start + (end - start) / 2;
+		/* Total weight of elements before boundary middle + 1 */
+		if (cumulative_weights[middle] >= weight) {
+			end = middle;
+		} else {
+			start = middle + 1;
+		}
+	}
+	return start;
+}
+
+/* Returns the share of the total which corresponds to threads 0..thread_number */
+static uint64_t get_share(const struct pthreadpool* threadpool, uint64_t total, size_t thread_number) {
+	uint64_t numerator = (uint64_t) thread_number + 1;
+	uint64_t denominator = (uint64_t) threadpool->threads_count.value;
+	if (threadpool->total_capacity != 0) {
+		numerator = threadpool->threads[thread_number].capacity_end;
+		denominator = threadpool->total_capacity;
+	}
+	/* The denominator fits into 32 bits, so the remainder times the numerator fits into 64 bits */
+	return total / denominator * numerator + total % denominator * numerator / denominator;
+}
+
+/*
+ * Returns the end of the initial range of the thread. Items are split in proportion to the capacities of threads, or
+ * evenly if all threads have equal capacities. With item weights, the weight rather than the number of items is split.
+ */
+static size_t get_range_end(
+	const struct pthreadpool* threadpool,
+	struct fxdiv_result_size_t even_split,
+	size_t linear_range,
+	const size_t* cumulative_weights,
+	size_t thread_number)
+{
+	if (cumulative_weights != NULL) {
+		if (thread_number + 1 == threadpool->threads_count.value) {
+			return linear_range;
+		}
+		const size_t weight_end = (size_t) get_share(threadpool, cumulative_weights[linear_range - 1], thread_number);
+		return pthreadpool_find_weight_boundary(cumulative_weights, 0, linear_range, weight_end);
+	} else if (threadpool->total_capacity == 0) {
+		const size_t threads_before = thread_number + 1;
+		return even_split.quotient * threads_before + min(threads_before, even_split.remainder);
+	} else {
+		return (size_t) get_share(threadpool, linear_range, thread_number);
+	}
+}
+
+static void split_range(
+	const struct pthreadpool* threadpool,
+	size_t linear_range,
+	const size_t* cumulative_weights,
+	size_t* range_lengths)
+{
+	const struct fxdiv_result_size_t even_split = fxdiv_divide_size_t(linear_range, threadpool->threads_count);
+	const size_t threads_count = threadpool->threads_count.value;
+	size_t range_start = 0;
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		const size_t range_end = get_range_end(threadpool, even_split, linear_range, cumulative_weights, tid);
+		range_lengths[tid] = range_end - range_start;
+		range_start = range_end;
+	}
+}
+
+/*
+ * Moves the boundaries between the ranges of the last computation with PTHREADPOOL_FLAG_ADAPTIVE_PARTITION: a thread
+ * which processed items stolen from other threads gets a longer range, and a thread whose items were stolen gets a
+ * shorter range. Only half of the difference is applied to damp oscillations.
+ */
+static void update_history(struct pthreadpool* threadpool, struct pthreadpool_history* history) {
+	const size_t threads_count = threadpool->threads_count.value;
+	size_t* range_lengths = &history->range_lengths[history->last_entry * threads_count];
+
+	/*
+	 * New boundaries are B[t] = sum(L[u] + (stolen_by[u] - stolen_from[u]) / 2 for u < t). The doubled sums are never
+	 * negative because stolen_from[u] <= L[u], and increase monotonically, so new lengths are never negative either.
+	 * Every stolen item is processed by exactly one thread, thus the last boundary stays at linear_range, but clamp it
+	 * anyway to never assign items outside the range.
+	 */
+	const size_t linear_range = history->entries[history->last_entry].linear_range;
+	size_t range_end = 0;
+	size_t doubled_boundary = 0;
+	size_t boundary = 0;
+	for (size_t tid = 0; tid + 1 < threads_count; tid++) {
+		struct thread_info* thread = &threadpool->threads[tid];
+		range_end += range_lengths[tid];
+		const size_t stolen_from = range_end - pthreadpool_load_relaxed_size_t(&thread->range_end);
+		doubled_boundary += 2 * range_lengths[tid] + thread->stolen_items - stolen_from;
+		size_t next_boundary = doubled_boundary / 2;
+		if (next_boundary > linear_range) {
+			next_boundary = linear_range;
+		}
+		range_lengths[tid] = next_boundary - boundary;
+		boundary = next_boundary;
+	}
+	range_lengths[threads_count - 1] = linear_range - boundary;
+}
+
+/* Returns the range lengths to use for the computation described by the thread pool fields */
+static const size_t* lookup_history(
+	struct pthreadpool* threadpool,
+	size_t linear_range,
+	size_t params_size,
+	const size_t* cumulative_weights)
+{
+	const size_t threads_count = threadpool->threads_count.value;
+	struct pthreadpool_history* history = threadpool->history;
+	if (history == NULL) {
+		history = calloc(1, sizeof(struct pthreadpool_history) +
+			PTHREADPOOL_HISTORY_ENTRIES * threads_count * sizeof(size_t));
+		if (history == NULL) {
+			return NULL;
+		}
+		history->last_entry = PTHREADPOOL_HISTORY_ENTRIES;
+		threadpool->history = history;
+	} else if (history->last_entry != PTHREADPOOL_HISTORY_ENTRIES) {
+		update_history(threadpool, history);
+	}
+
+	const struct pthreadpool_history_entry key = {
+		.thread_function = pthreadpool_load_relaxed_void_p(&threadpool->thread_function),
+		.task = pthreadpool_load_relaxed_void_p(&threadpool->task),
+		.linear_range = linear_range,
+		.params_hash = hash_params(&threadpool->params, params_size),
+	};
+	const size_t entry_index =
+		(key.params_hash ^ (size_t) (uintptr_t) key.task ^ ((size_t) (uintptr_t) key.thread_function >> 4)) %
+			PTHREADPOOL_HISTORY_ENTRIES;
+	struct pthreadpool_history_entry* entry = &history->entries[entry_index];
+	size_t* range_lengths = &history->range_lengths[entry_index * threads_count];
+	if (entry->thread_function != key.thread_function || entry->task != key.task ||
+		entry->linear_range != key.linear_range || entry->params_hash != key.params_hash)
+	{
+		/* New computation replaces the old one */
+		*entry = key;
+		split_range(threadpool, linear_range, cumulative_weights, range_lengths);
+	}
+	history->last_entry = entry_index;
+	return range_lengths;
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_assign_ranges(
+	struct pthreadpool* threadpool,
+	size_t linear_range,
+	size_t params_size,
+	uint32_t flags)
+{
+	assert(threadpool != NULL);
+
+	const size_t threads_count = threadpool->threads_count.value;
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		threadpool->threads[tid].stolen_items = 0;
+		pthreadpool_store_relaxed_size_t(&threadpool->threads[tid].affinity_claimed, 0);
+	}
+	if (flags & PTHREADPOOL_FLAG_CPU_AFFINITY) {
+		pthreadpool_detect_cpu_caches(threadpool);
+	}
+
+	const bool adaptive_partition = (flags & PTHREADPOOL_FLAG_ADAPTIVE_PARTITION) &&
+		!(flags & (PTHREADPOOL_FLAG_STATIC_SCHEDULE | PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE | PTHREADPOOL_FLAG_GUIDED_SCHEDULE));
+	const size_t* cumulative_weights = NULL;
+	if (flags & PTHREADPOOL_FLAG_WEIGHTED_ITEMS) {
+		cumulative_weights = threadpool->params.parallelize_1d_weighted.cumulative_weights;
+	}
+
+	const size_t* range_lengths = NULL;
+	if (adaptive_partition) {
+		range_lengths = lookup_history(threadpool, linear_range, params_size, cumulative_weights);
+	} else if (threadpool->history != NULL) {
+		if (threadpool->history->last_entry != PTHREADPOOL_HISTORY_ENTRIES) {
+			update_history(threadpool, threadpool->history);
+		}
+		threadpool->history->last_entry = PTHREADPOOL_HISTORY_ENTRIES;
+	}
+
+	if (flags & (PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE | PTHREADPOOL_FLAG_GUIDED_SCHEDULE)) {
+		/* All items are claimed from the shared counter, threads don't own any items */
+		for (size_t tid = 0; tid < threads_count; tid++) {
+			struct thread_info* thread = &threadpool->threads[tid];
+			pthreadpool_store_relaxed_size_t(&thread->range_start, 0);
+			pthreadpool_store_relaxed_size_t(&thread->range_end, 0);
+			pthreadpool_store_relaxed_size_t(&thread->range_length, 0);
+		}
+		threadpool->shared_items = linear_range;
+		threadpool->shared_chunk = 1;
+		if (flags & PTHREADPOOL_FLAG_BATCH_CLAIMS) {
+			/* Claim a fraction of the batch which a thread would reserve from its own range at the start */
+			threadpool->shared_chunk = linear_range / (threads_count * PTHREADPOOL_CLAIM_BATCH_DIVISOR) + 1;
+		}
+		pthreadpool_store_relaxed_size_t(&threadpool->remaining_items.value, linear_range);
+	} else {
+		/* Spread the work between threads */
+		const struct fxdiv_result_size_t even_split = fxdiv_divide_size_t(linear_range, threadpool->threads_count);
+		size_t range_start = 0;
+		for (size_t tid = 0; tid < threads_count; tid++) {
+			struct thread_info* thread = &threadpool->threads[tid];
+			size_t range_end;
+			if (range_lengths != NULL) {
+				range_end = range_start + range_lengths[tid];
+			} else {
+				range_end = get_range_end(threadpool, even_split, linear_range, cumulative_weights, tid);
+			}
+			const size_t range_length = range_end - range_start;
+			pthreadpool_store_relaxed_size_t(&thread->range_start, range_start);
+			pthreadpool_store_relaxed_size_t(&thread->range_end, range_end);
+			pthreadpool_store_relaxed_size_t(&thread->range_length, range_length);
+
+			/* The next subrange starts where the previous ended */
+			range_start = range_end;
+		}
+	}
+	pthreadpool_mark_busy_threads(threadpool);
+}
+
+PTHREADPOOL_INTERNAL bool pthreadpool_claim_shared_items(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread,
+	size_t* index)
+{
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+	assert(index != NULL);
+
+	pthreadpool_atomic_size_t* remaining_items = &threadpool->remaining_items.value;
+	const size_t remaining = pthreadpool_load_relaxed_size_t(remaining_items);
+	/* Threads don't subtract from an exhausted counter, thus it wraps around by at most a chunk per thread */
+	if (!pthreadpool_has_shared_items(threadpool, remaining)) {
+		return false;
+	}
+	size_t chunk = threadpool->shared_chunk;
+	if (pthreadpool_load_relaxed_uint32_t(&threadpool->flags) & PTHREADPOOL_FLAG_GUIDED_SCHEDULE) {
+		/* Guided chunks are proportional to the number of remaining items per thread */
+		chunk = remaining / threadpool->threads_count.value + 1;
+	}
+
+	/* Chunks claimed concurrently may exceed the remaining items, then the last chunk is truncated */
+	const size_t old_remaining = pthreadpool_fetch_sub_relaxed_size_t(remaining_items, chunk);
+	if (!pthreadpool_has_shared_items(threadpool, old_remaining)) {
+		return false;
+	}
+	const size_t claimed = chunk < old_remaining ? chunk : old_remaining;
+
+	/* Items are processed from the end of the claimed chunk, like items in the stolen range */
+	*index = old_remaining - 1;
+	thread->stash_batch_end = old_remaining - 1;
+	thread->stash_batch_length = claimed - 1;
+	return true;
+}
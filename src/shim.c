@@ -1,5 +1,6 @@
 /* Standard C headers */
 #include <stddef.h>
+#include <stdlib.h>
 
 /* Public library header */
 #include <pthreadpool.h>
@@ -22,10 +23,24 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 	return NULL;
 }
 
+struct pthreadpool* pthreadpool_create_pinned(size_t threads_count) {
+	return pthreadpool_create(threads_count);
+}
+
 size_t pthreadpool_get_threads_count(struct pthreadpool* threadpool) {
 	return 1;
 }
 
+int pthreadpool_last_try_ran_inline(void) {
+	return 0;
+}
+
+void pthreadpool_set_thread_capacities(
+	struct pthreadpool* threadpool,
+	const uint32_t* capacities)
+{
+}
+
 void pthreadpool_parallelize_1d(
 	struct pthreadpool* threadpool,
 	pthreadpool_task_1d_t task,
@@ -38,6 +53,30 @@ void pthreadpool_parallelize_1d(
 	}
 }
 
+pthreadpool_job_t pthreadpool_parallelize_1d_async(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags)
+{
+	pthreadpool_parallelize_1d(threadpool, task, argument, range, flags);
+	return NULL;
+}
+
+void pthreadpool_parallelize_1d_weighted(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	const size_t* cumulative_weights,
+	size_t range,
+	uint32_t flags)
+{
+	for (size_t i = 0; i < range; i++) {
+		task(argument, i);
+	}
+}
+
 void pthreadpool_parallelize_1d_with_thread(
 	struct pthreadpool* threadpool,
 	pthreadpool_task_1d_with_thread_t task,
@@ -77,6 +116,130 @@ void pthreadpool_parallelize_1d_tile_1d(
 	}
 }
 
+void pthreadpool_parallelize_1d_tile_1d_pipeline(
+	pthreadpool_t threadpool,
+	const pthreadpool_task_1d_tile_1d_t* stages,
+	size_t stages_count,
+	void* argument,
+	size_t range,
+	size_t tile,
+	uint32_t flags)
+{
+	for (size_t i = 0; i < range; i += tile) {
+		for (size_t stage = 0; stage < stages_count; stage++) {
+			stages[stage](argument, i, min(range - i, tile));
+		}
+	}
+}
+
+void pthreadpool_parallelize_1d_range(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_range_t task,
+	void* argument,
+	size_t range,
+	size_t alignment,
+	uint32_t flags)
+{
+	if (range != 0) {
+		task(argument, 0, range);
+	}
+}
+
+void pthreadpool_parallelize_1d_indexed(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	const size_t* indices,
+	size_t count,
+	uint32_t flags)
+{
+	for (size_t p = 0; p < count; p++) {
+		task(argument, indices[p]);
+	}
+}
+
+void pthreadpool_parallelize_1d_indexed_u32(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	const uint32_t* indices,
+	size_t count,
+	uint32_t flags)
+{
+	for (size_t p = 0; p < count; p++) {
+		task(argument, (size_t) indices[p]);
+	}
+}
+
+void pthreadpool_parallelize_1d_indexed_tile_1d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_indexed_tile_1d_t task,
+	void* argument,
+	const size_t* indices,
+	size_t count,
+	size_t tile,
+	uint32_t flags)
+{
+	for (size_t p = 0; p < count; p += tile) {
+		task(argument, indices + p, min(count - p, tile));
+	}
+}
+
+void pthreadpool_parallelize_1d_indexed_u32_tile_1d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_indexed_u32_tile_1d_t task,
+	void* argument,
+	const uint32_t* indices,
+	size_t count,
+	size_t tile,
+	uint32_t flags)
+{
+	for (size_t p = 0; p < count; p += tile) {
+		task(argument, indices + p, min(count - p, tile));
+	}
+}
+
+void pthreadpool_parallelize_ragged_2d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_ragged_2d_t task,
+	void* argument,
+	const size_t* row_offsets,
+	size_t rows,
+	uint32_t flags)
+{
+	for (size_t i = 0; i < rows; i++) {
+		const size_t row_length = row_offsets[i + 1] - row_offsets[i];
+		for (size_t k = 0; k < row_length; k++) {
+			task(argument, i, k);
+		}
+	}
+}
+
+void pthreadpool_parallelize_ragged_2d_tile_1d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_ragged_2d_tile_1d_t task,
+	void* argument,
+	const size_t* row_offsets,
+	size_t rows,
+	size_t tile,
+	uint32_t flags)
+{
+	/* Tiles are split at row boundaries, and the first segment of a row continues the last tile of the previous row */
+	size_t tile_remaining = tile;
+	for (size_t i = 0; i < rows; i++) {
+		const size_t row_length = row_offsets[i + 1] - row_offsets[i];
+		for (size_t k = 0; k < row_length; ) {
+			const size_t count = min(row_length - k, tile_remaining);
+			task(argument, i, k, count);
+			k += count;
+			tile_remaining -= count;
+			if (tile_remaining == 0) {
+				tile_remaining = tile;
+			}
+		}
+	}
+}
+
 void pthreadpool_parallelize_2d(
 	struct pthreadpool* threadpool,
 	pthreadpool_task_2d_t task,
@@ -92,6 +255,18 @@ void pthreadpool_parallelize_2d(
 	}
 }
 
+pthreadpool_job_t pthreadpool_parallelize_2d_async(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags)
+{
+	pthreadpool_parallelize_2d(threadpool, task, argument, range_i, range_j, flags);
+	return NULL;
+}
+
 void pthreadpool_parallelize_2d_with_thread(
 	struct pthreadpool* threadpool,
 	pthreadpool_task_2d_with_thread_t task,
@@ -123,6 +298,22 @@ void pthreadpool_parallelize_2d_tile_1d(
 	}
 }
 
+void pthreadpool_parallelize_2d_range(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_range_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t alignment_j,
+	uint32_t flags)
+{
+	if (range_j != 0) {
+		for (size_t i = 0; i < range_i; i++) {
+			task(argument, i, 0, range_j);
+		}
+	}
+}
+
 void pthreadpool_parallelize_2d_tile_1d_with_uarch(
 	pthreadpool_t threadpool,
 	pthreadpool_task_2d_tile_1d_with_id_t task,
@@ -176,6 +367,66 @@ void pthreadpool_parallelize_2d_tile_2d(
 	}
 }
 
+pthreadpool_job_t pthreadpool_parallelize_2d_tile_2d_async(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
+	uint32_t flags)
+{
+	pthreadpool_parallelize_2d_tile_2d(threadpool, task, argument, range_i, range_j, tile_i, tile_j, flags);
+	return NULL;
+}
+
+void pthreadpool_parallelize_2d_triangular(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags)
+{
+	for (size_t j = 0; j < range; j++) {
+		for (size_t i = 0; i <= j; i++) {
+			task(argument, i, j);
+		}
+	}
+}
+
+void pthreadpool_parallelize_2d_tile_2d_triangular(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_2d_t task,
+	void* argument,
+	size_t range,
+	size_t tile,
+	uint32_t flags)
+{
+	for (size_t j = 0; j < range; j += tile) {
+		for (size_t i = 0; i <= j; i += tile) {
+			task(argument, i, j, min(range - i, tile), min(range - j, tile));
+		}
+	}
+}
+
+void pthreadpool_parallelize_2d_tile_2d_wavefront(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
+	uint32_t flags)
+{
+	for (size_t i = 0; i < range_i; i += tile_i) {
+		for (size_t j = 0; j < range_j; j += tile_j) {
+			task(argument, i, j, min(range_i - i, tile_i), min(range_j - j, tile_j));
+		}
+	}
+}
+
 void pthreadpool_parallelize_2d_tile_2d_with_uarch(
 	pthreadpool_t threadpool,
 	pthreadpool_task_2d_tile_2d_with_id_t task,
@@ -592,5 +843,246 @@ void pthreadpool_parallelize_6d_tile_2d(
 	}
 }
 
+void pthreadpool_parallelize_nd(
+	pthreadpool_t threadpool,
+	pthreadpool_task_nd_t task,
+	void* argument,
+	size_t num_dims,
+	const size_t* range,
+	const size_t* tile,
+	uint32_t flags)
+{
+	size_t index[PTHREADPOOL_MAX_DIMENSIONS] = { 0 };
+	size_t tile_size[PTHREADPOOL_MAX_DIMENSIONS] = { 0 };
+	for (size_t d = 0; d < num_dims; d++) {
+		if (range[d] == 0) {
+			return;
+		}
+		tile_size[d] = min(range[d], tile != NULL ? tile[d] : 1);
+	}
+	size_t d;
+	do {
+		task(argument, index, tile_size);
+		/* Advance to the next tile in row-major order, and stop after the last dimension wraps around */
+		for (d = num_dims; d != 0; d--) {
+			const size_t dim_tile = tile != NULL ? tile[d - 1] : 1;
+			index[d - 1] += dim_tile;
+			if (index[d - 1] < range[d - 1]) {
+				tile_size[d - 1] = min(range[d - 1] - index[d - 1], dim_tile);
+				break;
+			}
+			index[d - 1] = 0;
+			tile_size[d - 1] = min(range[d - 1], dim_tile);
+		}
+	} while (d != 0);
+}
+
+void pthreadpool_parallelize_nd_range(
+	pthreadpool_t threadpool,
+	pthreadpool_task_nd_range_t task,
+	void* argument,
+	size_t num_dims,
+	const size_t* range,
+	size_t alignment,
+	uint32_t flags)
+{
+	size_t index[PTHREADPOOL_MAX_DIMENSIONS] = { 0 };
+	for (size_t d = 0; d < num_dims; d++) {
+		if (range[d] == 0) {
+			return;
+		}
+	}
+	size_t d;
+	do {
+		task(argument, index, 0, range[num_dims - 1]);
+		/* Advance to the next row in row-major order, and stop after the first dimension wraps around */
+		for (d = num_dims - 1; d != 0; d--) {
+			if (++index[d - 1] < range[d - 1]) {
+				break;
+			}
+			index[d - 1] = 0;
+		}
+	} while (d != 0);
+}
+
+void pthreadpool_wait(pthreadpool_job_t job) {
+}
+
+int pthreadpool_test(pthreadpool_job_t job) {
+	return 1;
+}
+
+int pthreadpool_get_job_fd(pthreadpool_job_t job) {
+	return -1;
+}
+
+struct pthreadpool_graph_node {
+	void (*run)(const struct pthreadpool_graph_node* node);
+	void* task;
+	void* context;
+	size_t range_i;
+	size_t range_j;
+	size_t tile_i;
+	size_t tile_j;
+	uint32_t flags;
+};
+
+struct pthreadpool_graph {
+	struct pthreadpool_graph_node* nodes;
+	size_t nodes_count;
+	size_t nodes_capacity;
+};
+
+pthreadpool_graph_t pthreadpool_graph_create(void) {
+	return calloc(1, sizeof(struct pthreadpool_graph));
+}
+
+static size_t add_node(
+	struct pthreadpool_graph* graph,
+	const struct pthreadpool_graph_node* node)
+{
+	if (graph->nodes_count == graph->nodes_capacity) {
+		const size_t nodes_capacity = graph->nodes_capacity != 0 ? graph->nodes_capacity * 2 : 16;
+		struct pthreadpool_graph_node* nodes = realloc(graph->nodes, nodes_capacity * sizeof(struct pthreadpool_graph_node));
+		if (nodes == NULL) {
+			return PTHREADPOOL_GRAPH_NODE_NONE;
+		}
+		graph->nodes = nodes;
+		graph->nodes_capacity = nodes_capacity;
+	}
+	graph->nodes[graph->nodes_count] = *node;
+	return graph->nodes_count++;
+}
+
+static void run_node_1d(const struct pthreadpool_graph_node* node) {
+	pthreadpool_parallelize_1d(NULL, (pthreadpool_task_1d_t) node->task, node->context,
+		node->range_i, node->flags);
+}
+
+size_t pthreadpool_graph_add_1d(
+	pthreadpool_graph_t graph,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags)
+{
+	const struct pthreadpool_graph_node node = {
+		.run = run_node_1d, .task = (void*) task, .context = argument, .range_i = range, .flags = flags,
+	};
+	return add_node(graph, &node);
+}
+
+static void run_node_1d_tile_1d(const struct pthreadpool_graph_node* node) {
+	pthreadpool_parallelize_1d_tile_1d(NULL, (pthreadpool_task_1d_tile_1d_t) node->task, node->context,
+		node->range_i, node->tile_i, node->flags);
+}
+
+size_t pthreadpool_graph_add_1d_tile_1d(
+	pthreadpool_graph_t graph,
+	pthreadpool_task_1d_tile_1d_t task,
+	void* argument,
+	size_t range,
+	size_t tile,
+	uint32_t flags)
+{
+	const struct pthreadpool_graph_node node = {
+		.run = run_node_1d_tile_1d, .task = (void*) task, .context = argument,
+		.range_i = range, .tile_i = tile, .flags = flags,
+	};
+	return add_node(graph, &node);
+}
+
+static void run_node_2d(const struct pthreadpool_graph_node* node) {
+	pthreadpool_parallelize_2d(NULL, (pthreadpool_task_2d_t) node->task, node->context,
+		node->range_i, node->range_j, node->flags);
+}
+
+size_t pthreadpool_graph_add_2d(
+	pthreadpool_graph_t graph,
+	pthreadpool_task_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags)
+{
+	const struct pthreadpool_graph_node node = {
+		.run = run_node_2d, .task = (void*) task, .context = argument,
+		.range_i = range_i, .range_j = range_j, .flags = flags,
+	};
+	return add_node(graph, &node);
+}
+
+static void run_node_2d_tile_2d(const struct pthreadpool_graph_node* node) {
+	pthreadpool_parallelize_2d_tile_2d(NULL, (pthreadpool_task_2d_tile_2d_t) node->task, node->context,
+		node->range_i, node->range_j, node->tile_i, node->tile_j, node->flags);
+}
+
+size_t pthreadpool_graph_add_2d_tile_2d(
+	pthreadpool_graph_t graph,
+	pthreadpool_task_2d_tile_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
+	uint32_t flags)
+{
+	const struct pthreadpool_graph_node node = {
+		.run = run_node_2d_tile_2d, .task = (void*) task, .context = argument,
+		.range_i = range_i, .range_j = range_j, .tile_i = tile_i, .tile_j = tile_j, .flags = flags,
+	};
+	return add_node(graph, &node);
+}
+
+int pthreadpool_graph_add_dependency(
+	pthreadpool_graph_t graph,
+	size_t predecessor,
+	size_t successor)
+{
+	/* Nodes run in the order they were added, which satisfies all valid dependencies */
+	return graph != NULL && predecessor < successor && successor < graph->nodes_count;
+}
+
+void pthreadpool_graph_run(
+	pthreadpool_t threadpool,
+	pthreadpool_graph_t graph,
+	uint32_t flags)
+{
+	for (size_t i = 0; i < graph->nodes_count; i++) {
+		graph->nodes[i].run(&graph->nodes[i]);
+	}
+}
+
+void pthreadpool_graph_destroy(pthreadpool_graph_t graph) {
+	if (graph != NULL) {
+		free(graph->nodes);
+		free(graph);
+	}
+}
+
+/* Tasks run as soon as they are spawned, so task groups have no state */
+struct pthreadpool_task_group {
+	char unused;
+};
+
+pthreadpool_task_group_t pthreadpool_task_group_create(pthreadpool_t threadpool) {
+	return calloc(1, sizeof(struct pthreadpool_task_group));
+}
+
+void pthreadpool_task_group_spawn(
+	pthreadpool_task_group_t group,
+	pthreadpool_spawn_task_t function,
+	void* context)
+{
+	function(context);
+}
+
+void pthreadpool_task_group_wait(pthreadpool_task_group_t group) {
+}
+
+void pthreadpool_task_group_destroy(pthreadpool_task_group_t group) {
+	free(group);
+}
+
 void pthreadpool_destroy(struct pthreadpool* threadpool) {
 }
@@ -0,0 +1,344 @@
+/* Standard C headers */
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* Library header */
+#include <pthreadpool.h>
+
+/* Internal library headers */
+#include "threadpool-atomics.h"
+#include "threadpool-common.h"
+#include "threadpool-object.h"
+#include "threadpool-utils.h"
+
+
+struct task_descriptor {
+	pthreadpool_spawn_task_t function;
+	void* context;
+	struct pthreadpool_task_group* group;
+};
+
+struct pthreadpool_task_group {
+	/**
+	 * The thread pool which runs the tasks, or NULL if tasks run as soon as they are spawned.
+	 */
+	struct pthreadpool* threadpool;
+	/**
+	 * The number of spawned tasks which didn't complete yet.
+	 */
+	pthreadpool_atomic_size_t pending_tasks;
+	/**
+	 * Tasks spawned outside of the tasks of the thread pool, which start when the group is waited for. Modified only
+	 * by the thread which created the group, and only while the group is not waited for.
+	 */
+	struct task_descriptor* deferred_tasks;
+	size_t deferred_tasks_count;
+	size_t deferred_tasks_capacity;
+	/**
+	 * Index of the next deferred task to start in the current wait.
+	 */
+	pthreadpool_atomic_size_t next_deferred_task;
+};
+
+static size_t fetch_increment_relaxed(pthreadpool_atomic_size_t* value) {
+	size_t actual_value = pthreadpool_load_relaxed_size_t(value);
+	while (!pthreadpool_compare_exchange_relaxed_size_t(value, &actual_value, actual_value + 1));
+	return actual_value;
+}
+
+static bool push_task(
+	struct pthreadpool_task_deque* deque,
+	const struct task_descriptor* task)
+{
+	const size_t bottom = pthreadpool_load_relaxed_size_t(&deque->bottom.value);
+	const size_t top = pthreadpool_load_acquire_size_t(&deque->top.value);
+	if (bottom - top >= PTHREADPOOL_TASK_DEQUE_CAPACITY) {
+		return false;
+	}
+
+	struct pthreadpool_task* slot = &deque->tasks[bottom % PTHREADPOOL_TASK_DEQUE_CAPACITY];
+	pthreadpool_store_relaxed_void_p(&slot->function, (void*) task->function);
+	pthreadpool_store_relaxed_void_p(&slot->context, task->context);
+	pthreadpool_store_relaxed_void_p(&slot->group, task->group);
+	/* Thieves which observe any later value of bottom also observe the task */
+	pthreadpool_fence_release();
+	pthreadpool_store_relaxed_size_t(&deque->bottom.value, bottom + 1);
+	return true;
+}
+
+static void load_task(
+	struct pthreadpool_task* slot,
+	struct task_descriptor* task)
+{
+	task->function = (pthreadpool_spawn_task_t) pthreadpool_load_relaxed_void_p(&slot->function);
+	task->context = pthreadpool_load_relaxed_void_p(&slot->context);
+	task->group = (struct pthreadpool_task_group*) pthreadpool_load_relaxed_void_p(&slot->group);
+}
+
+/* Takes the newest task from the deque. Must be called only by the owning thread. */
+static bool pop_task(
+	struct pthreadpool_task_deque* deque,
+	struct task_descriptor* task)
+{
+	const size_t bottom = pthreadpool_load_relaxed_size_t(&deque->bottom.value);
+	size_t top = pthreadpool_load_relaxed_size_t(&deque->top.value);
+	if (top == bottom) {
+		return false;
+	}
+
+	/* Reserve the newest task before checking whether thieves took it: the fence pairs with the one in steal_task */
+	const size_t new_bottom = bottom - 1;
+	pthreadpool_store_relaxed_size_t(&deque->bottom.value, new_bottom);
+	pthreadpool_fence_seq_cst();
+	top = pthreadpool_load_relaxed_size_t(&deque->top.value);
+	if (top > new_bottom) {
+		/* Thieves took all tasks */
+		pthreadpool_store_relaxed_size_t(&deque->bottom.value, bottom);
+		return false;
+	}
+
+	load_task(&deque->tasks[new_bottom % PTHREADPOOL_TASK_DEQUE_CAPACITY], task);
+	if (top != new_bottom) {
+		return true;
+	}
+
+	/* The last task in the deque: thieves may race for it */
+	const bool taken = pthreadpool_compare_exchange_relaxed_size_t(&deque->top.value, &top, top + 1);
+	pthreadpool_store_relaxed_size_t(&deque->bottom.value, bottom);
+	return taken;
+}
+
+/* Takes the oldest task from the deque of another thread */
+static bool steal_task(
+	struct pthreadpool_task_deque* deque,
+	struct task_descriptor* task)
+{
+	size_t top = pthreadpool_load_acquire_size_t(&deque->top.value);
+	pthreadpool_fence_seq_cst();
+	const size_t bottom = pthreadpool_load_acquire_size_t(&deque->bottom.value);
+	if ((ptrdiff_t) (bottom - top) <= 0) {
+		return false;
+	}
+
+	load_task(&deque->tasks[top % PTHREADPOOL_TASK_DEQUE_CAPACITY], task);
+	/* The task must be read before the owning thread can reuse its slot */
+	pthreadpool_fence_release();
+	return pthreadpool_compare_exchange_relaxed_size_t(&deque->top.value, &top, top + 1);
+}
+
+static bool steal_any_task(
+	struct pthreadpool* threadpool,
+	const struct thread_info* thread,
+	struct task_descriptor* task)
+{
+	const size_t threads_count = threadpool->threads_count.value;
+	const size_t thread_number = thread->thread_number;
+	for (size_t victim = modulo_decrement(thread_number, threads_count);
+		victim != thread_number;
+		victim = modulo_decrement(victim, threads_count))
+	{
+		struct pthreadpool_task_deque* deque = (struct pthreadpool_task_deque*)
+			pthreadpool_load_relaxed_void_p(&threadpool->threads[victim].task_deque);
+		if (deque != NULL) {
+			/* Pairs with the fence before the deque is published */
+			pthreadpool_fence_acquire();
+			if (steal_task(deque, task)) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+static struct pthreadpool_task_deque* get_task_deque(struct thread_info* thread) {
+	struct pthreadpool_task_deque* deque =
+		(struct pthreadpool_task_deque*) pthreadpool_load_relaxed_void_p(&thread->task_deque);
+	if (deque == NULL) {
+		deque = pthreadpool_allocate_task_deque();
+		if (deque != NULL) {
+			pthreadpool_fence_release();
+			pthreadpool_store_relaxed_void_p(&thread->task_deque, deque);
+		}
+	}
+	return deque;
+}
+
+static void add_pending_task(
+	struct pthreadpool* threadpool,
+	struct pthreadpool_task_group* group)
+{
+	if (fetch_increment_relaxed(&group->pending_tasks) == 0) {
+		fetch_increment_relaxed(&threadpool->active_task_groups);
+	}
+}
+
+static void run_task(
+	struct pthreadpool* threadpool,
+	const struct task_descriptor* task)
+{
+	task->function(task->context);
+	/* Once the count reaches zero, the group may be destroyed by the thread which waits for it */
+	if (pthreadpool_decrement_fetch_release_size_t(&task->group->pending_tasks) == 0) {
+		pthreadpool_decrement_fetch_relaxed_size_t(&threadpool->active_task_groups);
+	}
+}
+
+static bool claim_deferred_task(
+	struct pthreadpool_task_group* group,
+	struct task_descriptor* task)
+{
+	const size_t deferred_tasks_count = group->deferred_tasks_count;
+	size_t next_task = pthreadpool_load_relaxed_size_t(&group->next_deferred_task);
+	while (next_task < deferred_tasks_count) {
+		if (pthreadpool_compare_exchange_relaxed_size_t(&group->next_deferred_task, &next_task, next_task + 1)) {
+			*task = group->deferred_tasks[next_task];
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+ * Runs tasks on the calling thread until all tasks of the group complete: first the deferred tasks of the group, then
+ * the tasks on the deque of the thread, then the tasks stolen from other threads.
+ */
+static void run_tasks_until_done(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread,
+	struct pthreadpool_task_group* group)
+{
+	while (pthreadpool_load_acquire_size_t(&group->pending_tasks) != 0) {
+		struct pthreadpool_task_deque* deque =
+			(struct pthreadpool_task_deque*) pthreadpool_load_relaxed_void_p(&thread->task_deque);
+		struct task_descriptor task;
+		if (claim_deferred_task(group, &task) ||
+			(deque != NULL && pop_task(deque, &task)) ||
+			steal_any_task(threadpool, thread, &task))
+		{
+			run_task(threadpool, &task);
+		} else if (!pthreadpool_help_nested_computation(threadpool)) {
+			pthreadpool_yield();
+		}
+	}
+}
+
+/* Runs on every thread of the thread pool when a task group is waited for outside of its tasks */
+static void thread_run_task_group(struct pthreadpool* threadpool, struct thread_info* thread) {
+	struct pthreadpool_task_group* group =
+		(struct pthreadpool_task_group*) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	/* Without PTHREADPOOL_FLAG_CPU_AFFINITY every thread processes its own range, thus owns the deque of the structure */
+	assert(thread == pthreadpool_get_current_thread());
+	run_tasks_until_done(threadpool, thread, group);
+}
+
+PTHREADPOOL_INTERNAL bool pthreadpool_help_task_groups(
+	struct pthreadpool* threadpool)
+{
+	assert(threadpool != NULL);
+
+	if (pthreadpool_load_relaxed_size_t(&threadpool->active_task_groups) == 0) {
+		return false;
+	}
+
+	struct thread_info* thread = pthreadpool_get_current_thread();
+	if (thread == NULL || thread->threadpool != threadpool) {
+		return false;
+	}
+
+	struct pthreadpool_task_deque* deque =
+		(struct pthreadpool_task_deque*) pthreadpool_load_relaxed_void_p(&thread->task_deque);
+	struct task_descriptor task;
+	if ((deque != NULL && pop_task(deque, &task)) || steal_any_task(threadpool, thread, &task)) {
+		run_task(threadpool, &task);
+		return true;
+	}
+	return false;
+}
+
+pthreadpool_task_group_t pthreadpool_task_group_create(pthreadpool_t threadpool) {
+	struct pthreadpool_task_group* group = calloc(1, sizeof(struct pthreadpool_task_group));
+	if (group != NULL && threadpool != NULL && threadpool->threads_count.value > 1) {
+		group->threadpool = threadpool;
+	}
+	return group;
+}
+
+void pthreadpool_task_group_spawn(
+	pthreadpool_task_group_t group,
+	pthreadpool_spawn_task_t function,
+	void* context)
+{
+	assert(group != NULL);
+	assert(function != NULL);
+
+	struct pthreadpool* threadpool = group->threadpool;
+	if (threadpool == NULL) {
+		function(context);
+		return;
+	}
+
+	const struct task_descriptor task = { function, context, group };
+	struct thread_info* thread = pthreadpool_get_current_thread();
+	if (thread != NULL && thread->threadpool == threadpool) {
+		struct pthreadpool_task_deque* deque = get_task_deque(thread);
+		if (deque == NULL) {
+			function(context);
+			return;
+		}
+
+		add_pending_task(threadpool, group);
+		if (!push_task(deque, &task)) {
+			/* The deque is full: the thread has enough tasks to share already */
+			run_task(threadpool, &task);
+		}
+		return;
+	}
+
+	if (group->deferred_tasks_count == group->deferred_tasks_capacity) {
+		const size_t deferred_tasks_capacity =
+			group->deferred_tasks_capacity != 0 ? group->deferred_tasks_capacity * 2 : 16;
+		struct task_descriptor* deferred_tasks =
+			realloc(group->deferred_tasks, deferred_tasks_capacity * sizeof(struct task_descriptor));
+		if (deferred_tasks == NULL) {
+			function(context);
+			return;
+		}
+		group->deferred_tasks = deferred_tasks;
+		group->deferred_tasks_capacity = deferred_tasks_capacity;
+	}
+	add_pending_task(threadpool, group);
+	group->deferred_tasks[group->deferred_tasks_count++] = task;
+}
+
+void pthreadpool_task_group_wait(pthreadpool_task_group_t group) {
+	assert(group != NULL);
+
+	struct pthreadpool* threadpool = group->threadpool;
+	if (threadpool == NULL || pthreadpool_load_acquire_size_t(&group->pending_tasks) == 0) {
+		return;
+	}
+
+	struct thread_info* thread = pthreadpool_get_current_thread();
+	if (thread != NULL && thread->threadpool == threadpool) {
+		run_tasks_until_done(threadpool, thread, group);
+	} else {
+		/* Every thread runs tasks: the range only makes the computation span all threads */
+		pthreadpool_parallelize(
+			threadpool, &thread_run_task_group, NULL, 0,
+			(void*) group, NULL, threadpool->threads_count.value, 0);
+	}
+
+	group->deferred_tasks_count = 0;
+	pthreadpool_store_relaxed_size_t(&group->next_deferred_task, 0);
+}
+
+void pthreadpool_task_group_destroy(pthreadpool_task_group_t group) {
+	if (group != NULL) {
+		assert(pthreadpool_load_relaxed_size_t(&group->pending_tasks) == 0);
+		free(group->deferred_tasks);
+		free(group);
+	}
+}
@@ -129,6 +129,22 @@
 		return false;
 	}
 
+	static inline size_t pthreadpool_fetch_sub_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t value)
+	{
+		return __c11_atomic_fetch_sub(address, value, __ATOMIC_RELAXED);
+	}
+
+	static inline bool pthreadpool_compare_exchange_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t* expected_value,
+		size_t new_value)
+	{
+		return __c11_atomic_compare_exchange_strong(
+			address, expected_value, new_value, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+	}
+
 	static inline void pthreadpool_fence_acquire() {
 		__c11_atomic_thread_fence(__ATOMIC_ACQUIRE);
 	}
@@ -136,6 +152,10 @@
 	static inline void pthreadpool_fence_release() {
 		__c11_atomic_thread_fence(__ATOMIC_RELEASE);
 	}
+
+	static inline void pthreadpool_fence_seq_cst() {
+		__c11_atomic_thread_fence(__ATOMIC_SEQ_CST);
+	}
 #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
 	#include <stdatomic.h>
 
@@ -252,6 +272,22 @@
 		#endif
 	}
 
+	static inline size_t pthreadpool_fetch_sub_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t value)
+	{
+		return atomic_fetch_sub_explicit(address, value, memory_order_relaxed);
+	}
+
+	static inline bool pthreadpool_compare_exchange_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t* expected_value,
+		size_t new_value)
+	{
+		return atomic_compare_exchange_strong_explicit(
+			address, expected_value, new_value, memory_order_relaxed, memory_order_relaxed);
+	}
+
 	static inline void pthreadpool_fence_acquire() {
 		atomic_thread_fence(memory_order_acquire);
 	}
@@ -259,6 +295,10 @@
 	static inline void pthreadpool_fence_release() {
 		atomic_thread_fence(memory_order_release);
 	}
+
+	static inline void pthreadpool_fence_seq_cst() {
+		atomic_thread_fence(memory_order_seq_cst);
+	}
 #elif defined(__GNUC__)
 	typedef uint32_t volatile pthreadpool_atomic_uint32_t;
 	typedef size_t volatile   pthreadpool_atomic_size_t;
@@ -362,6 +402,26 @@
 		return false;
 	}
 
+	static inline size_t pthreadpool_fetch_sub_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t value)
+	{
+		return __sync_fetch_and_sub(address, value);
+	}
+
+	static inline bool pthreadpool_compare_exchange_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t* expected_value,
+		size_t new_value)
+	{
+		const size_t actual_value = __sync_val_compare_and_swap(address, *expected_value, new_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
 	static inline void pthreadpool_fence_acquire() {
 		__sync_synchronize();
 	}
@@ -369,6 +429,10 @@
 	static inline void pthreadpool_fence_release() {
 		__sync_synchronize();
 	}
+
+	static inline void pthreadpool_fence_seq_cst() {
+		__sync_synchronize();
+	}
 #elif defined(_MSC_VER) && defined(_M_ARM)
 	typedef volatile uint32_t pthreadpool_atomic_uint32_t;
 	typedef volatile size_t   pthreadpool_atomic_size_t;
@@ -483,6 +547,27 @@
 		return false;
 	}
 
+	static inline size_t pthreadpool_fetch_sub_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t value)
+	{
+		return (size_t) _InterlockedExchangeAdd_nf((volatile long*) address, -(long) value);
+	}
+
+	static inline bool pthreadpool_compare_exchange_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t* expected_value,
+		size_t new_value)
+	{
+		const size_t actual_value = (size_t) _InterlockedCompareExchange_nf(
+			(volatile long*) address, (long) new_value, (long) *expected_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
 	static inline void pthreadpool_fence_acquire() {
 		__dmb(_ARM_BARRIER_ISH);
 		_ReadBarrier();
@@ -492,6 +577,11 @@
 		_WriteBarrier();
 		__dmb(_ARM_BARRIER_ISH);
 	}
+
+	static inline void pthreadpool_fence_seq_cst() {
+		_ReadWriteBarrier();
+		__dmb(_ARM_BARRIER_ISH);
+	}
 #elif defined(_MSC_VER) && defined(_M_ARM64)
 	typedef volatile uint32_t pthreadpool_atomic_uint32_t;
 	typedef volatile size_t   pthreadpool_atomic_size_t;
@@ -598,6 +688,27 @@
 		return false;
 	}
 
+	static inline size_t pthreadpool_fetch_sub_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t value)
+	{
+		return (size_t) _InterlockedExchangeAdd64_nf((volatile __int64*) address, -(__int64) value);
+	}
+
+	static inline bool pthreadpool_compare_exchange_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t* expected_value,
+		size_t new_value)
+	{
+		const size_t actual_value = (size_t) _InterlockedCompareExchange64_nf(
+			(volatile __int64*) address, (__int64) new_value, (__int64) *expected_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
 	static inline void pthreadpool_fence_acquire() {
 		__dmb(_ARM64_BARRIER_ISHLD);
 		_ReadBarrier();
@@ -607,6 +718,11 @@
 		_WriteBarrier();
 		__dmb(_ARM64_BARRIER_ISH);
 	}
+
+	static inline void pthreadpool_fence_seq_cst() {
+		_ReadWriteBarrier();
+		__dmb(_ARM64_BARRIER_ISH);
+	}
 #elif defined(_MSC_VER) && defined(_M_IX86)
 	typedef volatile uint32_t pthreadpool_atomic_uint32_t;
 	typedef volatile size_t   pthreadpool_atomic_size_t;
@@ -721,6 +837,27 @@
 		return false;
 	}
 
+	static inline size_t pthreadpool_fetch_sub_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t value)
+	{
+		return (size_t) _InterlockedExchangeAdd((volatile long*) address, -(long) value);
+	}
+
+	static inline bool pthreadpool_compare_exchange_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t* expected_value,
+		size_t new_value)
+	{
+		const size_t actual_value = (size_t) _InterlockedCompareExchange(
+			(volatile long*) address, (long) new_value, (long) *expected_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
 	static inline void pthreadpool_fence_acquire() {
 		_mm_lfence();
 	}
@@ -728,6 +865,10 @@
 	static inline void pthreadpool_fence_release() {
 		_mm_sfence();
 	}
+
+	static inline void pthreadpool_fence_seq_cst() {
+		_mm_mfence();
+	}
 #elif defined(_MSC_VER) && defined(_M_X64)
 	typedef volatile uint32_t pthreadpool_atomic_uint32_t;
 	typedef volatile size_t   pthreadpool_atomic_size_t;
@@ -842,6 +983,27 @@
 		return false;
 	}
 
+	static inline size_t pthreadpool_fetch_sub_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t value)
+	{
+		return (size_t) _InterlockedExchangeAdd64((volatile __int64*) address, -(__int64) value);
+	}
+
+	static inline bool pthreadpool_compare_exchange_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t* expected_value,
+		size_t new_value)
+	{
+		const size_t actual_value = (size_t) _InterlockedCompareExchange64(
+			(volatile __int64*) address, (__int64) new_value, (__int64) *expected_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
 	static inline void pthreadpool_fence_acquire() {
 		_mm_lfence();
 		_ReadBarrier();
@@ -851,6 +1013,11 @@
 		_WriteBarrier();
 		_mm_sfence();
 	}
+
+	static inline void pthreadpool_fence_seq_cst() {
+		_ReadWriteBarrier();
+		_mm_mfence();
+	}
 #else
 	#error "Platform-specific implementation of threadpool-atomics.h required"
 #endif
@@ -30,6 +30,25 @@
 	#endif
 #endif
 
+#ifndef PTHREADPOOL_USE_TOPOLOGY
+	#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+		#define PTHREADPOOL_USE_TOPOLOGY 1
+	#else
+		#define PTHREADPOOL_USE_TOPOLOGY 0
+	#endif
+#endif
+
+#ifndef PTHREADPOOL_USE_RSEQ
+	#if PTHREADPOOL_USE_TOPOLOGY && defined(__has_include) && defined(__has_builtin)
+		#if __has_include(<sys/rseq.h>) && __has_builtin(__builtin_thread_pointer)
+			#define PTHREADPOOL_USE_RSEQ 1
+		#endif
+	#endif
+	#ifndef PTHREADPOOL_USE_RSEQ
+		#define PTHREADPOOL_USE_RSEQ 0
+	#endif
+#endif
+
 #ifndef PTHREADPOOL_USE_CONDVAR
 	#if PTHREADPOOL_USE_GCD || PTHREADPOOL_USE_FUTEX || PTHREADPOOL_USE_EVENT
 		#define PTHREADPOOL_USE_CONDVAR 0
@@ -42,6 +61,9 @@
 /* Number of iterations in spin-wait loop before going into futex/condvar wait */
 #define PTHREADPOOL_SPIN_WAIT_ITERATIONS 1000000
 
+/* Worker threads claim 1/PTHREADPOOL_CLAIM_BATCH_DIVISOR of the remaining elements of their own range at once */
+#define PTHREADPOOL_CLAIM_BATCH_DIVISOR 8
+
 #define PTHREADPOOL_CACHELINE_SIZE 64
 #if defined(__GNUC__)
 	#define PTHREADPOOL_CACHELINE_ALIGNED __attribute__((__aligned__(PTHREADPOOL_CACHELINE_SIZE)))
@@ -51,6 +73,21 @@
 	#error "Platform-specific implementation of PTHREADPOOL_CACHELINE_ALIGNED required"
 #endif
 
+/* Inlines a generic function into callers which pass constant arguments, even if the compiler deems it too large */
+#if defined(__GNUC__)
+	#define PTHREADPOOL_ALWAYS_INLINE inline __attribute__((__always_inline__))
+#elif defined(_MSC_VER)
+	#define PTHREADPOOL_ALWAYS_INLINE __forceinline
+#else
+	#define PTHREADPOOL_ALWAYS_INLINE inline
+#endif
+
+#if defined(_MSC_VER)
+	#define PTHREADPOOL_THREAD_LOCAL __declspec(thread)
+#else
+	#define PTHREADPOOL_THREAD_LOCAL _Thread_local
+#endif
+
 #if defined(__clang__)
 	#if __has_extension(c_static_assert) || __has_feature(c_static_assert)
 		#define PTHREADPOOL_STATIC_ASSERT(predicate, message) _Static_assert((predicate), message)
@@ -1,6 +1,8 @@
 #pragma once
 
 /* Standard C headers */
+#include <limits.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -33,14 +35,27 @@
 #include <pthreadpool.h>
 
 
-#define THREADPOOL_COMMAND_MASK UINT32_C(0x7FFFFFFF)
+#define THREADPOOL_COMMAND_MASK UINT32_C(0x00000003)
 
 enum threadpool_command {
 	threadpool_command_init,
 	threadpool_command_parallelize,
 	threadpool_command_shutdown,
+	threadpool_command_help,
 };
 
+enum threadpool_topology_level {
+	/* Threads on SMT siblings of the same processor core */
+	threadpool_topology_level_core,
+	/* Threads on processors sharing the last-level cache */
+	threadpool_topology_level_cache,
+	/* Threads on processors in the same NUMA node */
+	threadpool_topology_level_node,
+	threadpool_topology_levels,
+};
+
+#define PTHREADPOOL_CPU_ID_NONE UINT32_MAX
+
 struct PTHREADPOOL_CACHELINE_ALIGNED thread_info {
 	/**
 	 * Index of the first element in the work range.
@@ -49,16 +64,50 @@ struct PTHREADPOOL_CACHELINE_ALIGNED thread_info {
 	pthreadpool_atomic_size_t range_start;
 	/**
 	 * Index of the element after the last element of the work range.
-	 * Before processing a new element the stealing worker thread decrements this value.
+	 * Before processing stolen elements the stealing worker thread subtracts their number from this value.
 	 */
 	pthreadpool_atomic_size_t range_end;
 	/**
 	 * The number of elements in the work range.
 	 * Due to race conditions range_length <= range_end - range_start.
-	 * The owning worker thread must decrement this value before incrementing @a range_start.
-	 * The stealing worker thread must decrement this value before decrementing @a range_end.
+	 * The owning worker thread must subtract the number of claimed elements from this value before incrementing
+	 * @a range_start.
+	 * The stealing worker thread must subtract the number of stolen elements from this value before subtracting it
+	 * from @a range_end.
 	 */
 	pthreadpool_atomic_size_t range_length;
+	/**
+	 * Index of the first element in the range of elements stolen by this thread from other threads.
+	 * Only the owning worker thread accesses this value.
+	 */
+	size_t stash_start;
+	/**
+	 * Index of the element after the last element of the range of stolen elements.
+	 * Before processing an element of the stolen range, both the owning and the stealing worker threads decrement
+	 * this value. The owning worker thread refills the stolen range only after this value reaches @a stash_start.
+	 */
+	pthreadpool_atomic_size_t stash_end;
+	/**
+	 * The number of elements in the range of stolen elements.
+	 * Worker threads must subtract the number of claimed elements from this value before subtracting it from
+	 * @a stash_end.
+	 */
+	pthreadpool_atomic_size_t stash_length;
+	/**
+	 * Index of the element after the last element claimed from the stolen range but not yet processed.
+	 * Only the owning worker thread accesses this value.
+	 */
+	size_t stash_batch_end;
+	/**
+	 * The number of elements claimed from the stolen range but not yet processed.
+	 * Only the owning worker thread accesses this value.
+	 */
+	size_t stash_batch_length;
+	/**
+	 * The number of elements this thread processed from ranges of other threads in the current computation.
+	 * Only the owning worker thread modifies this value during a computation.
+	 */
+	size_t stolen_items;
 	/**
 	 * Thread number in the 0..threads_count-1 range.
 	 */
@@ -67,6 +116,46 @@ struct PTHREADPOOL_CACHELINE_ALIGNED thread_info {
 	 * Thread pool which owns the thread.
 	 */
 	struct pthreadpool* threadpool;
+	/**
+	 * Linux CPU number of the processor the thread is pinned to, or PTHREADPOOL_CPU_ID_NONE if the thread is not pinned.
+	 */
+	uint32_t cpu_id;
+	/**
+	 * Linux CPU number of the processor which ran the worker thread that processed the range of this structure in the
+	 * last PTHREADPOOL_FLAG_CPU_AFFINITY computation, or PTHREADPOOL_CPU_ID_NONE if unknown.
+	 */
+	pthreadpool_atomic_uint32_t affinity_cpu;
+	/**
+	 * Non-zero once a worker thread took this structure in the current PTHREADPOOL_FLAG_CPU_AFFINITY computation.
+	 */
+	pthreadpool_atomic_size_t affinity_claimed;
+	/**
+	 * State of the pseudo-random generator which picks the first victim for work stealing.
+	 * Only the thread itself accesses this variable.
+	 */
+	uint32_t victim_seed;
+	/**
+	 * Thread numbers in the [domain_start[level], domain_end[level]) range run on processors in the same topology domain
+	 * as this thread. Domains are nested, and the thread steals work from the innermost domains first.
+	 */
+	size_t domain_start[threadpool_topology_levels];
+	size_t domain_end[threadpool_topology_levels];
+	/**
+	 * Sum of the capacities of threads 0..thread_number. The initial split of items between threads is proportional
+	 * to the capacities of threads when pthreadpool->total_capacity is non-zero.
+	 */
+	uint64_t capacity_end;
+	/**
+	 * Work-stealing deque of the tasks which the thread spawned into task groups, or NULL until the first spawn.
+	 * Only the system thread serving this structure pushes and pops tasks, while other threads steal them.
+	 */
+	pthreadpool_atomic_void_p task_deque;
+	/**
+	 * True while the system thread serving this structure of a nested or concurrent computation runs its thread
+	 * function. The thread must not join the computation again from a task which waits for other work.
+	 * Only the system thread serving this structure accesses this value.
+	 */
+	bool running;
 #if PTHREADPOOL_USE_CONDVAR || PTHREADPOOL_USE_FUTEX
 	/**
 	 * The pthread object corresponding to the thread.
@@ -95,6 +184,19 @@ struct pthreadpool_1d_with_uarch_params {
 	uint32_t max_uarch_index;
 };
 
+/*
+ * Internal flag for pthreadpool_parallelize_1d_weighted computations: the parameters of the computation start with
+ * pthreadpool_1d_weighted_params, and items are split between threads by weight rather than by count.
+ */
+#define PTHREADPOOL_FLAG_WEIGHTED_ITEMS 0x80000000
+
+struct pthreadpool_1d_weighted_params {
+	/**
+	 * Copy of the cumulative_weights argument passed to the pthreadpool_parallelize_1d_weighted function.
+	 */
+	const size_t* cumulative_weights;
+};
+
 struct pthreadpool_1d_tile_1d_params {
 	/**
 	 * Copy of the range argument passed to the pthreadpool_parallelize_1d_tile_1d function.
@@ -106,532 +208,400 @@ struct pthreadpool_1d_tile_1d_params {
 	size_t tile;
 };
 
-struct pthreadpool_2d_params {
+struct pthreadpool_1d_tile_1d_pipeline_params {
 	/**
-	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_2d function.
+	 * Copy of the range argument passed to the pthreadpool_parallelize_1d_tile_1d_pipeline function.
 	 */
-	struct fxdiv_divisor_size_t range_j;
-};
-
-struct pthreadpool_2d_tile_1d_params {
+	size_t range;
 	/**
-	 * Copy of the range_j argument passed to the pthreadpool_parallelize_2d_tile_1d function.
+	 * Copy of the tile argument passed to the pthreadpool_parallelize_1d_tile_1d_pipeline function.
 	 */
-	size_t range_j;
+	size_t tile;
 	/**
-	 * Copy of the tile_j argument passed to the pthreadpool_parallelize_2d_tile_1d function.
+	 * Copy of the stages argument passed to the pthreadpool_parallelize_1d_tile_1d_pipeline function.
 	 */
-	size_t tile_j;
+	const pthreadpool_task_1d_tile_1d_t* stages;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_j, tile_j) value.
+	 * Copy of the stages_count argument passed to the pthreadpool_parallelize_1d_tile_1d_pipeline function.
 	 */
-	struct fxdiv_divisor_size_t tile_range_j;
+	size_t stages_count;
 };
 
-struct pthreadpool_2d_tile_1d_with_uarch_params {
-	/**
-	 * Copy of the default_uarch_index argument passed to the pthreadpool_parallelize_2d_tile_1d_with_uarch function.
-	 */
-	uint32_t default_uarch_index;
+struct pthreadpool_1d_range_params {
 	/**
-	 * Copy of the max_uarch_index argument passed to the pthreadpool_parallelize_2d_tile_1d_with_uarch function.
+	 * Copy of the range argument passed to the pthreadpool_parallelize_1d_range function.
 	 */
-	uint32_t max_uarch_index;
-	/**
-	 * Copy of the range_j argument passed to the pthreadpool_parallelize_2d_tile_1d function.
-	 */
-	size_t range_j;
-	/**
-	 * Copy of the tile_j argument passed to the pthreadpool_parallelize_2d_tile_1d function.
-	 */
-	size_t tile_j;
+	size_t range;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_j, tile_j) value.
+	 * Copy of the alignment argument passed to the pthreadpool_parallelize_1d_range function.
 	 */
-	struct fxdiv_divisor_size_t tile_range_j;
+	size_t alignment;
 };
 
-struct pthreadpool_2d_tile_2d_params {
-	/**
-	 * Copy of the range_i argument passed to the pthreadpool_parallelize_2d_tile_2d function.
-	 */
-	size_t range_i;
-	/**
-	 * Copy of the tile_i argument passed to the pthreadpool_parallelize_2d_tile_2d function.
-	 */
-	size_t tile_i;
-	/**
-	 * Copy of the range_j argument passed to the pthreadpool_parallelize_2d_tile_2d function.
-	 */
-	size_t range_j;
+struct pthreadpool_1d_indexed_params {
 	/**
-	 * Copy of the tile_j argument passed to the pthreadpool_parallelize_2d_tile_2d function.
+	 * Copy of the indices argument passed to the pthreadpool_parallelize_1d_indexed function.
 	 */
-	size_t tile_j;
+	const void* indices;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_j, tile_j) value.
+	 * Whether indices are 32-bit (pthreadpool_parallelize_1d_indexed_u32) rather than size_t.
 	 */
-	struct fxdiv_divisor_size_t tile_range_j;
+	bool u32_indices;
 };
 
-struct pthreadpool_2d_tile_2d_with_uarch_params {
-	/**
-	 * Copy of the default_uarch_index argument passed to the pthreadpool_parallelize_2d_tile_2d_with_uarch function.
-	 */
-	uint32_t default_uarch_index;
-	/**
-	 * Copy of the max_uarch_index argument passed to the pthreadpool_parallelize_2d_tile_2d_with_uarch function.
-	 */
-	uint32_t max_uarch_index;
+struct pthreadpool_1d_indexed_tile_1d_params {
 	/**
-	 * Copy of the range_i argument passed to the pthreadpool_parallelize_2d_tile_2d_with_uarch function.
+	 * Copy of the indices argument passed to the pthreadpool_parallelize_1d_indexed_tile_1d function.
 	 */
-	size_t range_i;
+	const void* indices;
 	/**
-	 * Copy of the tile_i argument passed to the pthreadpool_parallelize_2d_tile_2d_with_uarch function.
+	 * Whether indices are 32-bit (pthreadpool_parallelize_1d_indexed_u32_tile_1d) rather than size_t.
 	 */
-	size_t tile_i;
+	bool u32_indices;
 	/**
-	 * Copy of the range_j argument passed to the pthreadpool_parallelize_2d_tile_2d_with_uarch function.
-	 */
-	size_t range_j;
-	/**
-	 * Copy of the tile_j argument passed to the pthreadpool_parallelize_2d_tile_2d_with_uarch function.
+	 * Copy of the count argument passed to the pthreadpool_parallelize_1d_indexed_tile_1d function.
 	 */
-	size_t tile_j;
+	size_t count;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_j, tile_j) value.
+	 * Copy of the tile argument passed to the pthreadpool_parallelize_1d_indexed_tile_1d function.
 	 */
-	struct fxdiv_divisor_size_t tile_range_j;
+	size_t tile;
 };
 
-struct pthreadpool_3d_params {
+struct pthreadpool_ragged_2d_params {
 	/**
-	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_3d function.
+	 * Copy of the row_offsets argument passed to the pthreadpool_parallelize_ragged_2d function.
 	 */
-	struct fxdiv_divisor_size_t range_j;
+	const size_t* row_offsets;
 	/**
-	 * FXdiv divisor for the range_k argument passed to the pthreadpool_parallelize_3d function.
+	 * Copy of the rows argument passed to the pthreadpool_parallelize_ragged_2d function.
 	 */
-	struct fxdiv_divisor_size_t range_k;
+	size_t rows;
 };
 
-struct pthreadpool_3d_tile_1d_params {
+struct pthreadpool_ragged_2d_tile_1d_params {
 	/**
-	 * Copy of the range_k argument passed to the pthreadpool_parallelize_3d_tile_1d function.
+	 * Copy of the row_offsets argument passed to the pthreadpool_parallelize_ragged_2d_tile_1d function.
 	 */
-	size_t range_k;
+	const size_t* row_offsets;
 	/**
-	 * Copy of the tile_k argument passed to the pthreadpool_parallelize_3d_tile_1d function.
+	 * Copy of the rows argument passed to the pthreadpool_parallelize_ragged_2d_tile_1d function.
 	 */
-	size_t tile_k;
+	size_t rows;
 	/**
-	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_3d_tile_1d function.
+	 * Total number of items in all rows.
 	 */
-	struct fxdiv_divisor_size_t range_j;
+	size_t range;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_k, tile_k) value.
+	 * Copy of the tile argument passed to the pthreadpool_parallelize_ragged_2d_tile_1d function.
 	 */
-	struct fxdiv_divisor_size_t tile_range_k;
+	size_t tile;
 };
 
-struct pthreadpool_3d_tile_1d_with_uarch_params {
-	/**
-	 * Copy of the default_uarch_index argument passed to the pthreadpool_parallelize_3d_tile_1d_with_uarch function.
-	 */
-	uint32_t default_uarch_index;
-	/**
-	 * Copy of the max_uarch_index argument passed to the pthreadpool_parallelize_3d_tile_1d_with_uarch function.
-	 */
-	uint32_t max_uarch_index;
-	/**
-	 * Copy of the range_k argument passed to the pthreadpool_parallelize_3d_tile_1d_with_uarch function.
-	 */
-	size_t range_k;
-	/**
-	 * Copy of the tile_k argument passed to the pthreadpool_parallelize_3d_tile_1d_with_uarch function.
-	 */
-	size_t tile_k;
+struct pthreadpool_2d_params {
 	/**
-	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_3d_tile_1d_with_uarch function.
+	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_2d function.
 	 */
 	struct fxdiv_divisor_size_t range_j;
-	/**
-	 * FXdiv divisor for the divide_round_up(range_k, tile_k) value.
-	 */
-	struct fxdiv_divisor_size_t tile_range_k;
 };
 
-struct pthreadpool_3d_tile_2d_params {
+struct pthreadpool_2d_tile_1d_params {
 	/**
-	 * Copy of the range_j argument passed to the pthreadpool_parallelize_3d_tile_2d function.
+	 * Copy of the range_j argument passed to the pthreadpool_parallelize_2d_tile_1d function.
 	 */
 	size_t range_j;
 	/**
-	 * Copy of the tile_j argument passed to the pthreadpool_parallelize_3d_tile_2d function.
+	 * Copy of the tile_j argument passed to the pthreadpool_parallelize_2d_tile_1d function.
 	 */
 	size_t tile_j;
 	/**
-	 * Copy of the range_k argument passed to the pthreadpool_parallelize_3d_tile_2d function.
+	 * FXdiv divisor for the divide_round_up(range_j, tile_j) value.
 	 */
-	size_t range_k;
+	struct fxdiv_divisor_size_t tile_range_j;
+};
+
+struct pthreadpool_2d_range_params {
 	/**
-	 * Copy of the tile_k argument passed to the pthreadpool_parallelize_3d_tile_2d function.
+	 * Copy of the range_j argument passed to the pthreadpool_parallelize_2d_range function.
 	 */
-	size_t tile_k;
+	size_t range_j;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_j, tile_j) value.
+	 * Copy of the alignment_j argument passed to the pthreadpool_parallelize_2d_range function.
 	 */
-	struct fxdiv_divisor_size_t tile_range_j;
+	size_t alignment_j;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_k, tile_k) value.
+	 * FXdiv divisor for the divide_round_up(range_j, alignment_j) value.
 	 */
-	struct fxdiv_divisor_size_t tile_range_k;
+	struct fxdiv_divisor_size_t aligned_range_j;
 };
 
-struct pthreadpool_3d_tile_2d_with_uarch_params {
+struct pthreadpool_2d_tile_1d_with_uarch_params {
 	/**
-	 * Copy of the default_uarch_index argument passed to the pthreadpool_parallelize_3d_tile_2d_with_uarch function.
+	 * Copy of the default_uarch_index argument passed to the pthreadpool_parallelize_2d_tile_1d_with_uarch function.
 	 */
 	uint32_t default_uarch_index;
 	/**
-	 * Copy of the max_uarch_index argument passed to the pthreadpool_parallelize_3d_tile_2d_with_uarch function.
+	 * Copy of the max_uarch_index argument passed to the pthreadpool_parallelize_2d_tile_1d_with_uarch function.
 	 */
 	uint32_t max_uarch_index;
 	/**
-	 * Copy of the range_j argument passed to the pthreadpool_parallelize_3d_tile_2d_with_uarch function.
+	 * Copy of the range_j argument passed to the pthreadpool_parallelize_2d_tile_1d function.
 	 */
 	size_t range_j;
 	/**
-	 * Copy of the tile_j argument passed to the pthreadpool_parallelize_3d_tile_2d_with_uarch function.
+	 * Copy of the tile_j argument passed to the pthreadpool_parallelize_2d_tile_1d function.
 	 */
 	size_t tile_j;
-	/**
-	 * Copy of the range_k argument passed to the pthreadpool_parallelize_3d_tile_2d_with_uarch function.
-	 */
-	size_t range_k;
-	/**
-	 * Copy of the tile_k argument passed to the pthreadpool_parallelize_3d_tile_2d_with_uarch function.
-	 */
-	size_t tile_k;
 	/**
 	 * FXdiv divisor for the divide_round_up(range_j, tile_j) value.
 	 */
 	struct fxdiv_divisor_size_t tile_range_j;
-	/**
-	 * FXdiv divisor for the divide_round_up(range_k, tile_k) value.
-	 */
-	struct fxdiv_divisor_size_t tile_range_k;
 };
 
-struct pthreadpool_4d_params {
-	/**
-	 * Copy of the range_k argument passed to the pthreadpool_parallelize_4d function.
-	 */
-	size_t range_k;
-	/**
-	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_4d function.
-	 */
-	struct fxdiv_divisor_size_t range_j;
-	/**
-	 * FXdiv divisor for the range_k * range_l value.
-	 */
-	struct fxdiv_divisor_size_t range_kl;
+struct pthreadpool_2d_tile_2d_params {
 	/**
-	 * FXdiv divisor for the range_l argument passed to the pthreadpool_parallelize_4d function.
+	 * Copy of the range_i argument passed to the pthreadpool_parallelize_2d_tile_2d function.
 	 */
-	struct fxdiv_divisor_size_t range_l;
-};
-
-struct pthreadpool_4d_tile_1d_params {
+	size_t range_i;
 	/**
-	 * Copy of the range_k argument passed to the pthreadpool_parallelize_4d_tile_1d function.
+	 * Copy of the tile_i argument passed to the pthreadpool_parallelize_2d_tile_2d function.
 	 */
-	size_t range_k;
+	size_t tile_i;
 	/**
-	 * Copy of the range_l argument passed to the pthreadpool_parallelize_4d_tile_1d function.
+	 * Copy of the range_j argument passed to the pthreadpool_parallelize_2d_tile_2d function.
 	 */
-	size_t range_l;
+	size_t range_j;
 	/**
-	 * Copy of the tile_l argument passed to the pthreadpool_parallelize_4d_tile_1d function.
+	 * Copy of the tile_j argument passed to the pthreadpool_parallelize_2d_tile_2d function.
 	 */
-	size_t tile_l;
+	size_t tile_j;
 	/**
-	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_4d_tile_1d function.
+	 * FXdiv divisor for the divide_round_up(range_j, tile_j) value.
 	 */
-	struct fxdiv_divisor_size_t range_j;
+	struct fxdiv_divisor_size_t tile_range_j;
+};
+
+struct pthreadpool_2d_tile_2d_triangular_params {
 	/**
-	 * FXdiv divisor for the range_k * divide_round_up(range_l, tile_l) value.
+	 * Copy of the range argument passed to the pthreadpool_parallelize_2d_tile_2d_triangular function.
 	 */
-	struct fxdiv_divisor_size_t tile_range_kl;
+	size_t range;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_l, tile_l) value.
+	 * Copy of the tile argument passed to the pthreadpool_parallelize_2d_tile_2d_triangular function.
 	 */
-	struct fxdiv_divisor_size_t tile_range_l;
+	size_t tile;
 };
 
-struct pthreadpool_4d_tile_2d_params {
-	/**
-	 * Copy of the range_k argument passed to the pthreadpool_parallelize_4d_tile_2d function.
-	 */
-	size_t range_k;
+struct pthreadpool_2d_tile_2d_wavefront_params {
 	/**
-	 * Copy of the tile_k argument passed to the pthreadpool_parallelize_4d_tile_2d function.
+	 * Copy of the range_i argument passed to the pthreadpool_parallelize_2d_tile_2d_wavefront function.
 	 */
-	size_t tile_k;
+	size_t range_i;
 	/**
-	 * Copy of the range_l argument passed to the pthreadpool_parallelize_4d_tile_2d function.
+	 * Copy of the tile_i argument passed to the pthreadpool_parallelize_2d_tile_2d_wavefront function.
 	 */
-	size_t range_l;
+	size_t tile_i;
 	/**
-	 * Copy of the tile_l argument passed to the pthreadpool_parallelize_4d_tile_2d function.
+	 * Copy of the range_j argument passed to the pthreadpool_parallelize_2d_tile_2d_wavefront function.
 	 */
-	size_t tile_l;
+	size_t range_j;
 	/**
-	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_4d_tile_2d function.
+	 * Copy of the tile_j argument passed to the pthreadpool_parallelize_2d_tile_2d_wavefront function.
 	 */
-	struct fxdiv_divisor_size_t range_j;
+	size_t tile_j;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_k, tile_k) * divide_round_up(range_l, tile_l) value.
+	 * Number of tiles not yet claimed by any thread. Tiles are claimed in wavefront order.
 	 */
-	struct fxdiv_divisor_size_t tile_range_kl;
+	pthreadpool_atomic_size_t* remaining_tiles;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_l, tile_l) value.
+	 * Number of processed tiles in each row of tiles.
 	 */
-	struct fxdiv_divisor_size_t tile_range_l;
+	pthreadpool_atomic_size_t* row_progress;
 };
 
-struct pthreadpool_4d_tile_2d_with_uarch_params {
+struct pthreadpool_2d_tile_2d_with_uarch_params {
 	/**
-	 * Copy of the default_uarch_index argument passed to the pthreadpool_parallelize_4d_tile_2d_with_uarch function.
+	 * Copy of the default_uarch_index argument passed to the pthreadpool_parallelize_2d_tile_2d_with_uarch function.
 	 */
 	uint32_t default_uarch_index;
 	/**
-	 * Copy of the max_uarch_index argument passed to the pthreadpool_parallelize_4d_tile_2d_with_uarch function.
+	 * Copy of the max_uarch_index argument passed to the pthreadpool_parallelize_2d_tile_2d_with_uarch function.
 	 */
 	uint32_t max_uarch_index;
 	/**
-	 * Copy of the range_k argument passed to the pthreadpool_parallelize_4d_tile_2d_with_uarch function.
-	 */
-	size_t range_k;
-	/**
-	 * Copy of the tile_k argument passed to the pthreadpool_parallelize_4d_tile_2d_with_uarch function.
-	 */
-	size_t tile_k;
-	/**
-	 * Copy of the range_l argument passed to the pthreadpool_parallelize_4d_tile_2d_with_uarch function.
+	 * Copy of the range_i argument passed to the pthreadpool_parallelize_2d_tile_2d_with_uarch function.
 	 */
-	size_t range_l;
+	size_t range_i;
 	/**
-	 * Copy of the tile_l argument passed to the pthreadpool_parallelize_4d_tile_2d_with_uarch function.
+	 * Copy of the tile_i argument passed to the pthreadpool_parallelize_2d_tile_2d_with_uarch function.
 	 */
-	size_t tile_l;
+	size_t tile_i;
 	/**
-	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_4d_tile_2d_with_uarch function.
+	 * Copy of the range_j argument passed to the pthreadpool_parallelize_2d_tile_2d_with_uarch function.
 	 */
-	struct fxdiv_divisor_size_t range_j;
+	size_t range_j;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_k, tile_k) * divide_round_up(range_l, tile_l) value.
+	 * Copy of the tile_j argument passed to the pthreadpool_parallelize_2d_tile_2d_with_uarch function.
 	 */
-	struct fxdiv_divisor_size_t tile_range_kl;
+	size_t tile_j;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_l, tile_l) value.
+	 * FXdiv divisor for the divide_round_up(range_j, tile_j) value.
 	 */
-	struct fxdiv_divisor_size_t tile_range_l;
+	struct fxdiv_divisor_size_t tile_range_j;
 };
 
-struct pthreadpool_5d_params {
-	/**
-	 * Copy of the range_l argument passed to the pthreadpool_parallelize_5d function.
-	 */
-	size_t range_l;
+struct pthreadpool_nd_dimension {
 	/**
-	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_5d function.
+	 * Range of the computation along the dimension.
 	 */
-	struct fxdiv_divisor_size_t range_j;
-	/**
-	 * FXdiv divisor for the range_k argument passed to the pthreadpool_parallelize_5d function.
-	 */
-	struct fxdiv_divisor_size_t range_k;
+	size_t range;
 	/**
-	 * FXdiv divisor for the range_l * range_m value.
+	 * Tile size along the dimension, or 1 if the computation doesn't tile the dimension.
 	 */
-	struct fxdiv_divisor_size_t range_lm;
+	size_t tile;
 	/**
-	 * FXdiv divisor for the range_m argument passed to the pthreadpool_parallelize_5d function.
+	 * FXdiv divisor for the divide_round_up(range, tile) value.
 	 */
-	struct fxdiv_divisor_size_t range_m;
+	struct fxdiv_divisor_size_t tile_range;
 };
 
-struct pthreadpool_5d_tile_1d_params {
-	/**
-	 * Copy of the range_k argument passed to the pthreadpool_parallelize_5d_tile_1d function.
-	 */
-	size_t range_k;
+/*
+ * Parameters of the pthreadpool_parallelize_nd function, and of the 3D-6D parallelization functions, which process
+ * the same row-major sequence of tiles. Only the first num_dims elements of dims are copied to the thread pool.
+ */
+struct pthreadpool_nd_params {
 	/**
-	 * Copy of the range_m argument passed to the pthreadpool_parallelize_5d_tile_1d function.
+	 * Copy of the default_uarch_index argument passed to the parallelization function with microarchitecture index.
 	 */
-	size_t range_m;
-	/**
-	 * Copy of the tile_m argument passed to the pthreadpool_parallelize_5d_tile_1d function.
-	 */
-	size_t tile_m;
-	/**
-	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_5d_tile_1d function.
-	 */
-	struct fxdiv_divisor_size_t range_j;
+	uint32_t default_uarch_index;
 	/**
-	 * FXdiv divisor for the range_k * range_l value.
+	 * Copy of the max_uarch_index argument passed to the parallelization function with microarchitecture index.
 	 */
-	struct fxdiv_divisor_size_t range_kl;
+	uint32_t max_uarch_index;
 	/**
-	 * FXdiv divisor for the range_l argument passed to the pthreadpool_parallelize_5d_tile_1d function.
+	 * Number of dimensions of the computation.
 	 */
-	struct fxdiv_divisor_size_t range_l;
+	size_t num_dims;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_m, tile_m) value.
+	 * Ranges and tile sizes of the computation along every dimension.
 	 */
-	struct fxdiv_divisor_size_t tile_range_m;
+	struct pthreadpool_nd_dimension dims[PTHREADPOOL_MAX_DIMENSIONS];
 };
 
-struct pthreadpool_5d_tile_2d_params {
+struct pthreadpool_nd_range_params {
 	/**
-	 * Copy of the range_l argument passed to the pthreadpool_parallelize_5d_tile_2d function.
+	 * Number of items along the last dimension of the range passed to the pthreadpool_parallelize_nd_range function.
 	 */
-	size_t range_l;
-	/**
-	 * Copy of the tile_l argument passed to the pthreadpool_parallelize_5d_tile_2d function.
-	 */
-	size_t tile_l;
-	/**
-	 * Copy of the range_m argument passed to the pthreadpool_parallelize_5d_tile_2d function.
-	 */
-	size_t range_m;
-	/**
-	 * Copy of the tile_m argument passed to the pthreadpool_parallelize_5d_tile_2d function.
-	 */
-	size_t tile_m;
-	/**
-	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_5d_tile_2d function.
-	 */
-	struct fxdiv_divisor_size_t range_j;
+	size_t range;
 	/**
-	 * FXdiv divisor for the range_k argument passed to the pthreadpool_parallelize_5d_tile_2d function.
+	 * Copy of the alignment argument passed to the pthreadpool_parallelize_nd_range function.
 	 */
-	struct fxdiv_divisor_size_t range_k;
+	size_t alignment;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_l, tile_l) * divide_round_up(range_m, tile_m) value.
+	 * FXdiv divisor for the divide_round_up(range, alignment) value.
 	 */
-	struct fxdiv_divisor_size_t tile_range_lm;
+	struct fxdiv_divisor_size_t aligned_range;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_m, tile_m) value.
+	 * Ranges of the other dimensions, which are processed one item at a time. Must be the last member, as only the
+	 * dimensions in use are copied.
 	 */
-	struct fxdiv_divisor_size_t tile_range_m;
+	struct pthreadpool_nd_params outer;
 };
 
-struct pthreadpool_6d_params {
-	/**
-	 * Copy of the range_l argument passed to the pthreadpool_parallelize_6d function.
-	 */
-	size_t range_l;
-	/**
-	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_6d function.
-	 */
-	struct fxdiv_divisor_size_t range_j;
+/* Number of recent computations which the thread pool remembers for PTHREADPOOL_FLAG_ADAPTIVE_PARTITION */
+#define PTHREADPOOL_HISTORY_ENTRIES 16
+
+struct pthreadpool_history_entry {
 	/**
-	 * FXdiv divisor for the range_k argument passed to the pthreadpool_parallelize_6d function.
+	 * The entry point function of the computation, or NULL for an unused entry.
 	 */
-	struct fxdiv_divisor_size_t range_k;
+	void* thread_function;
 	/**
-	 * FXdiv divisor for the range_l * range_m * range_n value.
+	 * The function called for each item of the computation.
 	 */
-	struct fxdiv_divisor_size_t range_lmn;
+	void* task;
 	/**
-	 * FXdiv divisor for the range_m argument passed to the pthreadpool_parallelize_6d function.
+	 * The number of items in the linear range of the computation.
 	 */
-	struct fxdiv_divisor_size_t range_m;
+	size_t linear_range;
 	/**
-	 * FXdiv divisor for the range_n argument passed to the pthreadpool_parallelize_6d function.
+	 * Hash of the parameters of the parallelization function, which identify the shape of the computation.
 	 */
-	struct fxdiv_divisor_size_t range_n;
+	size_t params_hash;
 };
 
-struct pthreadpool_6d_tile_1d_params {
-	/**
-	 * Copy of the range_l argument passed to the pthreadpool_parallelize_6d_tile_1d function.
-	 */
-	size_t range_l;
-	/**
-	 * Copy of the range_n argument passed to the pthreadpool_parallelize_6d_tile_1d function.
-	 */
-	size_t range_n;
-	/**
-	 * Copy of the tile_n argument passed to the pthreadpool_parallelize_6d_tile_1d function.
-	 */
-	size_t tile_n;
+struct pthreadpool_history {
 	/**
-	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_6d_tile_1d function.
+	 * Index of the entry used by the last computation, or PTHREADPOOL_HISTORY_ENTRIES if the last computation
+	 * did not use PTHREADPOOL_FLAG_ADAPTIVE_PARTITION.
 	 */
-	struct fxdiv_divisor_size_t range_j;
-	/**
-	 * FXdiv divisor for the range_k argument passed to the pthreadpool_parallelize_6d_tile_1d function.
-	 */
-	struct fxdiv_divisor_size_t range_k;
-	/**
-	 * FXdiv divisor for the range_l * range_m * divide_round_up(range_n, tile_n) value.
-	 */
-	struct fxdiv_divisor_size_t tile_range_lmn;
-	/**
-	 * FXdiv divisor for the range_m argument passed to the pthreadpool_parallelize_6d_tile_1d function.
-	 */
-	struct fxdiv_divisor_size_t range_m;
+	size_t last_entry;
+	struct pthreadpool_history_entry entries[PTHREADPOOL_HISTORY_ENTRIES];
 	/**
-	 * FXdiv divisor for the divide_round_up(range_n, tile_n) value.
+	 * Lengths of the ranges assigned to threads, threads_count values for each entry.
 	 */
-	struct fxdiv_divisor_size_t tile_range_n;
+	size_t range_lengths[];
 };
 
-struct pthreadpool_6d_tile_2d_params {
-	/**
-	 * Copy of the range_k argument passed to the pthreadpool_parallelize_6d_tile_2d function.
-	 */
-	size_t range_k;
-	/**
-	 * Copy of the range_m argument passed to the pthreadpool_parallelize_6d_tile_2d function.
-	 */
-	size_t range_m;
-	/**
-	 * Copy of the tile_m argument passed to the pthreadpool_parallelize_6d_tile_2d function.
-	 */
-	size_t tile_m;
-	/**
-	 * Copy of the range_n argument passed to the pthreadpool_parallelize_6d_tile_2d function.
-	 */
-	size_t range_n;
-	/**
-	 * Copy of the tile_n argument passed to the pthreadpool_parallelize_6d_tile_2d function.
-	 */
-	size_t tile_n;
-	/**
-	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_6d_tile_2d function.
-	 */
-	struct fxdiv_divisor_size_t range_j;
+/* Counter which occupies a whole cache line to avoid false sharing with other variables */
+struct PTHREADPOOL_CACHELINE_ALIGNED pthreadpool_shared_counter {
+	pthreadpool_atomic_size_t value;
+};
+
+/* Maximum number of tasks in the deque of one thread: further tasks run right away on the spawning thread */
+#define PTHREADPOOL_TASK_DEQUE_CAPACITY 256
+
+struct pthreadpool_task {
 	/**
-	 * FXdiv divisor for the range_k * range_l value.
+	 * The function spawned with pthreadpool_task_group_spawn, and its argument.
 	 */
-	struct fxdiv_divisor_size_t range_kl;
+	pthreadpool_atomic_void_p function;
+	pthreadpool_atomic_void_p context;
 	/**
-	 * FXdiv divisor for the range_l argument passed to the pthreadpool_parallelize_6d_tile_2d function.
+	 * The task group which the task was spawned into.
 	 */
-	struct fxdiv_divisor_size_t range_l;
+	pthreadpool_atomic_void_p group;
+};
+
+/*
+ * Chase-Lev work-stealing deque with a fixed capacity. The owning thread pushes and pops tasks at the bottom, and other
+ * threads steal tasks from the top. Indices grow monotonically, and task i is stored at i % capacity.
+ */
+struct PTHREADPOOL_CACHELINE_ALIGNED pthreadpool_task_deque {
 	/**
-	 * FXdiv divisor for the divide_round_up(range_m, tile_m) * divide_round_up(range_n, tile_n) value.
+	 * Index of the oldest task in the deque. Incremented by the thread which takes the task.
 	 */
-	struct fxdiv_divisor_size_t tile_range_mn;
+	struct pthreadpool_shared_counter top;
 	/**
-	 * FXdiv divisor for the divide_round_up(range_n, tile_n) value.
+	 * Index after the newest task in the deque. Modified only by the owning thread.
 	 */
-	struct fxdiv_divisor_size_t tile_range_n;
+	struct pthreadpool_shared_counter bottom;
+	struct pthreadpool_task tasks[PTHREADPOOL_TASK_DEQUE_CAPACITY];
+};
+
+/* Function called once all items of an asynchronous job are processed */
+typedef void (*completion_function_t)(void* context);
+
+union pthreadpool_params {
+	struct pthreadpool_1d_with_uarch_params parallelize_1d_with_uarch;
+	struct pthreadpool_1d_weighted_params parallelize_1d_weighted;
+	struct pthreadpool_1d_tile_1d_params parallelize_1d_tile_1d;
+	struct pthreadpool_1d_tile_1d_pipeline_params parallelize_1d_tile_1d_pipeline;
+	struct pthreadpool_1d_range_params parallelize_1d_range;
+	struct pthreadpool_1d_indexed_params parallelize_1d_indexed;
+	struct pthreadpool_1d_indexed_tile_1d_params parallelize_1d_indexed_tile_1d;
+	struct pthreadpool_ragged_2d_params parallelize_ragged_2d;
+	struct pthreadpool_ragged_2d_tile_1d_params parallelize_ragged_2d_tile_1d;
+	struct pthreadpool_2d_params parallelize_2d;
+	struct pthreadpool_2d_tile_1d_params parallelize_2d_tile_1d;
+	struct pthreadpool_2d_range_params parallelize_2d_range;
+	struct pthreadpool_2d_tile_1d_with_uarch_params parallelize_2d_tile_1d_with_uarch;
+	struct pthreadpool_2d_tile_2d_params parallelize_2d_tile_2d;
+	struct pthreadpool_2d_tile_2d_triangular_params parallelize_2d_tile_2d_triangular;
+	struct pthreadpool_2d_tile_2d_wavefront_params parallelize_2d_tile_2d_wavefront;
+	struct pthreadpool_2d_tile_2d_with_uarch_params parallelize_2d_tile_2d_with_uarch;
+	struct pthreadpool_nd_params parallelize_nd;
+	struct pthreadpool_nd_range_params parallelize_nd_range;
 };
 
 struct PTHREADPOOL_CACHELINE_ALIGNED pthreadpool {
@@ -672,30 +642,7 @@ struct PTHREADPOOL_CACHELINE_ALIGNED pthreadpool {
 	 * Additional parallelization parameters.
 	 * These parameters are specific for each thread_function.
 	 */
-	union {
-		struct pthreadpool_1d_with_uarch_params parallelize_1d_with_uarch;
-		struct pthreadpool_1d_tile_1d_params parallelize_1d_tile_1d;
-		struct pthreadpool_2d_params parallelize_2d;
-		struct pthreadpool_2d_tile_1d_params parallelize_2d_tile_1d;
-		struct pthreadpool_2d_tile_1d_with_uarch_params parallelize_2d_tile_1d_with_uarch;
-		struct pthreadpool_2d_tile_2d_params parallelize_2d_tile_2d;
-		struct pthreadpool_2d_tile_2d_with_uarch_params parallelize_2d_tile_2d_with_uarch;
-		struct pthreadpool_3d_params parallelize_3d;
-		struct pthreadpool_3d_tile_1d_params parallelize_3d_tile_1d;
-		struct pthreadpool_3d_tile_1d_with_uarch_params parallelize_3d_tile_1d_with_uarch;
-		struct pthreadpool_3d_tile_2d_params parallelize_3d_tile_2d;
-		struct pthreadpool_3d_tile_2d_with_uarch_params parallelize_3d_tile_2d_with_uarch;
-		struct pthreadpool_4d_params parallelize_4d;
-		struct pthreadpool_4d_tile_1d_params parallelize_4d_tile_1d;
-		struct pthreadpool_4d_tile_2d_params parallelize_4d_tile_2d;
-		struct pthreadpool_4d_tile_2d_with_uarch_params parallelize_4d_tile_2d_with_uarch;
-		struct pthreadpool_5d_params parallelize_5d;
-		struct pthreadpool_5d_tile_1d_params parallelize_5d_tile_1d;
-		struct pthreadpool_5d_tile_2d_params parallelize_5d_tile_2d;
-		struct pthreadpool_6d_params parallelize_6d;
-		struct pthreadpool_6d_tile_1d_params parallelize_6d_tile_1d;
-		struct pthreadpool_6d_tile_2d_params parallelize_6d_tile_2d;
-	} params;
+	union pthreadpool_params params;
 	/**
 	 * Copy of the flags passed to a parallelization function.
 	 */
@@ -749,12 +696,115 @@ struct PTHREADPOOL_CACHELINE_ALIGNED pthreadpool {
 	 * submitted command according to the high bit of the command word.
 	 */
 	HANDLE command_event[2];
+	/**
+	 * Semaphore to wake up the worker threads waiting on @a command_event to help with asynchronous jobs. Its count is
+	 * at most the number of worker threads.
+	 */
+	HANDLE help_semaphore;
 #endif
+	/**
+	 * The number of items not yet claimed from the shared counter by PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE and
+	 * PTHREADPOOL_FLAG_GUIDED_SCHEDULE computations. Items are claimed from the end of the linear range. The last claims
+	 * may subtract more items than remain, and wrap the counter around to values above shared_items.
+	 */
+	struct pthreadpool_shared_counter remaining_items;
+	/**
+	 * The number of items in the linear range of PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE and PTHREADPOOL_FLAG_GUIDED_SCHEDULE
+	 * computations.
+	 */
+	size_t shared_items;
+	/**
+	 * The number of items claimed at once from the shared counter by PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE computations.
+	 */
+	size_t shared_chunk;
+	/**
+	 * Partitions of recent computations with PTHREADPOOL_FLAG_ADAPTIVE_PARTITION. Allocated on the first such
+	 * computation, and accessed only by the thread which holds the execution mutex.
+	 */
+	struct pthreadpool_history* history;
+	/**
+	 * Lowest Linux CPU number among the processors sharing the last-level cache with the processor, indexed by Linux
+	 * CPU number. Detected on the first PTHREADPOOL_FLAG_CPU_AFFINITY computation, and stays NULL if the threads are
+	 * pinned or the topology is unknown. Processors the thread pool may not run on have PTHREADPOOL_CPU_ID_NONE.
+	 */
+	uint32_t* cpu_caches;
+	/**
+	 * The number of entries in @a cpu_caches.
+	 */
+	size_t cpu_caches_count;
+	/**
+	 * Nested computations started by tasks of the current computation, concurrent computations submitted with
+	 * PTHREADPOOL_FLAG_CONCURRENT_JOBS, and asynchronous jobs, which idle threads may help to process. Linked through
+	 * @a next_nested, and modified only under @a nested_lock.
+	 */
+	pthreadpool_atomic_void_p nested_computations;
+	/**
+	 * Thread pool structures of finished nested computations, kept for reuse until the thread pool is destroyed.
+	 * Linked through @a next_nested, and accessed only under @a nested_lock.
+	 */
+	struct pthreadpool* spare_nested_threadpools;
+	/**
+	 * Spin lock guarding @a nested_computations and @a spare_nested_threadpools: 1 if locked, 0 otherwise.
+	 */
+	pthreadpool_atomic_size_t nested_lock;
+	/**
+	 * In the thread pool structure of a nested computation: the next structure in the list it belongs to.
+	 */
+	pthreadpool_atomic_void_p next_nested;
+	/**
+	 * In the thread pool structure of a nested computation: the number of threads helping to process it.
+	 */
+	pthreadpool_atomic_size_t nested_helpers;
+	/**
+	 * In the thread pool structure of a nested computation: the thread pool which the computation runs on.
+	 */
+	struct pthreadpool* parent_threadpool;
+	/**
+	 * In the thread pool structure of a nested computation: whether the computation is an asynchronous job, which
+	 * the last helping thread unpublishes once all items are processed. Accessed only under @a nested_lock.
+	 */
+	bool async_job;
+	/**
+	 * In the thread pool structure of an asynchronous job: whether all items were processed and the job was
+	 * unpublished. Accessed only under @a nested_lock.
+	 */
+	bool job_completed;
+	/**
+	 * In the thread pool structure of an asynchronous job: eventfd file descriptor signalled on completion, or -1
+	 * if pthreadpool_get_job_fd was not called. Accessed only under @a nested_lock.
+	 */
+	int job_event_fd;
+	/**
+	 * In the thread pool structure of an asynchronous job: function called under @a nested_lock once all items are
+	 * processed, or NULL if the job is released by pthreadpool_wait. Jobs with a completion function are released
+	 * right after the call.
+	 */
+	completion_function_t job_completion;
+	/**
+	 * In the thread pool structure of an asynchronous job: the argument of @a job_completion.
+	 */
+	void* job_completion_context;
+	/**
+	 * The number of task groups with tasks which didn't complete yet. Idle threads look for tasks to steal only if
+	 * this number is non-zero.
+	 */
+	pthreadpool_atomic_size_t active_task_groups;
+	/**
+	 * Sum of the capacities of all threads, or 0 if all threads have equal capacities and items are split evenly.
+	 */
+	uint64_t total_capacity;
 	/**
 	 * FXdiv divisor for the number of threads in the thread pool.
 	 * This struct never change after pthreadpool_create.
 	 */
 	struct fxdiv_divisor_size_t threads_count;
+	/**
+	 * Bitmap of threads which may still have items in their range or stolen range. A bit is set when a range is
+	 * assigned to the thread or the thread steals a range, and cleared once a thread observed that both ranges are
+	 * exhausted. The bitmap is only a hint for victim selection: every thread processes its own ranges regardless
+	 * of the bitmap. The bitmap immediately follows the thread information structures.
+	 */
+	pthreadpool_atomic_size_t* busy_threads;
 	/**
 	 * Thread information structures that immediately follow this structure.
 	 */
@@ -764,132 +814,463 @@ struct PTHREADPOOL_CACHELINE_ALIGNED pthreadpool {
 PTHREADPOOL_STATIC_ASSERT(sizeof(struct pthreadpool) % PTHREADPOOL_CACHELINE_SIZE == 0,
 	"pthreadpool structure must occupy an integer number of cache lines (64 bytes)");
 
+#define PTHREADPOOL_BITMAP_WORD_BITS (sizeof(size_t) * CHAR_BIT)
+
 PTHREADPOOL_INTERNAL struct pthreadpool* pthreadpool_allocate(
 	size_t threads_count);
 
 PTHREADPOOL_INTERNAL void pthreadpool_deallocate(
 	struct pthreadpool* threadpool);
 
-typedef void (*thread_function_t)(struct pthreadpool* threadpool, struct thread_info* thread);
-
-PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
+PTHREADPOOL_INTERNAL struct pthreadpool_task_deque* pthreadpool_allocate_task_deque(void);
+
+/*
+ * Returns the smallest boundary s in [start, end] such that the total weight of elements before s is at least the
+ * specified weight, or end if there is no such boundary.
+ */
+PTHREADPOOL_INTERNAL size_t pthreadpool_find_weight_boundary(
+	const size_t* cumulative_weights,
+	size_t start,
+	size_t end,
+	size_t weight);
+
+/*
+ * Initializes the ranges of the threads, and the shared counter for the linear range of items according to the
+ * schedule selected by the flags. Must be called after the entry point, task, and parameters of the computation are
+ * stored in the thread pool.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_assign_ranges(
 	struct pthreadpool* threadpool,
-	thread_function_t thread_function,
-	const void* params,
-	size_t params_size,
-	void* task,
-	void* context,
 	size_t linear_range,
+	size_t params_size,
 	uint32_t flags);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_1d_fastpath(
+/*
+ * Claims a chunk of items from the shared counter in PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE and
+ * PTHREADPOOL_FLAG_GUIDED_SCHEDULE computations with a single atomic subtraction. Stores the index of the last item of
+ * the chunk in index, and keeps other items as a private batch in the stolen range of the thread. Returns false if all
+ * items were claimed.
+ */
+PTHREADPOOL_INTERNAL bool pthreadpool_claim_shared_items(
 	struct pthreadpool* threadpool,
-	struct thread_info* thread);
-
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_1d_with_thread_fastpath(
+	struct thread_info* thread,
+	size_t* index);
+
+/* Returns true if the value of the shared counter leaves some items to claim */
+static inline bool pthreadpool_has_shared_items(
+	const struct pthreadpool* threadpool,
+	size_t remaining_items)
+{
+	/* Zero and wrapped-around values both exceed the number of items after subtracting one */
+	return remaining_items - 1 < threadpool->shared_items;
+}
+
+/*
+ * Maps thread numbers to processors so that threads in the same topology domain get consecutive numbers. With
+ * pin_threads, worker threads are assigned processors to pin themselves to with pthreadpool_pin_thread.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_detect_topology(
 	struct pthreadpool* threadpool,
-	struct thread_info* thread);
+	bool pin_threads);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_1d_with_uarch_fastpath(
-	struct pthreadpool* threadpool,
-	struct thread_info* thread);
+PTHREADPOOL_INTERNAL void pthreadpool_pin_thread(
+	const struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_1d_tile_1d_fastpath(
-	struct pthreadpool* threadpool,
-	struct thread_info* thread);
+/*
+ * Detects the last-level caches of the processors the thread pool may run on, unless already detected or the threads
+ * are pinned. Must be called by the thread which holds the execution mutex.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_detect_cpu_caches(
+	struct pthreadpool* threadpool);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_2d_fastpath(
+/*
+ * Returns the thread information structure which the calling worker thread uses in a PTHREADPOOL_FLAG_CPU_AFFINITY
+ * computation: preferably the one last processed on the current processor of the calling thread, otherwise the own
+ * structure of the thread, or the next structure not yet taken by another worker thread.
+ */
+PTHREADPOOL_INTERNAL struct thread_info* pthreadpool_select_thread(
 	struct pthreadpool* threadpool,
 	struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_2d_with_thread_fastpath(
-	struct pthreadpool* threadpool,
-	struct thread_info* thread);
+/* Maximum capacity of a thread, such that the sum of capacities of all threads fits into 32 bits */
+#define PTHREADPOOL_MAX_CAPACITY 65535
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_2d_tile_1d_fastpath(
+/*
+ * Sets the relative capacities of threads used to split items between threads. Capacities are clamped to the
+ * [1, PTHREADPOOL_MAX_CAPACITY] range. NULL capacities make all threads equal.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_set_capacities(
 	struct pthreadpool* threadpool,
-	struct thread_info* thread);
+	const uint32_t* capacities);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_2d_tile_1d_with_uarch_fastpath(
-	struct pthreadpool* threadpool,
-	struct thread_info* thread);
+PTHREADPOOL_INTERNAL void pthreadpool_mark_busy_threads(
+	struct pthreadpool* threadpool);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_2d_tile_1d_with_uarch_with_thread_fastpath(
+PTHREADPOOL_INTERNAL void pthreadpool_mark_busy_thread(
 	struct pthreadpool* threadpool,
-	struct thread_info* thread);
-
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_2d_tile_2d_fastpath(
+	size_t thread_number);
+
+/*
+ * Returns true if some thread may still have items in its range or stolen range.
+ */
+PTHREADPOOL_INTERNAL bool pthreadpool_has_busy_threads(
+	const struct pthreadpool* threadpool);
+
+/*
+ * Steals the upper half of the remaining elements in the range of the other thread, or if the range is empty, the
+ * upper half of the elements the other thread stole itself. Stores the index of the last stolen element in index,
+ * and moves other stolen elements to the stolen range of this thread. Returns false if the other thread has no
+ * elements left.
+ *
+ * Must be called only when the stolen range of this thread is empty.
+ */
+PTHREADPOOL_INTERNAL bool pthreadpool_steal_range(
 	struct pthreadpool* threadpool,
-	struct thread_info* thread);
-
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_2d_tile_2d_with_uarch_fastpath(
+	struct thread_info* thread,
+	struct thread_info* other_thread,
+	size_t* index);
+
+/*
+ * Returns the number of elements to reserve at once from a range with the specified number of remaining elements.
+ * With PTHREADPOOL_FLAG_STATIC_SCHEDULE the whole range is reserved at once. With PTHREADPOOL_FLAG_BATCH_CLAIMS the
+ * batch size shrinks as the range nears its end, where other threads steal elements. Otherwise, elements are reserved
+ * one-by-one, so that reserved elements are always being processed.
+ */
+static PTHREADPOOL_ALWAYS_INLINE size_t pthreadpool_get_batch_size(
+	struct pthreadpool* threadpool,
+	size_t length)
+{
+	const uint32_t flags = pthreadpool_load_relaxed_uint32_t(&threadpool->flags);
+	if (flags & PTHREADPOOL_FLAG_STATIC_SCHEDULE) {
+		/* No other thread would claim elements from this range */
+		return length;
+	} else if (flags & PTHREADPOOL_FLAG_BATCH_CLAIMS) {
+		return length / PTHREADPOOL_CLAIM_BATCH_DIVISOR + 1;
+	} else {
+		return 1;
+	}
+}
+
+/* Reserves a batch of elements in a range, and returns the number of reserved elements */
+static PTHREADPOOL_ALWAYS_INLINE size_t pthreadpool_reserve_batch(
+	struct pthreadpool* threadpool,
+	pthreadpool_atomic_size_t* range_length)
+{
+	size_t length = pthreadpool_load_relaxed_size_t(range_length);
+	while (length != 0) {
+		const size_t batch = pthreadpool_get_batch_size(threadpool, length);
+		if (pthreadpool_compare_exchange_relaxed_size_t(range_length, &length, length - batch)) {
+			return batch;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Claims the next element in the own range of the thread. Elements are reserved in batches, and the number of
+ * reserved, but not yet claimed elements is kept in batch, which must be zero-initialized before the first call.
+ */
+static PTHREADPOOL_ALWAYS_INLINE bool pthreadpool_claim_item(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread,
+	size_t* batch)
+{
+	if (*batch == 0) {
+		*batch = pthreadpool_reserve_batch(threadpool, &thread->range_length);
+		if (*batch == 0) {
+			return false;
+		}
+	}
+	*batch -= 1;
+	return true;
+}
+
+/*
+ * Version of pthreadpool_claim_item which reserves batches with a single fetch-and-subtract rather than a
+ * compare-and-swap loop. Thieves never leave a negative range_length, and the owning thread subtracts at most one
+ * batch from an exhausted range, thus negative values stay small and denote an empty range.
+ */
+static PTHREADPOOL_ALWAYS_INLINE bool pthreadpool_claim_item_fastpath(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread,
+	size_t* batch)
+{
+	if (*batch == 0) {
+		const size_t length = pthreadpool_load_relaxed_size_t(&thread->range_length);
+		if ((ptrdiff_t) length <= 0) {
+			return false;
+		}
+		const size_t reserved = pthreadpool_get_batch_size(threadpool, length);
+		const size_t old_length = pthreadpool_fetch_sub_relaxed_size_t(&thread->range_length, reserved);
+		if ((ptrdiff_t) old_length <= 0) {
+			return false;
+		}
+		*batch = old_length < reserved ? old_length : reserved;
+	}
+	*batch -= 1;
+	return true;
+}
+
+/*
+ * Claims an element from the stolen range of this thread, or if it is empty, steals elements from the other thread.
+ * Returns false if neither this thread nor the other thread have elements left. Elements of a stolen range are claimed
+ * from its end, so successive calls mostly return consecutive indices in decreasing order, which lets callers step
+ * back from the previous multi-dimensional index rather than decompose every index.
+ */
+static PTHREADPOOL_ALWAYS_INLINE bool pthreadpool_steal_item(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread,
+	struct thread_info* other_thread,
+	size_t* index)
+{
+	if (thread->stash_batch_length == 0) {
+		const size_t batch = pthreadpool_reserve_batch(threadpool, &thread->stash_length);
+		if (batch == 0) {
+			return pthreadpool_steal_range(threadpool, thread, other_thread, index);
+		}
+		thread->stash_batch_end = pthreadpool_fetch_sub_relaxed_size_t(&thread->stash_end, batch);
+		thread->stash_batch_length = batch;
+		thread->stolen_items += batch;
+	}
+	thread->stash_batch_length -= 1;
+	*index = --thread->stash_batch_end;
+	return true;
+}
+
+/*
+ * Version of pthreadpool_steal_item which claims the whole reserved batch of contiguous elements at once. Stores the
+ * index of the first claimed element in start, and returns the number of claimed elements, or 0 if neither this thread
+ * nor the other thread have elements left.
+ */
+static inline size_t pthreadpool_steal_items(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread,
+	struct thread_info* other_thread,
+	size_t* start)
+{
+	size_t index;
+	if (!pthreadpool_steal_item(threadpool, thread, other_thread, &index)) {
+		return 0;
+	}
+	/* Other elements of the reserved batch immediately precede the claimed one, and only this thread can claim them */
+	const size_t count = thread->stash_batch_length + 1;
+	thread->stash_batch_end -= thread->stash_batch_length;
+	thread->stash_batch_length = 0;
+	*start = index + 1 - count;
+	return count;
+}
+
+/*
+ * Returns the thread number of the first thread to steal work from, or thread->thread_number if no other thread has
+ * work left or stealing is disabled by PTHREADPOOL_FLAG_STATIC_SCHEDULE. Must be called after the thread exhausted its
+ * own range.
+ *
+ * With PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE and PTHREADPOOL_FLAG_GUIDED_SCHEDULE the threads don't own any items, and the
+ * work stealing loop claims all items from the shared counter instead: the first victim is an arbitrary other thread,
+ * pthreadpool_steal_item ignores it, and there is no next victim.
+ */
+PTHREADPOOL_INTERNAL size_t pthreadpool_first_victim(
 	struct pthreadpool* threadpool,
 	struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_3d_fastpath(
+/*
+ * Returns the thread number of the next thread to steal work from after the specified victim, or thread->thread_number
+ * if no other thread has work left. Must be called after the thread exhausted the range of the victim.
+ */
+PTHREADPOOL_INTERNAL size_t pthreadpool_next_victim(
 	struct pthreadpool* threadpool,
-	struct thread_info* thread);
+	const struct thread_info* thread,
+	size_t victim);
+
+typedef void (*thread_function_t)(struct pthreadpool* threadpool, struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_3d_tile_1d_fastpath(
+PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	struct pthreadpool* threadpool,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	uint32_t flags);
+
+/*
+ * Returns the thread information structure of the thread pool which the calling system thread serves in the current
+ * computation, or NULL if the calling thread doesn't participate in any computation.
+ */
+PTHREADPOOL_INTERNAL struct thread_info* pthreadpool_get_current_thread(void);
+
+/*
+ * Sets the thread information structure returned by pthreadpool_get_current_thread for the calling system thread, and
+ * returns the previous one.
+ */
+PTHREADPOOL_INTERNAL struct thread_info* pthreadpool_set_current_thread(
 	struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_3d_tile_1d_with_thread_fastpath(
+/*
+ * Processes all items on the calling thread with a single-thread structure on the stack, passing the specified thread
+ * number to the tasks. Used when the thread pool can't be used without waiting or allocating memory.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_parallelize_inline(
+	size_t thread_number,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	uint32_t flags);
+
+/*
+ * Records the result returned by pthreadpool_last_try_ran_inline on the calling thread.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_set_last_try_inline(
+	bool ran_inline);
+
+/*
+ * Clears the result returned by pthreadpool_last_try_ran_inline at the start of a parallelization call with
+ * PTHREADPOOL_FLAG_TRY, so that calls which process items without trying to lock the thread pool, e.g. sequential or
+ * nested calls, don't leave the result of an earlier call.
+ */
+static inline void pthreadpool_reset_last_try_inline(uint32_t flags) {
+	if (flags & PTHREADPOOL_FLAG_TRY) {
+		pthreadpool_set_last_try_inline(false);
+	}
+}
+
+/*
+ * Processes a computation started by a task of the current computation on the same thread pool. The calling thread
+ * takes all items, and other threads of the thread pool steal them as they become idle. The specified thread is the
+ * thread information structure of the calling thread in the thread pool.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_parallelize_nested(
 	struct pthreadpool* threadpool,
-	struct thread_info* thread);
+	struct thread_info* thread,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	uint32_t flags);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_3d_tile_1d_with_uarch_fastpath(
+/*
+ * Starts a computation submitted with PTHREADPOOL_FLAG_CONCURRENT_JOBS while another computation holds the execution
+ * mutex, or an asynchronous job. Items are split between all threads, and idle threads of the thread pool process them
+ * the same way as the items of nested computations. Returns NULL if the computation can't be allocated.
+ */
+PTHREADPOOL_INTERNAL struct pthreadpool* pthreadpool_start_concurrent_computation(
+	struct pthreadpool* threadpool,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	uint32_t flags,
+	bool async_job,
+	completion_function_t job_completion,
+	void* job_completion_context);
+
+/*
+ * Helps to process the concurrent computation in the specified thread information structure of the thread pool.
+ * Must be called only by the thread which holds the execution mutex, or by a thread of the current computation with
+ * its own thread information structure. Returns false if all items were already claimed.
+ */
+PTHREADPOOL_INTERNAL bool pthreadpool_help_concurrent_computation(
 	struct pthreadpool* threadpool,
+	struct pthreadpool* computation,
 	struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_3d_tile_1d_with_uarch_with_thread_fastpath(
+/*
+ * Returns true and releases the concurrent computation if all its items were processed, otherwise returns false.
+ */
+PTHREADPOOL_INTERNAL bool pthreadpool_finish_concurrent_computation(
 	struct pthreadpool* threadpool,
-	struct thread_info* thread);
+	struct pthreadpool* computation);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_3d_tile_2d_fastpath(
+/*
+ * Helps to process a nested computation which still has unclaimed items, if there is one. Must be called only by an
+ * idle thread of the current computation. Returns false if there was no nested computation to help with.
+ */
+PTHREADPOOL_INTERNAL bool pthreadpool_help_nested_computation(
+	struct pthreadpool* threadpool);
+
+/*
+ * Steals a task from the deque of another thread and runs it, if any thread spawned tasks into task groups. Must be
+ * called only by an idle thread of the current computation. Returns false if there was no task to steal.
+ */
+PTHREADPOOL_INTERNAL bool pthreadpool_help_task_groups(
+	struct pthreadpool* threadpool);
+
+/*
+ * Adds a node which processes items with the specified thread function to the graph. Returns the index of the node,
+ * or PTHREADPOOL_GRAPH_NODE_NONE if it can't be allocated.
+ */
+PTHREADPOOL_INTERNAL size_t pthreadpool_graph_add_node(
+	struct pthreadpool_graph* graph,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	uint32_t flags);
+
+/*
+ * Starts an asynchronous job on the thread pool, and wakes up idle threads to process it. Returns NULL if the items
+ * were processed before the function returned.
+ */
+PTHREADPOOL_INTERNAL struct pthreadpool_job* pthreadpool_parallelize_async(
 	struct pthreadpool* threadpool,
-	struct thread_info* thread);
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	uint32_t flags);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_3d_tile_2d_with_uarch_fastpath(
+PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_1d_fastpath(
 	struct pthreadpool* threadpool,
 	struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_4d_fastpath(
+PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_1d_with_thread_fastpath(
 	struct pthreadpool* threadpool,
 	struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_4d_tile_1d_fastpath(
+PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_1d_with_uarch_fastpath(
 	struct pthreadpool* threadpool,
 	struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_4d_tile_2d_fastpath(
+PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_1d_tile_1d_fastpath(
 	struct pthreadpool* threadpool,
 	struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_4d_tile_2d_with_uarch_fastpath(
+PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_2d_fastpath(
 	struct pthreadpool* threadpool,
 	struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_5d_fastpath(
+PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_2d_with_thread_fastpath(
 	struct pthreadpool* threadpool,
 	struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_5d_tile_1d_fastpath(
+PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_2d_tile_1d_fastpath(
 	struct pthreadpool* threadpool,
 	struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_5d_tile_2d_fastpath(
+PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_2d_tile_1d_with_uarch_fastpath(
 	struct pthreadpool* threadpool,
 	struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_6d_fastpath(
+PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_2d_tile_1d_with_uarch_with_thread_fastpath(
 	struct pthreadpool* threadpool,
 	struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_6d_tile_1d_fastpath(
+PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_2d_tile_2d_fastpath(
 	struct pthreadpool* threadpool,
 	struct thread_info* thread);
 
-PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_6d_tile_2d_fastpath(
+PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_2d_tile_2d_with_uarch_fastpath(
 	struct pthreadpool* threadpool,
 	struct thread_info* thread);
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stddef.h>
 
+#include "threadpool-common.h"
+
 /* SSE-specific headers */
 #if defined(__SSE__) || defined(__x86_64__) || defined(_M_X64) && !defined(_M_ARM64EC) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
 	#include <xmmintrin.h>
@@ -118,7 +120,152 @@ static inline size_t divide_round_up(size_t dividend, size_t divisor) {
 #ifdef min
 	#undef min
 #endif
+#ifdef max
+	#undef max
+#endif
 
 static inline size_t min(size_t a, size_t b) {
 	return a < b ? a : b;
 }
+
+static inline size_t max(size_t a, size_t b) {
+	return a > b ? a : b;
+}
+
+/* Returns floor(sqrt(n)) computed digit by digit in integer arithmetic */
+static inline size_t isqrt(size_t n) {
+	size_t result = 0;
+	size_t bit = (size_t) 1 << (sizeof(size_t) * 8 - 2);
+	while (bit > n) {
+		bit >>= 2;
+	}
+	while (bit != 0) {
+		if (n >= result + bit) {
+			n -= result + bit;
+			result = (result >> 1) + bit;
+		} else {
+			result >>= 1;
+		}
+		bit >>= 2;
+	}
+	return result;
+}
+
+/*
+ * Returns the column j of the item with the specified linear index in the upper triangle of a matrix, where column j
+ * contains j + 1 items and starts at linear index j * (j + 1) / 2. As j * j < 2 * index < (j + 2) * (j + 2), the
+ * column is either isqrt(2 * index) or one less.
+ */
+static inline size_t triangular_column(size_t index) {
+	const size_t column = isqrt(2 * index);
+	return column * (column + 1) / 2 <= index ? column : column - 1;
+}
+
+/*
+ * Returns the tile with the specified linear index in the Morton (Z-curve) order of a grid with rows x columns tiles.
+ * An elongated grid is first cut into square blocks along its longer dimension, which are visited one after another.
+ * Each block is recursively split into quadrants, which are visited in the order top-left, top-right, bottom-left,
+ * bottom-right, thus any contiguous range of indices maps to a compact patch of tiles. Dimensions not exceeding half of
+ * the other dimension are not split, and once a quadrant is a single row or column of tiles, it is traversed linearly.
+ */
+static inline void morton_tile(size_t index, size_t rows, size_t columns, size_t* tile_i, size_t* tile_j) {
+	size_t i = 0;
+	size_t j = 0;
+	if (columns > 2 * rows) {
+		const size_t block_tiles = rows * rows;
+		const size_t block = index / block_tiles;
+		index -= block * block_tiles;
+		j = block * rows;
+		columns = min(columns - j, rows);
+	} else if (rows > 2 * columns) {
+		const size_t block_tiles = columns * columns;
+		const size_t block = index / block_tiles;
+		index -= block * block_tiles;
+		i = block * columns;
+		rows = min(rows - i, columns);
+	}
+	while (rows > 1 && columns > 1) {
+		const size_t top_rows = 2 * rows >= columns ? rows - rows / 2 : rows;
+		const size_t left_columns = 2 * columns >= rows ? columns - columns / 2 : columns;
+		const size_t top_left = top_rows * left_columns;
+		const size_t top_right = top_rows * (columns - left_columns);
+		const size_t bottom_left = (rows - top_rows) * left_columns;
+		if (index < top_left) {
+			rows = top_rows;
+			columns = left_columns;
+		} else if (index < top_left + top_right) {
+			index -= top_left;
+			j += left_columns;
+			rows = top_rows;
+			columns -= left_columns;
+		} else if (index < top_left + top_right + bottom_left) {
+			index -= top_left + top_right;
+			i += top_rows;
+			rows -= top_rows;
+			columns = left_columns;
+		} else {
+			index -= top_left + top_right + bottom_left;
+			i += top_rows;
+			j += left_columns;
+			rows -= top_rows;
+			columns -= left_columns;
+		}
+	}
+	/* A single row or column of tiles is traversed linearly */
+	*tile_i = i + (rows > 1 ? index : 0);
+	*tile_j = j + (columns > 1 ? index : 0);
+}
+
+/*
+ * Moves the start and the size of a tile of a multi-dimensional range to the next tile in row-major order. After the
+ * last tile, the start along the first dimension is past its range. Callers pass a constant num_dims, which unrolls the
+ * loop into the odometer of the specific rank.
+ */
+static PTHREADPOOL_ALWAYS_INLINE void advance_tile_index(
+	size_t num_dims,
+	const size_t* range,
+	const size_t* tile,
+	size_t* start,
+	size_t* size)
+{
+	for (size_t d = num_dims - 1; d != 0; d--) {
+		start[d] += tile[d];
+		if (start[d] < range[d]) {
+			size[d] = min(range[d] - start[d], tile[d]);
+			return;
+		}
+		start[d] = 0;
+		size[d] = min(range[d], tile[d]);
+	}
+	start[0] += tile[0];
+	size[0] = start[0] < range[0] ? min(range[0] - start[0], tile[0]) : 0;
+}
+
+/*
+ * Moves the start and the size of a tile of a multi-dimensional range to the previous tile in row-major order, given
+ * the start of the last tile along every dimension. Must not be called for the first tile.
+ *
+ * Threads claim the items of a stolen range from its end, so consecutive stolen items are reached by stepping back
+ * from the previous item rather than by division. Only the last tile along a dimension can be partial, thus tiles
+ * stepped back into are full, unless they wrap around to the last tile.
+ */
+static PTHREADPOOL_ALWAYS_INLINE void retreat_tile_index(
+	size_t num_dims,
+	const size_t* range,
+	const size_t* last,
+	const size_t* tile,
+	size_t* start,
+	size_t* size)
+{
+	for (size_t d = num_dims - 1; d != 0; d--) {
+		if (start[d] != 0) {
+			start[d] -= tile[d];
+			size[d] = tile[d];
+			return;
+		}
+		start[d] = last[d];
+		size[d] = range[d] - last[d];
+	}
+	start[0] -= tile[0];
+	size[0] = tile[0];
+}
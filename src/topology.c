@@ -0,0 +1,809 @@
+/* Linux headers need _GNU_SOURCE for sched_getaffinity and CPU_* macros */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+	#define _GNU_SOURCE 1
+#endif
+
+/* Standard C headers */
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Configuration header */
+#include "threadpool-common.h"
+
+/* Linux headers */
+#if PTHREADPOOL_USE_TOPOLOGY
+	#include <dirent.h>
+	#include <sched.h>
+#endif
+#if PTHREADPOOL_USE_RSEQ
+	#include <sys/rseq.h>
+#endif
+
+/* Dependencies */
+#if PTHREADPOOL_USE_TOPOLOGY && PTHREADPOOL_USE_CPUINFO
+	#include <cpuinfo.h>
+#endif
+
+/* Internal library headers */
+#include "threadpool-object.h"
+#include "threadpool-utils.h"
+
+
+#if PTHREADPOOL_USE_TOPOLOGY
+
+struct processor_topology {
+	/* Linux physical_package_id of the processor */
+	uint32_t package;
+	/* Index of the NUMA node the processor belongs to */
+	uint32_t node;
+	/* Lowest Linux CPU number among the processors sharing the last-level cache with this processor */
+	uint32_t cache;
+	/* Lowest Linux CPU number among the SMT siblings of this processor */
+	uint32_t core;
+	/* Linux CPU number of the processor */
+	uint32_t cpu;
+	/* Relative performance of the processor, or 0 if unknown */
+	uint32_t capacity;
+};
+
+static bool read_sysfs_uint32(const char* path, uint32_t* value) {
+	FILE* file = fopen(path, "r");
+	if (file == NULL) {
+		return false;
+	}
+	unsigned int parsed_value = 0;
+	const bool success = fscanf(file, "%u", &parsed_value) == 1;
+	fclose(file);
+	if (success) {
+		*value = (uint32_t) parsed_value;
+	}
+	return success;
+}
+
+static bool read_sysfs_string(const char* path, char* buffer, size_t buffer_size) {
+	FILE* file = fopen(path, "r");
+	if (file == NULL) {
+		return false;
+	}
+	const bool success = fgets(buffer, (int) buffer_size, file) != NULL;
+	fclose(file);
+	return success;
+}
+
+/*
+ * Returns the lowest Linux CPU number among the processors sharing the last-level cache with the processor, or the
+ * processor itself if the caches are unknown. Last-level cache is the highest-level data or unified cache.
+ */
+static uint32_t detect_last_level_cache(uint32_t cpu) {
+	char path[128];
+	uint32_t cache = cpu;
+	uint32_t max_cache_level = 0;
+	for (uint32_t cache_index = 0; ; cache_index++) {
+		uint32_t cache_level = 0;
+		snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%" PRIu32 "/cache/index%" PRIu32 "/level", cpu, cache_index);
+		if (!read_sysfs_uint32(path, &cache_level)) {
+			break;
+		}
+
+		char cache_type[32];
+		snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%" PRIu32 "/cache/index%" PRIu32 "/type", cpu, cache_index);
+		if (!read_sysfs_string(path, cache_type, sizeof(cache_type)) || strncmp(cache_type, "Instruction", 11) == 0) {
+			continue;
+		}
+
+		if (cache_level > max_cache_level) {
+			snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%" PRIu32 "/cache/index%" PRIu32 "/shared_cpu_list", cpu, cache_index);
+			if (read_sysfs_uint32(path, &cache)) {
+				max_cache_level = cache_level;
+			}
+		}
+	}
+	return cache;
+}
+
+static void detect_processor_topology(uint32_t cpu, struct processor_topology* topology) {
+	char path[128];
+
+	/* Defaults describe a processor which does not share anything with other processors */
+	topology->package = 0;
+	topology->node = 0;
+	topology->cache = cpu;
+	topology->core = cpu;
+	topology->cpu = cpu;
+	topology->capacity = 0;
+
+	/* Kernels with asymmetric CPU capacity support report capacities normalized to 1024 for the fastest processor */
+	snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%" PRIu32 "/cpu_capacity", cpu);
+	read_sysfs_uint32(path, &topology->capacity);
+
+	snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%" PRIu32 "/topology/physical_package_id", cpu);
+	read_sysfs_uint32(path, &topology->package);
+
+	/* The first entry in a CPU list is the lowest CPU number in the list */
+	snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%" PRIu32 "/topology/thread_siblings_list", cpu);
+	read_sysfs_uint32(path, &topology->core);
+
+	topology->cache = detect_last_level_cache(cpu);
+
+	/* NUMA node is exposed as a nodeN link in the CPU directory */
+	snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%" PRIu32, cpu);
+	DIR* cpu_directory = opendir(path);
+	if (cpu_directory != NULL) {
+		struct dirent* entry;
+		while ((entry = readdir(cpu_directory)) != NULL) {
+			unsigned int node = 0;
+			if (sscanf(entry->d_name, "node%u", &node) == 1) {
+				topology->node = (uint32_t) node;
+				break;
+			}
+		}
+		closedir(cpu_directory);
+	}
+}
+
+static bool known_capacities(const struct processor_topology* processors, size_t processors_count) {
+	for (size_t i = 0; i < processors_count; i++) {
+		if (processors[i].capacity == 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static int compare_processor_topology(const void* a_ptr, const void* b_ptr) {
+	const struct processor_topology* a = (const struct processor_topology*) a_ptr;
+	const struct processor_topology* b = (const struct processor_topology*) b_ptr;
+	if (a->package != b->package) {
+		return a->package < b->package ? -1 : 1;
+	}
+	if (a->node != b->node) {
+		return a->node < b->node ? -1 : 1;
+	}
+	if (a->cache != b->cache) {
+		return a->cache < b->cache ? -1 : 1;
+	}
+	if (a->core != b->core) {
+		return a->core < b->core ? -1 : 1;
+	}
+	if (a->cpu != b->cpu) {
+		return a->cpu < b->cpu ? -1 : 1;
+	}
+	return 0;
+}
+
+/* Checks if two processors are in the same domain of the specified topology level */
+static bool same_topology_domain(const struct processor_topology* a, const struct processor_topology* b, enum threadpool_topology_level level) {
+	switch (level) {
+		case threadpool_topology_level_core:
+			if (a->core != b->core) {
+				return false;
+			}
+			/* Fall through */
+		case threadpool_topology_level_cache:
+			if (a->cache != b->cache) {
+				return false;
+			}
+			/* Fall through */
+		case threadpool_topology_level_node:
+			return a->package == b->package && a->node == b->node;
+		default:
+			return true;
+	}
+}
+
+#if PTHREADPOOL_USE_CPUINFO
+/* Uses the maximum frequency of the core, in MHz, as the capacity of processors unknown to the kernel */
+static void detect_cpuinfo_capacities(struct processor_topology* processors, size_t processors_count) {
+	if (!cpuinfo_initialize()) {
+		return;
+	}
+
+	const uint32_t cpuinfo_processors_count = cpuinfo_get_processors_count();
+	for (size_t i = 0; i < processors_count; i++) {
+		for (uint32_t j = 0; j < cpuinfo_processors_count; j++) {
+			const struct cpuinfo_processor* processor = cpuinfo_get_processor(j);
+			if (processor->linux_id == (int) processors[i].cpu) {
+				processors[i].capacity = (uint32_t) (processor->core->frequency / UINT64_C(1000000));
+				break;
+			}
+		}
+	}
+}
+#endif
+
+static bool detect_threadpool_topology(struct pthreadpool* threadpool, bool pin_threads) {
+	const size_t threads_count = threadpool->threads_count.value;
+
+	cpu_set_t allowed_cpus;
+	CPU_ZERO(&allowed_cpus);
+	if (sched_getaffinity(0, sizeof(allowed_cpus), &allowed_cpus) != 0) {
+		return false;
+	}
+
+	/*
+	 * Thread numbers are mapped to processors only if the thread pool has exactly one thread per allowed processor.
+	 * The mapping orders victims of work stealing by topology domains. Unless the worker threads are pinned, the
+	 * system scheduler may run them elsewhere, and the order is only a hint.
+	 */
+	if ((size_t) CPU_COUNT(&allowed_cpus) != threads_count) {
+		return false;
+	}
+
+	struct processor_topology* processors = malloc(threads_count * sizeof(struct processor_topology));
+	if (processors == NULL) {
+		return false;
+	}
+	size_t processors_count = 0;
+	for (uint32_t cpu = 0; cpu < CPU_SETSIZE && processors_count < threads_count; cpu++) {
+		if (CPU_ISSET(cpu, &allowed_cpus)) {
+			detect_processor_topology(cpu, &processors[processors_count++]);
+		}
+	}
+	assert(processors_count == threads_count);
+
+	/* Order processors so that every topology domain occupies a contiguous range of thread numbers */
+	qsort(processors, processors_count, sizeof(struct processor_topology), compare_processor_topology);
+
+	#if PTHREADPOOL_USE_CPUINFO
+		if (!known_capacities(processors, processors_count)) {
+			detect_cpuinfo_capacities(processors, processors_count);
+		}
+	#endif
+
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		struct thread_info* thread = &threadpool->threads[tid];
+		/* Caller thread serves as worker #0 and is never pinned */
+		thread->cpu_id = pin_threads && tid != 0 ? processors[tid].cpu : PTHREADPOOL_CPU_ID_NONE;
+		pthreadpool_store_relaxed_uint32_t(&thread->affinity_cpu, thread->cpu_id);
+		thread->victim_seed = ((uint32_t) tid + 1) * UINT32_C(0x9E3779B9);
+		for (enum threadpool_topology_level level = 0; level < threadpool_topology_levels; level++) {
+			size_t domain_start = tid;
+			while (domain_start != 0 && same_topology_domain(&processors[domain_start - 1], &processors[tid], level)) {
+				domain_start -= 1;
+			}
+			size_t domain_end = tid + 1;
+			while (domain_end != threads_count && same_topology_domain(&processors[domain_end], &processors[tid], level)) {
+				domain_end += 1;
+			}
+			thread->domain_start[level] = domain_start;
+			thread->domain_end[level] = domain_end;
+		}
+	}
+
+	/*
+	 * Capacities of processors are used only if known for all processors, and only if threads are pinned to them.
+	 * The caller thread is not pinned, but other threads occupy all other allowed processors, so it likely runs on
+	 * the remaining processor.
+	 */
+	uint32_t* capacities = NULL;
+	if (pin_threads && known_capacities(processors, processors_count)) {
+		capacities = malloc(threads_count * sizeof(uint32_t));
+		if (capacities != NULL) {
+			for (size_t tid = 0; tid < threads_count; tid++) {
+				capacities[tid] = processors[tid].capacity;
+			}
+		}
+	}
+	pthreadpool_set_capacities(threadpool, capacities);
+
+	free(capacities);
+	free(processors);
+	return true;
+}
+
+/*
+ * Returns the Linux CPU number of the processor which runs the calling thread, or PTHREADPOOL_CPU_ID_NONE if unknown.
+ * The C library registers a restartable sequences area for every thread, and the kernel keeps the CPU number in it up
+ * to date, thus reading the CPU number costs a single load.
+ */
+static uint32_t get_current_cpu(void) {
+	#if PTHREADPOOL_USE_RSEQ
+		if (__rseq_size != 0) {
+			const struct rseq* rseq_area = (const struct rseq*) ((uintptr_t) __builtin_thread_pointer() + __rseq_offset);
+			const uint32_t cpu = *((const volatile uint32_t*) &rseq_area->cpu_id);
+			/* Negative values denote a thread without a registered area */
+			if ((int32_t) cpu >= 0) {
+				return cpu;
+			}
+		}
+	#endif
+	const int cpu = sched_getcpu();
+	return cpu >= 0 ? (uint32_t) cpu : PTHREADPOOL_CPU_ID_NONE;
+}
+
+#endif  /* PTHREADPOOL_USE_TOPOLOGY */
+
+PTHREADPOOL_INTERNAL void pthreadpool_detect_topology(
+	struct pthreadpool* threadpool,
+	bool pin_threads)
+{
+	assert(threadpool != NULL);
+
+	#if PTHREADPOOL_USE_TOPOLOGY
+		if (detect_threadpool_topology(threadpool, pin_threads)) {
+			return;
+		}
+	#endif
+
+	/* Without topology information every domain contains only the thread itself */
+	const size_t threads_count = threadpool->threads_count.value;
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		struct thread_info* thread = &threadpool->threads[tid];
+		thread->cpu_id = PTHREADPOOL_CPU_ID_NONE;
+		pthreadpool_store_relaxed_uint32_t(&thread->affinity_cpu, PTHREADPOOL_CPU_ID_NONE);
+		thread->victim_seed = ((uint32_t) tid + 1) * UINT32_C(0x9E3779B9);
+		for (size_t level = 0; level < threadpool_topology_levels; level++) {
+			thread->domain_start[level] = tid;
+			thread->domain_end[level] = tid + 1;
+		}
+	}
+	pthreadpool_set_capacities(threadpool, NULL);
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_pin_thread(
+	const struct thread_info* thread)
+{
+	assert(thread != NULL);
+
+	#if PTHREADPOOL_USE_TOPOLOGY
+		if (thread->cpu_id != PTHREADPOOL_CPU_ID_NONE) {
+			cpu_set_t cpu_set;
+			CPU_ZERO(&cpu_set);
+			CPU_SET(thread->cpu_id, &cpu_set);
+			/* Failure is not critical: the thread keeps running wherever the scheduler places it */
+			sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+		}
+	#endif
+}
+
+/* Either all worker threads are pinned, or none of them; the caller thread is never pinned */
+static bool has_pinned_threads(const struct pthreadpool* threadpool) {
+	return threadpool->threads_count.value > 1 && threadpool->threads[1].cpu_id != PTHREADPOOL_CPU_ID_NONE;
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_detect_cpu_caches(
+	struct pthreadpool* threadpool)
+{
+	assert(threadpool != NULL);
+
+	#if PTHREADPOOL_USE_TOPOLOGY
+		if (threadpool->cpu_caches != NULL || has_pinned_threads(threadpool)) {
+			return;
+		}
+
+		cpu_set_t allowed_cpus;
+		CPU_ZERO(&allowed_cpus);
+		if (sched_getaffinity(0, sizeof(allowed_cpus), &allowed_cpus) != 0) {
+			return;
+		}
+
+		size_t cpu_caches_count = 0;
+		for (size_t cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+			if (CPU_ISSET(cpu, &allowed_cpus)) {
+				cpu_caches_count = cpu + 1;
+			}
+		}
+		uint32_t* cpu_caches = malloc(cpu_caches_count * sizeof(uint32_t));
+		if (cpu_caches == NULL) {
+			return;
+		}
+		for (size_t cpu = 0; cpu < cpu_caches_count; cpu++) {
+			cpu_caches[cpu] = CPU_ISSET(cpu, &allowed_cpus) ? detect_last_level_cache((uint32_t) cpu) : PTHREADPOOL_CPU_ID_NONE;
+		}
+		threadpool->cpu_caches = cpu_caches;
+		threadpool->cpu_caches_count = cpu_caches_count;
+	#endif
+}
+
+static bool claim_thread(struct thread_info* thread) {
+	size_t claimed = pthreadpool_load_relaxed_size_t(&thread->affinity_claimed);
+	return claimed == 0 && pthreadpool_compare_exchange_relaxed_size_t(&thread->affinity_claimed, &claimed, 1);
+}
+
+PTHREADPOOL_INTERNAL struct thread_info* pthreadpool_select_thread(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread)
+{
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	#if PTHREADPOOL_USE_TOPOLOGY
+		if (has_pinned_threads(threadpool)) {
+			return thread;
+		}
+
+		const size_t threads_count = threadpool->threads_count.value;
+		const uint32_t cpu = get_current_cpu();
+		struct thread_info* selected = NULL;
+		if (cpu != PTHREADPOOL_CPU_ID_NONE) {
+			for (size_t tid = 0; tid < threads_count; tid++) {
+				struct thread_info* other_thread = &threadpool->threads[tid];
+				if (pthreadpool_load_relaxed_uint32_t(&other_thread->affinity_cpu) == cpu && claim_thread(other_thread)) {
+					selected = other_thread;
+					break;
+				}
+			}
+		}
+
+		/* There are as many structures as worker threads, thus some structure is always left */
+		for (size_t tid = thread->thread_number; selected == NULL; tid = modulo_decrement(tid, threads_count)) {
+			if (claim_thread(&threadpool->threads[tid])) {
+				selected = &threadpool->threads[tid];
+			}
+		}
+		pthreadpool_store_relaxed_uint32_t(&selected->affinity_cpu, cpu);
+		return selected;
+	#else
+		return thread;
+	#endif
+}
+
+static uint32_t clamp_capacity(uint32_t capacity) {
+	if (capacity == 0) {
+		return 1;
+	} else if (capacity > PTHREADPOOL_MAX_CAPACITY) {
+		return PTHREADPOOL_MAX_CAPACITY;
+	}
+	return capacity;
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_set_capacities(
+	struct pthreadpool* threadpool,
+	const uint32_t* capacities)
+{
+	assert(threadpool != NULL);
+
+	const size_t threads_count = threadpool->threads_count.value;
+	bool equal_capacities = true;
+	uint64_t capacity_end = 0;
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		uint32_t capacity = 1;
+		if (capacities != NULL) {
+			capacity = clamp_capacity(capacities[tid]);
+			equal_capacities &= capacity == clamp_capacity(capacities[0]);
+		}
+		capacity_end += capacity;
+		threadpool->threads[tid].capacity_end = capacity_end;
+	}
+	threadpool->total_capacity = equal_capacities ? 0 : capacity_end;
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_mark_busy_threads(
+	struct pthreadpool* threadpool)
+{
+	assert(threadpool != NULL);
+
+	const size_t threads_count = threadpool->threads_count.value;
+	for (size_t word = 0; word * PTHREADPOOL_BITMAP_WORD_BITS < threads_count; word++) {
+		size_t bits = 0;
+		for (size_t bit = 0; bit < PTHREADPOOL_BITMAP_WORD_BITS; bit++) {
+			const size_t tid = word * PTHREADPOOL_BITMAP_WORD_BITS + bit;
+			if (tid < threads_count && pthreadpool_load_relaxed_size_t(&threadpool->threads[tid].range_length) != 0) {
+				bits |= (size_t) 1 << bit;
+			}
+		}
+		pthreadpool_store_relaxed_size_t(&threadpool->busy_threads[word], bits);
+	}
+}
+
+static bool is_busy_thread(const struct pthreadpool* threadpool, size_t tid) {
+	const size_t bits = pthreadpool_load_relaxed_size_t(&threadpool->busy_threads[tid / PTHREADPOOL_BITMAP_WORD_BITS]);
+	return (bits & ((size_t) 1 << (tid % PTHREADPOOL_BITMAP_WORD_BITS))) != 0;
+}
+
+PTHREADPOOL_INTERNAL bool pthreadpool_has_busy_threads(
+	const struct pthreadpool* threadpool)
+{
+	assert(threadpool != NULL);
+
+	const size_t threads_count = threadpool->threads_count.value;
+	for (size_t word = 0; word * PTHREADPOOL_BITMAP_WORD_BITS < threads_count; word++) {
+		if (pthreadpool_load_relaxed_size_t(&threadpool->busy_threads[word]) != 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_mark_busy_thread(
+	struct pthreadpool* threadpool,
+	size_t thread_number)
+{
+	pthreadpool_atomic_size_t* word = &threadpool->busy_threads[thread_number / PTHREADPOOL_BITMAP_WORD_BITS];
+	const size_t mask = (size_t) 1 << (thread_number % PTHREADPOOL_BITMAP_WORD_BITS);
+	size_t bits = pthreadpool_load_relaxed_size_t(word);
+	while ((bits & mask) == 0) {
+		if (pthreadpool_compare_exchange_relaxed_size_t(word, &bits, bits | mask)) {
+			break;
+		}
+	}
+}
+
+/*
+ * The bit is checked first to avoid writes to the shared cache line when the bit was already cleared.
+ * A thread may clear the bit right after the victim stole a new range and set the bit again. This is benign: the
+ * victim still processes the stolen range, but other threads would not steal from it.
+ */
+static void clear_busy_thread(const struct pthreadpool* threadpool, size_t tid) {
+	pthreadpool_atomic_size_t* word = &threadpool->busy_threads[tid / PTHREADPOOL_BITMAP_WORD_BITS];
+	const size_t mask = (size_t) 1 << (tid % PTHREADPOOL_BITMAP_WORD_BITS);
+	size_t bits = pthreadpool_load_relaxed_size_t(word);
+	while ((bits & mask) != 0) {
+		if (pthreadpool_compare_exchange_relaxed_size_t(word, &bits, bits & ~mask)) {
+			break;
+		}
+	}
+}
+
+/*
+ * Victims are visited domain by domain, from the innermost (SMT siblings) to the outermost (whole thread pool).
+ * Within a domain, the m victims outside the inner domain are enumerated as j = 0..m-1 in cyclically decreasing order
+ * of thread numbers, starting right below the inner domain, and visited in the order j = r, r + 1, ..., r - 1 (mod m),
+ * where r is derived from the random seed of the thread. Thus, threads which run out of work at the same time start
+ * stealing from different victims.
+ */
+static size_t next_candidate(
+	const struct pthreadpool* threadpool,
+	const struct thread_info* thread,
+	size_t victim)
+{
+	const size_t thread_number = thread->thread_number;
+	size_t inner_start = thread_number;
+	size_t inner_end = thread_number + 1;
+	for (size_t level = 0; level <= threadpool_topology_levels; level++) {
+		size_t domain_start = 0;
+		size_t domain_end = threadpool->threads_count.value;
+		if (level < threadpool_topology_levels) {
+			domain_start = thread->domain_start[level];
+			domain_end = thread->domain_end[level];
+		}
+
+		const size_t domain_size = domain_end - domain_start;
+		const size_t candidates = domain_size - (inner_end - inner_start);
+		if (candidates != 0) {
+			/* Multiply-shift maps the seed to [0, candidates) using the high bits, which are more random in xorshift */
+			const size_t offset = (size_t) (((uint64_t) thread->victim_seed * (uint64_t) candidates) >> 32);
+			size_t position = offset;
+			if (victim - domain_start < domain_size && victim - inner_start >= inner_end - inner_start) {
+				/* Continue with the next victim in this domain */
+				position = (inner_start - domain_start + domain_size - 1 - (victim - domain_start)) % domain_size + 1;
+				if (position == candidates) {
+					position = 0;
+				}
+				if (position == offset) {
+					/* All victims in this domain were visited */
+					victim = inner_start;
+					inner_start = domain_start;
+					inner_end = domain_end;
+					continue;
+				}
+			} else if (victim - inner_start >= inner_end - inner_start) {
+				/* Victim is in an outer domain */
+				inner_start = domain_start;
+				inner_end = domain_end;
+				continue;
+			}
+			return (inner_start - domain_start + domain_size - 1 - position) % domain_size + domain_start;
+		}
+		inner_start = domain_start;
+		inner_end = domain_end;
+	}
+	return thread_number;
+}
+
+static uint32_t get_cpu_cache(const struct pthreadpool* threadpool, uint32_t cpu) {
+	return cpu < threadpool->cpu_caches_count ? threadpool->cpu_caches[cpu] : PTHREADPOOL_CPU_ID_NONE;
+}
+
+static bool shares_cache(struct pthreadpool* threadpool, uint32_t cache, size_t tid) {
+	return cache != PTHREADPOOL_CPU_ID_NONE &&
+		get_cpu_cache(threadpool, pthreadpool_load_relaxed_uint32_t(&threadpool->threads[tid].affinity_cpu)) == cache;
+}
+
+/*
+ * In PTHREADPOOL_FLAG_CPU_AFFINITY computations thread numbers do not reflect the topology, as threads migrate between
+ * processors. Victims are visited in two rounds: first the threads on processors which share the last-level cache
+ * with the processor of this thread, then the other threads. Within a round, victims are visited in cyclically
+ * decreasing order of thread numbers, starting from an offset derived from the random seed of the thread.
+ */
+static size_t next_affine_candidate(
+	struct pthreadpool* threadpool,
+	const struct thread_info* thread,
+	size_t victim)
+{
+	const size_t threads_count = threadpool->threads_count.value;
+	const size_t thread_number = thread->thread_number;
+	const uint32_t cache = get_cpu_cache(threadpool,
+		pthreadpool_load_relaxed_uint32_t(&threadpool->threads[thread_number].affinity_cpu));
+	const size_t candidates = threads_count - 1;
+	const size_t offset = (size_t) (((uint64_t) thread->victim_seed * (uint64_t) candidates) >> 32);
+
+	/* Position p in a round corresponds to the victim (offset + p) % candidates + 1 threads below this thread */
+	bool near_round = true;
+	size_t position = 0;
+	if (victim != thread_number) {
+		near_round = shares_cache(threadpool, cache, victim);
+		const size_t distance = (thread_number + threads_count - victim) % threads_count;
+		position = (distance - 1 + candidates - offset) % candidates + 1;
+	}
+	for (;;) {
+		for (; position < candidates; position++) {
+			const size_t distance = (offset + position) % candidates + 1;
+			const size_t candidate = (thread_number + threads_count - distance) % threads_count;
+			if (shares_cache(threadpool, cache, candidate) == near_round) {
+				return candidate;
+			}
+		}
+		if (!near_round) {
+			return thread_number;
+		}
+		near_round = false;
+		position = 0;
+	}
+}
+
+static size_t next_busy_victim(
+	struct pthreadpool* threadpool,
+	const struct thread_info* thread,
+	size_t victim,
+	bool affine)
+{
+	const size_t thread_number = thread->thread_number;
+	if (!pthreadpool_has_busy_threads(threadpool)) {
+		return thread_number;
+	}
+	do {
+		if (affine) {
+			victim = next_affine_candidate(threadpool, thread, victim);
+		} else {
+			victim = next_candidate(threadpool, thread, victim);
+		}
+	} while (victim != thread_number && !is_busy_thread(threadpool, victim));
+	return victim;
+}
+
+/* The victim order of PTHREADPOOL_FLAG_CPU_AFFINITY computations needs the caches of processors */
+static bool is_affine_computation(const struct pthreadpool* threadpool, uint32_t flags) {
+	return (flags & PTHREADPOOL_FLAG_CPU_AFFINITY) && threadpool->cpu_caches != NULL;
+}
+
+PTHREADPOOL_INTERNAL size_t pthreadpool_first_victim(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread)
+{
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const size_t thread_number = thread->thread_number;
+	const uint32_t flags = pthreadpool_load_relaxed_uint32_t(&threadpool->flags);
+	if (flags & (PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE | PTHREADPOOL_FLAG_GUIDED_SCHEDULE)) {
+		return modulo_decrement(thread_number, threadpool->threads_count.value);
+	} else if (flags & PTHREADPOOL_FLAG_STATIC_SCHEDULE) {
+		return thread_number;
+	}
+
+	/* Xorshift32 generator */
+	uint32_t seed = thread->victim_seed;
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	thread->victim_seed = seed;
+
+	clear_busy_thread(threadpool, thread_number);
+	return next_busy_victim(threadpool, thread, thread_number, is_affine_computation(threadpool, flags));
+}
+
+PTHREADPOOL_INTERNAL size_t pthreadpool_next_victim(
+	struct pthreadpool* threadpool,
+	const struct thread_info* thread,
+	size_t victim)
+{
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const uint32_t flags = pthreadpool_load_relaxed_uint32_t(&threadpool->flags);
+	if (flags & (PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE | PTHREADPOOL_FLAG_GUIDED_SCHEDULE)) {
+		return thread->thread_number;
+	}
+
+	clear_busy_thread(threadpool, victim);
+	return next_busy_victim(threadpool, thread, victim, is_affine_computation(threadpool, flags));
+}
+
+/*
+ * Reserves the upper half of the remaining elements in a range, and returns the number of reserved elements.
+ * Fast-path parallelization functions may leave small negative values in range_length of a thread which exhausted its
+ * range, and such values denote an empty range.
+ *
+ * With item weights, reserves the upper elements which carry about half of the remaining weight, but at least one
+ * element. The end of the range may be stale if other threads reserved elements concurrently, but then the
+ * reservation fails and retries with the new length.
+ */
+static size_t reserve_half(
+	pthreadpool_atomic_size_t* range_length,
+	pthreadpool_atomic_size_t* range_end,
+	const size_t* cumulative_weights)
+{
+	size_t length = pthreadpool_load_relaxed_size_t(range_length);
+	while ((ptrdiff_t) length > 0) {
+		size_t half = length - length / 2;
+		if (cumulative_weights != NULL) {
+			/* Synchronize with the refill of a stolen range to never observe its end from a previous computation */
+			pthreadpool_fence_acquire();
+			const size_t end = pthreadpool_load_relaxed_size_t(range_end);
+			if (end >= length) {
+				const size_t start = end - length;
+				const size_t weight_start = start == 0 ? 0 : cumulative_weights[start - 1];
+				const size_t weight_end = end == 0 ? 0 : cumulative_weights[end - 1];
+				const size_t split = pthreadpool_find_weight_boundary(cumulative_weights, start, end,
+					weight_end - (weight_end - weight_start) / 2);
+				half = max(end - split, 1);
+			}
+		}
+		if (pthreadpool_compare_exchange_relaxed_size_t(range_length, &length, length - half)) {
+			return half;
+		}
+	}
+	return 0;
+}
+
+PTHREADPOOL_INTERNAL bool pthreadpool_steal_range(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread,
+	struct thread_info* other_thread,
+	size_t* index)
+{
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+	assert(other_thread != NULL);
+	assert(index != NULL);
+
+	const uint32_t flags = pthreadpool_load_relaxed_uint32_t(&threadpool->flags);
+	if (flags & (PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE | PTHREADPOOL_FLAG_GUIDED_SCHEDULE)) {
+		return pthreadpool_claim_shared_items(threadpool, thread, index);
+	}
+
+	const size_t* cumulative_weights = NULL;
+	if (flags & PTHREADPOOL_FLAG_WEIGHTED_ITEMS) {
+		cumulative_weights = threadpool->params.parallelize_1d_weighted.cumulative_weights;
+	}
+
+	/*
+	 * Other threads could reserve elements in the stolen range of this thread, but not yet claim them from stash_end.
+	 * Wait until they do to avoid overwriting stash_end under them.
+	 */
+	while (pthreadpool_load_relaxed_size_t(&thread->stash_end) != thread->stash_start) {
+		pthreadpool_yield();
+	}
+
+	size_t stolen_end;
+	size_t stolen_length = reserve_half(&other_thread->range_length, &other_thread->range_end, cumulative_weights);
+	if (stolen_length != 0) {
+		stolen_end = pthreadpool_fetch_sub_relaxed_size_t(&other_thread->range_end, stolen_length);
+	} else {
+		stolen_length = reserve_half(&other_thread->stash_length, &other_thread->stash_end, cumulative_weights);
+		if (stolen_length == 0) {
+			return false;
+		}
+		/* Synchronize with the refill of the stolen range of the other thread */
+		pthreadpool_fence_acquire();
+		stolen_end = pthreadpool_fetch_sub_relaxed_size_t(&other_thread->stash_end, stolen_length);
+	}
+
+	/* Process the last stolen element right away, and make the rest available to other threads */
+	*index = stolen_end - 1;
+	thread->stolen_items += 1;
+	if (stolen_length > 1) {
+		thread->stash_start = stolen_end - stolen_length;
+		pthreadpool_store_relaxed_size_t(&thread->stash_end, stolen_end - 1);
+		pthreadpool_store_release_size_t(&thread->stash_length, stolen_length - 1);
+		pthreadpool_mark_busy_thread(threadpool, thread->thread_number);
+	}
+	return true;
+}
@@ -36,9 +36,12 @@ static void wait_worker_threads(struct pthreadpool* threadpool, uint32_t event_i
 		return;
 	}
 
-	/* Spin-wait */
+	/* Spin-wait, helping with nested computations and task groups of the tasks which are still running */
 	for (uint32_t i = PTHREADPOOL_SPIN_WAIT_ITERATIONS; i != 0; i--) {
 		pthreadpool_yield();
+		if (!pthreadpool_help_nested_computation(threadpool)) {
+			pthreadpool_help_task_groups(threadpool);
+		}
 
 		active_threads = pthreadpool_load_acquire_size_t(&threadpool->active_threads);
 		if (active_threads == 0) {
@@ -63,9 +66,12 @@ static uint32_t wait_for_new_command(
 	}
 
 	if ((last_flags & PTHREADPOOL_FLAG_YIELD_WORKERS) == 0) {
-		/* Spin-wait loop */
+		/* Spin-wait loop, helping with nested computations and task groups of the tasks which are still running */
 		for (uint32_t i = PTHREADPOOL_SPIN_WAIT_ITERATIONS; i != 0; i--) {
 			pthreadpool_yield();
+			if (!pthreadpool_help_nested_computation(threadpool)) {
+				pthreadpool_help_task_groups(threadpool);
+			}
 
 			command = pthreadpool_load_acquire_uint32_t(&threadpool->command);
 			if (command != last_command) {
@@ -76,8 +82,22 @@ static uint32_t wait_for_new_command(
 
 	/* Spin-wait disabled or timed out, fall back to event wait */
 	const uint32_t event_index = (last_command >> 31);
-	const DWORD wait_status = WaitForSingleObject(threadpool->command_event[event_index], INFINITE);
-	assert(wait_status == WAIT_OBJECT_0);
+	const HANDLE wait_handles[2] = { threadpool->command_event[event_index], threadpool->help_semaphore };
+	for (;;) {
+		/* If both objects are signalled, the command event takes priority */
+		const DWORD wait_status = WaitForMultipleObjects(2, wait_handles, FALSE /* wait all */, INFINITE);
+		if (wait_status == WAIT_OBJECT_0) {
+			break;
+		}
+		assert(wait_status == WAIT_OBJECT_0 + 1);
+
+		/* Help with asynchronous jobs until all their items are claimed, then wait again unless a command arrived */
+		while (pthreadpool_help_nested_computation(threadpool) || pthreadpool_help_task_groups(threadpool));
+		command = pthreadpool_load_acquire_uint32_t(&threadpool->command);
+		if (command != last_command) {
+			return command;
+		}
+	}
 
 	command = pthreadpool_load_relaxed_uint32_t(&threadpool->command);
 	assert(command != last_command);
@@ -91,6 +111,8 @@ static DWORD WINAPI thread_main(LPVOID arg) {
 	struct fpu_state saved_fpu_state = { 0 };
 	uint32_t flags = 0;
 
+	pthreadpool_set_current_thread(thread);
+
 	/* Check in */
 	checkin_worker_thread(threadpool, 0);
 
@@ -151,6 +173,7 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 		threadpool->threads[tid].thread_number = tid;
 		threadpool->threads[tid].threadpool = threadpool;
 	}
+	pthreadpool_detect_topology(threadpool, false);
 
 	/* Thread pool with a single thread computes everything on the caller thread. */
 	if (threads_count > 1) {
@@ -170,6 +193,11 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 				FALSE /* initial state: nonsignaled */,
 				NULL /* name */);
 		}
+		threadpool->help_semaphore = CreateSemaphoreW(
+			NULL /* semaphore attributes */,
+			0 /* initial count */,
+			(LONG) (threads_count - 1) /* maximum count */,
+			NULL /* name */);
 
 		pthreadpool_store_relaxed_size_t(&threadpool->active_threads, threads_count - 1 /* caller thread */);
 
@@ -190,6 +218,48 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 	return threadpool;
 }
 
+struct pthreadpool* pthreadpool_create_pinned(size_t threads_count) {
+	/* Pinning threads to processors is implemented only on Linux */
+	return pthreadpool_create(threads_count);
+}
+
+/*
+ * Waits until idle threads of the thread pool process the concurrent computation. Once the caller of the running
+ * computation releases the execution mutex, helps to process the remaining items as worker #0. A task of the running
+ * computation helps to process the items in the thread information structure of its own thread.
+ */
+static void wait_concurrent_computation(
+	struct pthreadpool* threadpool,
+	struct pthreadpool* computation)
+{
+	struct thread_info* current_thread = pthreadpool_get_current_thread();
+	if (current_thread != NULL && current_thread->threadpool == threadpool) {
+		while (!pthreadpool_finish_concurrent_computation(threadpool, computation)) {
+			if (!pthreadpool_help_concurrent_computation(threadpool, computation, current_thread)) {
+				pthreadpool_yield();
+			}
+		}
+		return;
+	}
+
+	bool locked = false;
+	struct thread_info* previous_thread = NULL;
+	while (!pthreadpool_finish_concurrent_computation(threadpool, computation)) {
+		if (!locked && WaitForSingleObject(threadpool->execution_mutex, 0) == WAIT_OBJECT_0) {
+			locked = true;
+			previous_thread = pthreadpool_set_current_thread(&threadpool->threads[0]);
+		}
+		if (!locked || !pthreadpool_help_concurrent_computation(threadpool, computation, &threadpool->threads[0])) {
+			pthreadpool_yield();
+		}
+	}
+	if (locked) {
+		pthreadpool_set_current_thread(previous_thread);
+		const BOOL release_mutex_status = ReleaseMutex(threadpool->execution_mutex);
+		assert(release_mutex_status != FALSE);
+	}
+}
+
 PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	struct pthreadpool* threadpool,
 	thread_function_t thread_function,
@@ -205,9 +275,39 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	assert(task != NULL);
 	assert(linear_range > 1);
 
-	/* Protect the global threadpool structures */
-	const DWORD wait_status = WaitForSingleObject(threadpool->execution_mutex, INFINITE);
-	assert(wait_status == WAIT_OBJECT_0);
+	/* A task of the current computation already holds the execution mutex */
+	struct thread_info* current_thread = pthreadpool_get_current_thread();
+	if (current_thread != NULL && current_thread->threadpool == threadpool) {
+		pthreadpool_parallelize_nested(
+			threadpool, current_thread, thread_function, params, params_size, task, context, linear_range, flags);
+		return;
+	}
+
+	if (flags & PTHREADPOOL_FLAG_TRY) {
+		const bool busy = WaitForSingleObject(threadpool->execution_mutex, 0) != WAIT_OBJECT_0;
+		pthreadpool_set_last_try_inline(busy);
+		if (busy) {
+			/* Thread number 0 matches the computations without a thread pool */
+			pthreadpool_parallelize_inline(0, thread_function, params, params_size, task, context, linear_range, flags);
+			return;
+		}
+	} else if (flags & PTHREADPOOL_FLAG_CONCURRENT_JOBS) {
+		if (WaitForSingleObject(threadpool->execution_mutex, 0) != WAIT_OBJECT_0) {
+			struct pthreadpool* computation = pthreadpool_start_concurrent_computation(
+				threadpool, thread_function, params, params_size, task, context, linear_range, flags, false, NULL, NULL);
+			if (computation != NULL) {
+				wait_concurrent_computation(threadpool, computation);
+				return;
+			}
+			const DWORD wait_status = WaitForSingleObject(threadpool->execution_mutex, INFINITE);
+			assert(wait_status == WAIT_OBJECT_0);
+		}
+	} else {
+		/* Protect the global threadpool structures */
+		const DWORD wait_status = WaitForSingleObject(threadpool->execution_mutex, INFINITE);
+		assert(wait_status == WAIT_OBJECT_0);
+	}
+	struct thread_info* previous_thread = pthreadpool_set_current_thread(&threadpool->threads[0]);
 
 	/* Setup global arguments */
 	pthreadpool_store_relaxed_void_p(&threadpool->thread_function, (void*) thread_function);
@@ -224,19 +324,7 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	}
 
 	/* Spread the work between threads */
-	const struct fxdiv_result_size_t range_params = fxdiv_divide_size_t(linear_range, threads_count);
-	size_t range_start = 0;
-	for (size_t tid = 0; tid < threads_count.value; tid++) {
-		struct thread_info* thread = &threadpool->threads[tid];
-		const size_t range_length = range_params.quotient + (size_t) (tid < range_params.remainder);
-		const size_t range_end = range_start + range_length;
-		pthreadpool_store_relaxed_size_t(&thread->range_start, range_start);
-		pthreadpool_store_relaxed_size_t(&thread->range_end, range_end);
-		pthreadpool_store_relaxed_size_t(&thread->range_length, range_length);
-
-		/* The next subrange starts where the previous ended */
-		range_start = range_end;
-	}
+	pthreadpool_assign_ranges(threadpool, linear_range, params_size, flags);
 
 	/*
 	 * Update the threadpool command.
@@ -308,10 +396,58 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	pthreadpool_fence_acquire();
 
 	/* Unprotect the global threadpool structures */
+	pthreadpool_set_current_thread(previous_thread);
 	const BOOL release_mutex_status = ReleaseMutex(threadpool->execution_mutex);
 	assert(release_mutex_status != FALSE);
 }
 
+/*
+ * Wakes up the worker threads waiting on the command event to help with published asynchronous jobs. Unlike on
+ * pthreads, a new command can't do it: the command events switch with every command, and a worker which didn't check
+ * in for the previous command might still be about to wait on the event reset by the next one.
+ */
+static void wake_idle_workers(struct pthreadpool* threadpool) {
+	/* The release fails once the count reaches the number of worker threads, and then every worker wakes up anyway */
+	const size_t threads_count = threadpool->threads_count.value;
+	for (size_t tid = 1; tid < threads_count; tid++) {
+		if (!ReleaseSemaphore(threadpool->help_semaphore, 1, NULL)) {
+			break;
+		}
+	}
+}
+
+PTHREADPOOL_INTERNAL struct pthreadpool_job* pthreadpool_parallelize_async(
+	struct pthreadpool* threadpool,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	uint32_t flags)
+{
+	assert(threadpool != NULL);
+	assert(thread_function != NULL);
+	assert(task != NULL);
+	assert(linear_range > 1);
+
+	struct pthreadpool* computation = pthreadpool_start_concurrent_computation(
+		threadpool, thread_function, params, params_size, task, context, linear_range, flags, true, NULL, NULL);
+	if (computation == NULL) {
+		pthreadpool_parallelize(threadpool, thread_function, params, params_size, task, context, linear_range, flags);
+		return NULL;
+	}
+	wake_idle_workers(threadpool);
+	return (struct pthreadpool_job*) computation;
+}
+
+void pthreadpool_wait(pthreadpool_job_t job) {
+	if (job != NULL) {
+		struct pthreadpool* computation = (struct pthreadpool*) job;
+		wait_concurrent_computation(computation->parent_threadpool, computation);
+	}
+}
+
 void pthreadpool_destroy(struct pthreadpool* threadpool) {
 	if (threadpool != NULL) {
 		const size_t threads_count = threadpool->threads_count.value;
@@ -361,6 +497,10 @@ void pthreadpool_destroy(struct pthreadpool* threadpool) {
 					assert(close_status != FALSE);
 				}
 			}
+			if (threadpool->help_semaphore != NULL) {
+				const BOOL close_status = CloseHandle(threadpool->help_semaphore);
+				assert(close_status != FALSE);
+			}
 		}
 		pthreadpool_deallocate(threadpool);
 	}
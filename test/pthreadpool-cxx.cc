@@ -152,6 +152,30 @@ TEST(Parallelize1D, EachItemProcessedOnce) {
 	}
 }
 
+TEST(Parallelize1DWeighted, EachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	std::vector<size_t> cumulative_weights(kParallelize1DRange);
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		cumulative_weights[i] = (i + 1) * (i + 2) / 2;
+	}
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_1d_weighted(
+		threadpool.get(),
+		[&counters](size_t i) {
+			counters[i].fetch_add(1, std::memory_order_relaxed);
+		},
+		cumulative_weights.data(),
+		kParallelize1DRange);
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
+}
+
 TEST(Parallelize1DTile1D, ThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -232,6 +256,77 @@ TEST(Parallelize1DTile1D, EachItemProcessedOnce) {
 	}
 }
 
+TEST(Parallelize1DRange, EachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DTile1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_1d_range(
+		threadpool.get(),
+		[&counters](size_t start, size_t end) {
+			for (size_t i = start; i < end; i++) {
+				counters[i].fetch_add(1, std::memory_order_relaxed);
+			}
+		},
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile);
+
+	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
+}
+
+TEST(Parallelize1DIndexedTile1D, EachListedItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	std::vector<size_t> indices;
+	for (size_t i = 0; i < kParallelize1DRange; i += 2) {
+		indices.push_back(i);
+	}
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_1d_indexed_tile_1d(
+		threadpool.get(),
+		[&counters](const size_t* indices, size_t count) {
+			for (size_t p = 0; p < count; p++) {
+				counters[indices[p]].fetch_add(1, std::memory_order_relaxed);
+			}
+		},
+		indices.data(), indices.size(), kParallelize1DTile1DTile);
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), i % 2 == 0 ? 1 : 0)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times";
+	}
+}
+
+TEST(ParallelizeRagged2DTile1D, EachItemProcessedOnce) {
+	std::vector<size_t> row_offsets(kParallelize2DRangeI + 1);
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		row_offsets[i + 1] = row_offsets[i] + (i * 7) % kParallelize2DRangeJ;
+	}
+	std::vector<std::atomic_int> counters(row_offsets.back());
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_ragged_2d_tile_1d(
+		threadpool.get(),
+		[&counters, &row_offsets](size_t i, size_t start_k, size_t count_k) {
+			for (size_t k = start_k; k < start_k + count_k; k++) {
+				counters[row_offsets[i] + k].fetch_add(1, std::memory_order_relaxed);
+			}
+		},
+		row_offsets.data(), kParallelize2DRangeI, kParallelize1DTile1DTile);
+
+	for (size_t i = 0; i < counters.size(); i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
+}
+
 TEST(Parallelize2D, ThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -302,6 +397,60 @@ TEST(Parallelize2D, EachItemProcessedOnce) {
 	}
 }
 
+TEST(Parallelize2D, NestedEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d(
+		threadpool.get(),
+		[&counters, &threadpool](size_t i, size_t j) {
+			pthreadpool_parallelize_1d(
+				threadpool.get(),
+				[&counters, i, j](size_t k) {
+					const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
+					counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+				},
+				kParallelize3DRangeK);
+		},
+		kParallelize3DRangeI, kParallelize3DRangeJ);
+
+	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
+		}
+	}
+}
+
+TEST(Parallelize2DTriangular, EachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeJ * kParallelize2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_triangular(
+		threadpool.get(),
+		[&counters](size_t i, size_t j) {
+			counters[i * kParallelize2DRangeJ + j].fetch_add(1, std::memory_order_relaxed);
+		},
+		kParallelize2DRangeJ);
+
+	for (size_t i = 0; i < kParallelize2DRangeJ; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), i <= j ? 1 : 0)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times";
+		}
+	}
+}
+
 TEST(Parallelize2DTile1D, ThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -497,6 +646,35 @@ TEST(Parallelize2DTile2D, EachItemProcessedOnce) {
 	}
 }
 
+TEST(Parallelize2DTile2DWavefront, DependenciesSatisfied) {
+	std::vector<uint64_t> paths(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d_wavefront(
+		threadpool.get(),
+		[&paths](size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+			for (size_t i = start_i; i < start_i + tile_i; i++) {
+				for (size_t j = start_j; j < start_j + tile_j; j++) {
+					const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+					paths[linear_idx] = i == 0 || j == 0 ? 1 :
+						paths[linear_idx - kParallelize2DTile2DRangeJ] + paths[linear_idx - 1];
+				}
+			}
+		},
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ);
+
+	for (size_t i = 1; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 1; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(paths[linear_idx], paths[linear_idx - kParallelize2DTile2DRangeJ] + paths[linear_idx - 1])
+				<< "Element (" << i << ", " << j << ") computed before its dependencies";
+		}
+	}
+}
+
 TEST(Parallelize3D, ThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -1723,3 +1901,54 @@ TEST(Parallelize6DTile2D, EachItemProcessedOnce) {
 		}
 	}
 }
+
+TEST(ParallelizeND, EachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+	const size_t range[3] = { kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK };
+	const size_t tile[3] = { 1, kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK };
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_nd(
+		threadpool.get(),
+		[&counters](const size_t* index, const size_t* tile_size) {
+			for (size_t i = index[0]; i < index[0] + tile_size[0]; i++) {
+				for (size_t j = index[1]; j < index[1] + tile_size[1]; j++) {
+					for (size_t k = index[2]; k < index[2] + tile_size[2]; k++) {
+						const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+						counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+					}
+				}
+			}
+		},
+		3, range, tile);
+
+	for (size_t i = 0; i < counters.size(); i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
+}
+
+TEST(ParallelizeNDRange, EachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+	const size_t range[3] = { kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK };
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_nd_range(
+		threadpool.get(),
+		[&counters](const size_t* index, size_t start_k, size_t end_k) {
+			for (size_t k = start_k; k < end_k; k++) {
+				const size_t linear_idx = (index[0] * kParallelize3DTile2DRangeJ + index[1]) * kParallelize3DTile2DRangeK + k;
+				counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+			}
+		},
+		3, range, kParallelize3DTile2DTileK);
+
+	for (size_t i = 0; i < counters.size(); i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
+}
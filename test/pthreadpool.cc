@@ -4,8 +4,15 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <memory>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+	#include <poll.h>
+#endif
 
 
 typedef std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_pthreadpool_t;
@@ -89,11 +96,23 @@ const size_t kParallelize6DTile2DRangeM = 19;
 const size_t kParallelize6DTile2DRangeN = 23;
 const size_t kParallelize6DTile2DTileM = 3;
 const size_t kParallelize6DTile2DTileN = 2;
+const size_t kParallelizeRagged2DRows = 67;
+const size_t kParallelizeRagged2DTile1DTile = 13;
+const size_t kParallelize1DRangeAlignment = 16;
+const size_t kParallelize2DRangeAlignmentJ = 4;
+const size_t kParallelizeND2DRange[] = { kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ };
+const size_t kParallelizeND2DTile[] = { kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ };
+const size_t kParallelizeND4DRange[] = { 3, 5, 7, 11 };
+const size_t kParallelizeND7DRange[] = { 3, 2, 5, 3, 2, 4, 7 };
+const size_t kParallelizeND7DTile[] = { 1, 2, 2, 1, 1, 3, 2 };
+const size_t kParallelizeNDRangeAlignment = 3;
 
 const size_t kIncrementIterations = 101;
 const size_t kIncrementIterations5D = 7;
 const size_t kIncrementIterations6D = 3;
 
+const size_t kConcurrentCallers = 2;
+
 const uint32_t kMaxUArchIndex = 0;
 const uint32_t kDefaultUArchIndex = 42;
 
@@ -115,6 +134,12 @@ TEST(CreateAndDestroy, MultiThreadPool) {
 	pthreadpool_destroy(threadpool);
 }
 
+TEST(CreateAndDestroy, PinnedMultiThreadPool) {
+	pthreadpool* threadpool = pthreadpool_create_pinned(0);
+	ASSERT_TRUE(threadpool);
+	pthreadpool_destroy(threadpool);
+}
+
 static void ComputeNothing1D(void*, size_t) {
 }
 
@@ -223,6 +248,29 @@ TEST(Parallelize1D, MultiThreadPoolAllItemsProcessed) {
 	}
 }
 
+TEST(Parallelize1D, PinnedMultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create_pinned(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(SetTrue1D),
+		static_cast<void*>(indicators.data()),
+		kParallelize1DRange,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_TRUE(indicators[i].load(std::memory_order_relaxed))
+			<< "Element " << i << " not processed";
+	}
+}
+
 static void Increment1D(std::atomic_int* processed_counters, size_t i) {
 	processed_counters[i].fetch_add(1, std::memory_order_relaxed);
 }
@@ -269,29 +317,7 @@ TEST(Parallelize1D, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize1DRange);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_1d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
-			static_cast<void*>(counters.data()),
-			kParallelize1DRange,
-			0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize1DRange; i++) {
-		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
-			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
-			<< "(expected: " << kIncrementIterations << ")";
-	}
-}
-
-TEST(Parallelize1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+TEST(Parallelize1D, MultiThreadPoolBatchClaimsEachItemProcessedOnce) {
 	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -301,28 +327,21 @@ TEST(Parallelize1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_1d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
-			static_cast<void*>(counters.data()),
-			kParallelize1DRange,
-			0 /* flags */);
-	}
+	pthreadpool_parallelize_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_BATCH_CLAIMS);
 
 	for (size_t i = 0; i < kParallelize1DRange; i++) {
-		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
-			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
-			<< "(expected: " << kIncrementIterations << ")";
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-static void IncrementSame1D(std::atomic_int* num_processed_items, size_t i) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-}
-
-TEST(Parallelize1D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize1D, MultiThreadPoolStaticScheduleEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -333,25 +352,19 @@ TEST(Parallelize1D, MultiThreadPoolHighContention) {
 
 	pthreadpool_parallelize_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_t>(IncrementSame1D),
-		static_cast<void*>(&num_processed_items),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
 		kParallelize1DRange,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
-}
+		PTHREADPOOL_FLAG_STATIC_SCHEDULE);
 
-static void WorkImbalance1D(std::atomic_int* num_processed_items, size_t i) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize1DRange) {
-			std::atomic_thread_fence(std::memory_order_acquire);
-		}
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize1D, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize1D, MultiThreadPoolDynamicScheduleEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -362,60 +375,20 @@ TEST(Parallelize1D, MultiThreadPoolWorkStealing) {
 
 	pthreadpool_parallelize_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_t>(WorkImbalance1D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize1DRange,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
-}
-
-static void ComputeNothing1DWithThread(void*, size_t, size_t) {
-}
-
-TEST(Parallelize1DWithThread, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_1d_with_thread(threadpool.get(),
-		ComputeNothing1DWithThread,
-		nullptr,
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
 		kParallelize1DRange,
-		0 /* flags */);
-}
-
-TEST(Parallelize1DWithThread, MultiThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
+		PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE);
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
-
-	pthreadpool_parallelize_1d_with_thread(
-		threadpool.get(),
-		ComputeNothing1DWithThread,
-		nullptr,
-		kParallelize1DRange,
-		0 /* flags */);
-}
-
-static void CheckBounds1DWithThread(void*, size_t, size_t i) {
-	EXPECT_LT(i, kParallelize1DRange);
 }
 
-TEST(Parallelize1DWithThread, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_1d_with_thread(
-		threadpool.get(),
-		CheckBounds1DWithThread,
-		nullptr,
-		kParallelize1DRange,
-		0 /* flags */);
-}
+TEST(Parallelize1D, MultiThreadPoolDynamicScheduleBatchClaimsEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
-TEST(Parallelize1DWithThread, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -423,39 +396,21 @@ TEST(Parallelize1DWithThread, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_with_thread(
-		threadpool.get(),
-		CheckBounds1DWithThread,
-		nullptr,
-		kParallelize1DRange,
-		0 /* flags */);
-}
-
-static void SetTrue1DWithThread(std::atomic_bool* processed_indicators, size_t, size_t i) {
-	processed_indicators[i].store(true, std::memory_order_relaxed);
-}
-
-TEST(Parallelize1DWithThread, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize1DRange);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_1d_with_thread(
+	pthreadpool_parallelize_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(SetTrue1DWithThread),
-		static_cast<void*>(indicators.data()),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
 		kParallelize1DRange,
-		0 /* flags */);
+		PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE | PTHREADPOOL_FLAG_BATCH_CLAIMS);
 
 	for (size_t i = 0; i < kParallelize1DRange; i++) {
-		EXPECT_TRUE(indicators[i].load(std::memory_order_relaxed))
-			<< "Element " << i << " not processed";
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize1DWithThread, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize1DRange);
+TEST(Parallelize1D, MultiThreadPoolGuidedScheduleEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -464,43 +419,42 @@ TEST(Parallelize1DWithThread, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_with_thread(
+	pthreadpool_parallelize_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(SetTrue1DWithThread),
-		static_cast<void*>(indicators.data()),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
 		kParallelize1DRange,
-		0 /* flags */);
+		PTHREADPOOL_FLAG_GUIDED_SCHEDULE);
 
 	for (size_t i = 0; i < kParallelize1DRange; i++) {
-		EXPECT_TRUE(indicators[i].load(std::memory_order_relaxed))
-			<< "Element " << i << " not processed";
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-static void Increment1DWithThread(std::atomic_int* processed_counters, size_t, size_t i) {
-	processed_counters[i].fetch_add(1, std::memory_order_relaxed);
-}
-
-TEST(Parallelize1DWithThread, SingleThreadPoolEachItemProcessedOnce) {
+TEST(Parallelize1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
 	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_1d_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(Increment1DWithThread),
-		static_cast<void*>(counters.data()),
-		kParallelize1DRange,
-		0 /* flags */);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(counters.data()),
+			kParallelize1DRange,
+			0 /* flags */);
+	}
 
 	for (size_t i = 0; i < kParallelize1DRange; i++) {
-		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
-			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-TEST(Parallelize1DWithThread, MultiThreadPoolEachItemProcessedOnce) {
+TEST(Parallelize1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -510,29 +464,10 @@ TEST(Parallelize1DWithThread, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(Increment1DWithThread),
-		static_cast<void*>(counters.data()),
-		kParallelize1DRange,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize1DRange; i++) {
-		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
-			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
-	}
-}
-
-TEST(Parallelize1DWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize1DRange);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_1d_with_thread(
+		pthreadpool_parallelize_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_1d_with_thread_t>(Increment1DWithThread),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
 			static_cast<void*>(counters.data()),
 			kParallelize1DRange,
 			0 /* flags */);
@@ -545,7 +480,7 @@ TEST(Parallelize1DWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-TEST(Parallelize1DWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
+TEST(Parallelize1D, MultiThreadPoolAdaptivePartitionEachItemProcessedMultipleTimes) {
 	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -556,12 +491,12 @@ TEST(Parallelize1DWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_1d_with_thread(
+		pthreadpool_parallelize_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_1d_with_thread_t>(Increment1DWithThread),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
 			static_cast<void*>(counters.data()),
 			kParallelize1DRange,
-			0 /* flags */);
+			PTHREADPOOL_FLAG_ADAPTIVE_PARTITION);
 	}
 
 	for (size_t i = 0; i < kParallelize1DRange; i++) {
@@ -571,12 +506,8 @@ TEST(Parallelize1DWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-static void IncrementSame1DWithThread(std::atomic_int* num_processed_items, size_t, size_t i) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-}
-
-TEST(Parallelize1DWithThread, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize1D, MultiThreadPoolCpuAffinityEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -585,28 +516,23 @@ TEST(Parallelize1DWithThread, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(IncrementSame1DWithThread),
-		static_cast<void*>(&num_processed_items),
-		kParallelize1DRange,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
-}
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(counters.data()),
+			kParallelize1DRange,
+			PTHREADPOOL_FLAG_CPU_AFFINITY);
+	}
 
-static void WorkImbalance1DWithThread(std::atomic_int* num_processed_items, size_t, size_t i) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize1DRange) {
-			std::atomic_thread_fence(std::memory_order_acquire);
-		}
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-TEST(Parallelize1DWithThread, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
-
+TEST(Parallelize1D, MultiThreadPoolConcurrentJobsEachItemProcessedMultipleTimes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -614,53 +540,97 @@ TEST(Parallelize1DWithThread, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(WorkImbalance1DWithThread),
-		static_cast<void*>(&num_processed_items),
-		kParallelize1DRange,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
+	std::vector<std::vector<std::atomic_int>> counters(kConcurrentCallers);
+	std::vector<std::thread> callers;
+	for (size_t caller = 0; caller < kConcurrentCallers; caller++) {
+		counters[caller] = std::vector<std::atomic_int>(kParallelize1DRange);
+		callers.emplace_back([&threadpool, &counters, caller]() {
+			for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+				pthreadpool_parallelize_1d(
+					threadpool.get(),
+					reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+					static_cast<void*>(counters[caller].data()),
+					kParallelize1DRange,
+					PTHREADPOOL_FLAG_CONCURRENT_JOBS);
+			}
+		});
+	}
+	for (std::thread& caller : callers) {
+		caller.join();
+	}
+
+	for (size_t caller = 0; caller < kConcurrentCallers; caller++) {
+		for (size_t i = 0; i < kParallelize1DRange; i++) {
+			EXPECT_EQ(counters[caller][i].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element " << i << " of caller " << caller << " was processed "
+				<< counters[caller][i].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
+		}
+	}
 }
 
-static void CheckThreadIndexValid1DWithThread(const size_t* num_threads, size_t thread_index, size_t) {
-	EXPECT_LE(thread_index, *num_threads);
+struct ConcurrentJobsContext {
+	std::atomic_bool outer_started;
+	std::atomic_bool concurrent_finished;
+};
+
+static void WaitForConcurrentJob1D(ConcurrentJobsContext* context, size_t i) {
+	if (i == 0) {
+		context->outer_started.store(true, std::memory_order_relaxed);
+		/* Spin-wait until the concurrent computation finishes, or give up to report the failure */
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+		while (!context->concurrent_finished.load(std::memory_order_relaxed) && std::chrono::steady_clock::now() < deadline) {
+			std::this_thread::yield();
+		}
+	}
 }
 
-TEST(Parallelize1DWithThread, MultiThreadPoolThreadIndexValid) {
+TEST(Parallelize1D, MultiThreadPoolConcurrentJobsFinishDuringOtherJob) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
-	if (num_threads <= 1) {
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_with_thread(
+	ConcurrentJobsContext context;
+	context.outer_started.store(false, std::memory_order_relaxed);
+	context.concurrent_finished.store(false, std::memory_order_relaxed);
+	std::thread caller([&threadpool, &counters, &context]() {
+		while (!context.outer_started.load(std::memory_order_relaxed)) {
+			std::this_thread::yield();
+		}
+		pthreadpool_parallelize_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(counters.data()),
+			kParallelize1DRange,
+			PTHREADPOOL_FLAG_CONCURRENT_JOBS);
+		context.concurrent_finished.store(true, std::memory_order_relaxed);
+	});
+
+	pthreadpool_parallelize_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(CheckThreadIndexValid1DWithThread),
-		static_cast<void*>(&num_threads),
+		reinterpret_cast<pthreadpool_task_1d_t>(WaitForConcurrentJob1D),
+		static_cast<void*>(&context),
 		kParallelize1DRange,
 		0 /* flags */);
-}
+	EXPECT_TRUE(context.concurrent_finished.load(std::memory_order_relaxed))
+		<< "Concurrent computation didn't finish while the other computation was running";
+	caller.join();
 
-static void ComputeNothing1DWithUArch(void*, uint32_t, size_t) {
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: 1)";
+	}
 }
 
-TEST(Parallelize1DWithUArch, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_1d_with_uarch(threadpool.get(),
-		ComputeNothing1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex,
-		kMaxUArchIndex,
-		kParallelize1DRange,
-		0 /* flags */);
-}
+TEST(Parallelize1D, MultiThreadPoolTryIdleThreadPool) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
-TEST(Parallelize1DWithUArch, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -668,36 +638,37 @@ TEST(Parallelize1DWithUArch, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_with_uarch(
+	pthreadpool_parallelize_1d(
 		threadpool.get(),
-		ComputeNothing1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex,
-		kMaxUArchIndex,
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
 		kParallelize1DRange,
-		0 /* flags */);
-}
+		PTHREADPOOL_FLAG_TRY);
+	EXPECT_EQ(pthreadpool_last_try_ran_inline(), 0);
 
-static void CheckUArch1DWithUArch(void*, uint32_t uarch_index, size_t) {
-	if (uarch_index != kDefaultUArchIndex) {
-		EXPECT_LE(uarch_index, kMaxUArchIndex);
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: 1)";
 	}
 }
 
-TEST(Parallelize1DWithUArch, SingleThreadPoolUArchInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
+struct TryBusyContext {
+	std::atomic_int* processed_counters;
+	std::thread::id caller;
+	std::atomic_bool other_thread;
+};
 
-	pthreadpool_parallelize_1d_with_uarch(threadpool.get(),
-		CheckUArch1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex,
-		kMaxUArchIndex,
-		kParallelize1DRange,
-		0 /* flags */);
+static void IncrementOnCaller1D(TryBusyContext* context, size_t i) {
+	context->processed_counters[i].fetch_add(1, std::memory_order_relaxed);
+	if (std::this_thread::get_id() != context->caller) {
+		context->other_thread.store(true, std::memory_order_relaxed);
+	}
 }
 
-TEST(Parallelize1DWithUArch, MultiThreadPoolUArchInBounds) {
+TEST(Parallelize1D, MultiThreadPoolTryBusyThreadPoolRunsInline) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -705,35 +676,50 @@ TEST(Parallelize1DWithUArch, MultiThreadPoolUArchInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_with_uarch(
+	/* The first computation waits until the second one finishes */
+	ConcurrentJobsContext busy_context;
+	busy_context.outer_started.store(false, std::memory_order_relaxed);
+	busy_context.concurrent_finished.store(false, std::memory_order_relaxed);
+	int ran_inline = 0;
+	TryBusyContext try_context;
+	try_context.processed_counters = counters.data();
+	try_context.other_thread.store(false, std::memory_order_relaxed);
+	std::thread caller([&threadpool, &busy_context, &try_context, &ran_inline]() {
+		try_context.caller = std::this_thread::get_id();
+		while (!busy_context.outer_started.load(std::memory_order_relaxed)) {
+			std::this_thread::yield();
+		}
+		pthreadpool_parallelize_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(IncrementOnCaller1D),
+			static_cast<void*>(&try_context),
+			kParallelize1DRange,
+			PTHREADPOOL_FLAG_TRY);
+		ran_inline = pthreadpool_last_try_ran_inline();
+		busy_context.concurrent_finished.store(true, std::memory_order_relaxed);
+	});
+
+	pthreadpool_parallelize_1d(
 		threadpool.get(),
-		CheckUArch1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex,
-		kMaxUArchIndex,
+		reinterpret_cast<pthreadpool_task_1d_t>(WaitForConcurrentJob1D),
+		static_cast<void*>(&busy_context),
 		kParallelize1DRange,
 		0 /* flags */);
-}
+	caller.join();
 
-static void CheckBounds1DWithUArch(void*, uint32_t, size_t i) {
-	EXPECT_LT(i, kParallelize1DRange);
+	EXPECT_EQ(ran_inline, 1);
+	EXPECT_FALSE(try_context.other_thread.load(std::memory_order_relaxed))
+		<< "Items were processed by threads other than the caller";
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: 1)";
+	}
 }
 
-TEST(Parallelize1DWithUArch, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_1d_with_uarch(
-		threadpool.get(),
-		CheckBounds1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex,
-		kMaxUArchIndex,
-		kParallelize1DRange,
-		0 /* flags */);
-}
+TEST(Parallelize1D, MultiThreadPoolTrySequentialAfterBusyThreadPool) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
-TEST(Parallelize1DWithUArch, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -741,43 +727,78 @@ TEST(Parallelize1DWithUArch, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_with_uarch(
+	/* The first computation waits until the second one finishes */
+	ConcurrentJobsContext busy_context;
+	busy_context.outer_started.store(false, std::memory_order_relaxed);
+	busy_context.concurrent_finished.store(false, std::memory_order_relaxed);
+	int busy_ran_inline = 0;
+	int sequential_ran_inline = 1;
+	std::thread caller([&threadpool, &busy_context, &counters, &busy_ran_inline, &sequential_ran_inline]() {
+		while (!busy_context.outer_started.load(std::memory_order_relaxed)) {
+			std::this_thread::yield();
+		}
+		pthreadpool_parallelize_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(counters.data()),
+			kParallelize1DRange,
+			PTHREADPOOL_FLAG_TRY);
+		busy_ran_inline = pthreadpool_last_try_ran_inline();
+
+		/* A single item is processed on the calling thread without trying to lock the thread pool */
+		pthreadpool_parallelize_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(counters.data()),
+			1 /* range */,
+			PTHREADPOOL_FLAG_TRY);
+		sequential_ran_inline = pthreadpool_last_try_ran_inline();
+		busy_context.concurrent_finished.store(true, std::memory_order_relaxed);
+	});
+
+	pthreadpool_parallelize_1d(
 		threadpool.get(),
-		CheckBounds1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex,
-		kMaxUArchIndex,
+		reinterpret_cast<pthreadpool_task_1d_t>(WaitForConcurrentJob1D),
+		static_cast<void*>(&busy_context),
 		kParallelize1DRange,
 		0 /* flags */);
-}
+	caller.join();
 
-static void SetTrue1DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i) {
-	processed_indicators[i].store(true, std::memory_order_relaxed);
+	EXPECT_EQ(busy_ran_inline, 1);
+	EXPECT_EQ(sequential_ran_inline, 0);
+	EXPECT_EQ(counters[0].load(std::memory_order_relaxed), 2);
+	for (size_t i = 1; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: 1)";
+	}
 }
 
-TEST(Parallelize1DWithUArch, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize1DRange);
+TEST(Parallelize1D, SingleThreadPoolAsyncProcessesItemsBeforeReturning) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_1d_with_uarch(
+	pthreadpool_job_t job = pthreadpool_parallelize_1d_async(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_with_id_t>(SetTrue1DWithUArch),
-		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex,
-		kMaxUArchIndex,
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
 		kParallelize1DRange,
 		0 /* flags */);
+	EXPECT_EQ(job, nullptr);
+	EXPECT_EQ(pthreadpool_test(job), 1);
+	pthreadpool_wait(job);
 
 	for (size_t i = 0; i < kParallelize1DRange; i++) {
-		EXPECT_TRUE(indicators[i].load(std::memory_order_relaxed))
-			<< "Element " << i << " not processed";
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: 1)";
 	}
 }
 
-TEST(Parallelize1DWithUArch, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize1DRange);
+TEST(Parallelize1D, MultiThreadPoolAsyncEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -786,47 +807,57 @@ TEST(Parallelize1DWithUArch, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_with_uarch(
+	pthreadpool_job_t job = pthreadpool_parallelize_1d_async(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_with_id_t>(SetTrue1DWithUArch),
-		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex,
-		kMaxUArchIndex,
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
 		kParallelize1DRange,
 		0 /* flags */);
+	pthreadpool_wait(job);
 
 	for (size_t i = 0; i < kParallelize1DRange; i++) {
-		EXPECT_TRUE(indicators[i].load(std::memory_order_relaxed))
-			<< "Element " << i << " not processed";
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: 1)";
 	}
 }
 
-static void Increment1DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i) {
-	processed_counters[i].fetch_add(1, std::memory_order_relaxed);
-}
-
-TEST(Parallelize1DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
+TEST(Parallelize1D, MultiThreadPoolAsyncCompletesWithoutWaiting) {
 	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_1d_with_uarch(
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_job_t job = pthreadpool_parallelize_1d_async(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_with_id_t>(Increment1DWithUArch),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex,
-		kMaxUArchIndex,
 		kParallelize1DRange,
 		0 /* flags */);
+	ASSERT_NE(job, nullptr);
+
+	/* Poll until the worker threads finish the job, or give up to report the failure */
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+	while (!pthreadpool_test(job) && std::chrono::steady_clock::now() < deadline) {
+		std::this_thread::yield();
+	}
+	EXPECT_EQ(pthreadpool_test(job), 1)
+		<< "Worker threads didn't finish the job without help from the caller";
+	pthreadpool_wait(job);
 
 	for (size_t i = 0; i < kParallelize1DRange; i++) {
 		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
-			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: 1)";
 	}
 }
 
-TEST(Parallelize1DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
+#if defined(__linux__)
+TEST(Parallelize1D, MultiThreadPoolAsyncJobFdBecomesReadable) {
 	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -836,47 +867,72 @@ TEST(Parallelize1DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_with_uarch(
+	pthreadpool_job_t job = pthreadpool_parallelize_1d_async(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_with_id_t>(Increment1DWithUArch),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex,
-		kMaxUArchIndex,
 		kParallelize1DRange,
 		0 /* flags */);
+	ASSERT_NE(job, nullptr);
+
+	struct pollfd job_fd = { pthreadpool_get_job_fd(job), POLLIN, 0 };
+	ASSERT_GE(job_fd.fd, 0);
+	EXPECT_EQ(poll(&job_fd, 1, 10000 /* milliseconds */), 1)
+		<< "Job file descriptor didn't become readable";
+	EXPECT_EQ(pthreadpool_test(job), 1);
+	pthreadpool_wait(job);
 
 	for (size_t i = 0; i < kParallelize1DRange; i++) {
 		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
-			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: 1)";
 	}
 }
+#endif
 
-TEST(Parallelize1DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
+TEST(Parallelize1D, MultiThreadPoolAsyncDuringSynchronousComputation) {
+	std::vector<std::atomic_int> async_counters(kParallelize1DRange);
 	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_job_t job = pthreadpool_parallelize_1d_async(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(async_counters.data()),
+		kParallelize1DRange,
+		0 /* flags */);
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_1d_with_uarch(
+		pthreadpool_parallelize_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_1d_with_id_t>(Increment1DWithUArch),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex,
-			kMaxUArchIndex,
 			kParallelize1DRange,
 			0 /* flags */);
 	}
+	pthreadpool_wait(job);
 
 	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(async_counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " of the job was processed " << async_counters[i].load(std::memory_order_relaxed)
+			<< " times (expected: 1)";
 		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
 			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
 			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-TEST(Parallelize1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize1DRange);
+static void IncrementSame1D(std::atomic_int* num_processed_items, size_t i) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+}
+
+TEST(Parallelize1D, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -885,29 +941,26 @@ TEST(Parallelize1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_1d_with_uarch(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_1d_with_id_t>(Increment1DWithUArch),
-			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex,
-			kMaxUArchIndex,
-			kParallelize1DRange,
-			0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize1DRange; i++) {
-		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
-			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
-			<< "(expected: " << kIncrementIterations << ")";
-	}
+	pthreadpool_parallelize_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(IncrementSame1D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize1DRange,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
 }
 
-static void IncrementSame1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i) {
+static void WorkImbalance1D(std::atomic_int* num_processed_items, size_t i) {
 	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	if (i == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize1DRange) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
 }
 
-TEST(Parallelize1DWithUArch, MultiThreadPoolHighContention) {
+TEST(Parallelize1D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -917,28 +970,16 @@ TEST(Parallelize1DWithUArch, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_with_uarch(
+	pthreadpool_parallelize_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_with_id_t>(IncrementSame1DWithUArch),
+		reinterpret_cast<pthreadpool_task_1d_t>(WorkImbalance1D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex,
-		kMaxUArchIndex,
 		kParallelize1DRange,
 		0 /* flags */);
 	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
 }
 
-static void WorkImbalance1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize1DRange) {
-			std::atomic_thread_fence(std::memory_order_acquire);
-		}
-	}
-}
-
-TEST(Parallelize1DWithUArch, MultiThreadPoolWorkStealing) {
+TEST(Parallelize1D, MultiThreadPoolDynamicScheduleWorkImbalance) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -948,32 +989,71 @@ TEST(Parallelize1DWithUArch, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_with_uarch(
+	pthreadpool_parallelize_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_with_id_t>(WorkImbalance1DWithUArch),
+		reinterpret_cast<pthreadpool_task_1d_t>(WorkImbalance1D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex,
-		kMaxUArchIndex,
 		kParallelize1DRange,
-		0 /* flags */);
+		PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE);
 	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
 }
 
-static void ComputeNothing1DTile1D(void*, size_t, size_t) {
+TEST(Parallelize1D, MultiThreadPoolAdaptivePartitionWorkStealing) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+		pthreadpool_parallelize_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(WorkImbalance1D),
+			static_cast<void*>(&num_processed_items),
+			kParallelize1DRange,
+			PTHREADPOOL_FLAG_ADAPTIVE_PARTITION);
+		EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
+	}
 }
 
-TEST(Parallelize1DTile1D, SingleThreadPoolCompletes) {
+/* Weights of the first items are so large that one thread never gets all of them */
+static std::vector<size_t> SkewedCumulativeWeights1D() {
+	std::vector<size_t> cumulative_weights(kParallelize1DRange);
+	size_t total_weight = 0;
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		total_weight += i < 8 ? 1000 : 1;
+		cumulative_weights[i] = total_weight;
+	}
+	return cumulative_weights;
+}
+
+TEST(Parallelize1DWeighted, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	const std::vector<size_t> cumulative_weights = SkewedCumulativeWeights1D();
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_1d_tile_1d(threadpool.get(),
-		ComputeNothing1DTile1D,
-		nullptr,
-		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+	pthreadpool_parallelize_1d_weighted(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		cumulative_weights.data(),
+		kParallelize1DRange,
 		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
 }
 
-TEST(Parallelize1DTile1D, MultiThreadPoolCompletes) {
+TEST(Parallelize1DWeighted, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	const std::vector<size_t> cumulative_weights = SkewedCumulativeWeights1D();
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -981,32 +1061,87 @@ TEST(Parallelize1DTile1D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_tile_1d(
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_1d_weighted(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(counters.data()),
+			cumulative_weights.data(),
+			kParallelize1DRange,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
+}
+
+TEST(Parallelize1DWeighted, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+	const std::vector<size_t> cumulative_weights = SkewedCumulativeWeights1D();
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_1d_weighted(
 		threadpool.get(),
-		ComputeNothing1DTile1D,
-		nullptr,
-		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		reinterpret_cast<pthreadpool_task_1d_t>(WorkImbalance1D),
+		static_cast<void*>(&num_processed_items),
+		cumulative_weights.data(),
+		kParallelize1DRange,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
 }
 
-static void CheckBounds1DTile1D(void*, size_t start_i, size_t tile_i) {
-	EXPECT_LT(start_i, kParallelize1DTile1DRange);
-	EXPECT_LE(start_i + tile_i, kParallelize1DTile1DRange);
+static void StoreThreadId1D(std::thread::id* thread_ids, size_t i) {
+	thread_ids[i] = std::this_thread::get_id();
 }
 
-TEST(Parallelize1DTile1D, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+TEST(Parallelize1DWeighted, MultiThreadPoolStaticScheduleSplitByWeight) {
+	std::vector<std::thread::id> thread_ids(kParallelize1DRange);
+	const std::vector<size_t> cumulative_weights = SkewedCumulativeWeights1D();
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_1d_tile_1d(
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_1d_weighted(
 		threadpool.get(),
-		CheckBounds1DTile1D,
+		reinterpret_cast<pthreadpool_task_1d_t>(StoreThreadId1D),
+		static_cast<void*>(thread_ids.data()),
+		cumulative_weights.data(),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_STATIC_SCHEDULE);
+
+	/* The first thread gets at most half of the total weight, which is less than the weight of the first 7 items */
+	EXPECT_NE(thread_ids[0], thread_ids[7]);
+	EXPECT_EQ(thread_ids[0], std::this_thread::get_id());
+}
+
+static void ComputeNothing1DWithThread(void*, size_t, size_t) {
+}
+
+TEST(Parallelize1DWithThread, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_1d_with_thread(threadpool.get(),
+		ComputeNothing1DWithThread,
 		nullptr,
-		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		kParallelize1DRange,
 		0 /* flags */);
 }
 
-TEST(Parallelize1DTile1D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize1DWithThread, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1014,34 +1149,31 @@ TEST(Parallelize1DTile1D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_tile_1d(
+	pthreadpool_parallelize_1d_with_thread(
 		threadpool.get(),
-		CheckBounds1DTile1D,
+		ComputeNothing1DWithThread,
 		nullptr,
-		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		kParallelize1DRange,
 		0 /* flags */);
 }
 
-static void CheckTiling1DTile1D(void*, size_t start_i, size_t tile_i) {
-	EXPECT_GT(tile_i, 0);
-	EXPECT_LE(tile_i, kParallelize1DTile1DTile);
-	EXPECT_EQ(start_i % kParallelize1DTile1DTile, 0);
-	EXPECT_EQ(tile_i, std::min<size_t>(kParallelize1DTile1DTile, kParallelize1DTile1DRange - start_i));
+static void CheckBounds1DWithThread(void*, size_t, size_t i) {
+	EXPECT_LT(i, kParallelize1DRange);
 }
 
-TEST(Parallelize1DTile1D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize1DWithThread, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_1d_tile_1d(
+	pthreadpool_parallelize_1d_with_thread(
 		threadpool.get(),
-		CheckTiling1DTile1D,
+		CheckBounds1DWithThread,
 		nullptr,
-		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		kParallelize1DRange,
 		0 /* flags */);
 }
 
-TEST(Parallelize1DTile1D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize1DWithThread, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1049,41 +1181,39 @@ TEST(Parallelize1DTile1D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_tile_1d(
+	pthreadpool_parallelize_1d_with_thread(
 		threadpool.get(),
-		CheckTiling1DTile1D,
+		CheckBounds1DWithThread,
 		nullptr,
-		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		kParallelize1DRange,
 		0 /* flags */);
 }
 
-static void SetTrue1DTile1D(std::atomic_bool* processed_indicators, size_t start_i, size_t tile_i) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		processed_indicators[i].store(true, std::memory_order_relaxed);
-	}
+static void SetTrue1DWithThread(std::atomic_bool* processed_indicators, size_t, size_t i) {
+	processed_indicators[i].store(true, std::memory_order_relaxed);
 }
 
-TEST(Parallelize1DTile1D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize1DTile1DRange);
+TEST(Parallelize1DWithThread, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_1d_tile_1d(
+	pthreadpool_parallelize_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(SetTrue1DTile1D),
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(SetTrue1DWithThread),
 		static_cast<void*>(indicators.data()),
-		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		kParallelize1DRange,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
 		EXPECT_TRUE(indicators[i].load(std::memory_order_relaxed))
 			<< "Element " << i << " not processed";
 	}
 }
 
-TEST(Parallelize1DTile1D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize1DTile1DRange);
+TEST(Parallelize1DWithThread, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -1092,46 +1222,44 @@ TEST(Parallelize1DTile1D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_tile_1d(
+	pthreadpool_parallelize_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(SetTrue1DTile1D),
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(SetTrue1DWithThread),
 		static_cast<void*>(indicators.data()),
-		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		kParallelize1DRange,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
 		EXPECT_TRUE(indicators[i].load(std::memory_order_relaxed))
 			<< "Element " << i << " not processed";
 	}
 }
 
-static void Increment1DTile1D(std::atomic_int* processed_counters, size_t start_i, size_t tile_i) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		processed_counters[i].fetch_add(1, std::memory_order_relaxed);
-	}
+static void Increment1DWithThread(std::atomic_int* processed_counters, size_t, size_t i) {
+	processed_counters[i].fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize1DTile1D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize1DTile1DRange);
+TEST(Parallelize1DWithThread, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_1d_tile_1d(
+	pthreadpool_parallelize_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(Increment1DTile1D),
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(Increment1DWithThread),
 		static_cast<void*>(counters.data()),
-		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		kParallelize1DRange,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
 		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
 			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize1DTile1D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize1DTile1DRange);
+TEST(Parallelize1DWithThread, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -1140,43 +1268,43 @@ TEST(Parallelize1DTile1D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_tile_1d(
+	pthreadpool_parallelize_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(Increment1DTile1D),
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(Increment1DWithThread),
 		static_cast<void*>(counters.data()),
-		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		kParallelize1DRange,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
 		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
 			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize1DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize1DTile1DRange);
+TEST(Parallelize1DWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_1d_tile_1d(
+		pthreadpool_parallelize_1d_with_thread(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(Increment1DTile1D),
+			reinterpret_cast<pthreadpool_task_1d_with_thread_t>(Increment1DWithThread),
 			static_cast<void*>(counters.data()),
-			kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+			kParallelize1DRange,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
 		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
 			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
 			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-TEST(Parallelize1DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize1DTile1DRange);
+TEST(Parallelize1DWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -1186,28 +1314,26 @@ TEST(Parallelize1DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_1d_tile_1d(
+		pthreadpool_parallelize_1d_with_thread(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(Increment1DTile1D),
+			reinterpret_cast<pthreadpool_task_1d_with_thread_t>(Increment1DWithThread),
 			static_cast<void*>(counters.data()),
-			kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+			kParallelize1DRange,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
 		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
 			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
 			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-static void IncrementSame1DTile1D(std::atomic_int* num_processed_items, size_t start_i, size_t tile_i) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	}
+static void IncrementSame1DWithThread(std::atomic_int* num_processed_items, size_t, size_t i) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize1DTile1D, MultiThreadPoolHighContention) {
+TEST(Parallelize1DWithThread, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -1217,26 +1343,26 @@ TEST(Parallelize1DTile1D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_tile_1d(
+	pthreadpool_parallelize_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(IncrementSame1DTile1D),
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(IncrementSame1DWithThread),
 		static_cast<void*>(&num_processed_items),
-		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		kParallelize1DRange,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DTile1DRange);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
 }
 
-static void WorkImbalance1DTile1D(std::atomic_int* num_processed_items, size_t start_i, size_t tile_i) {
-	num_processed_items->fetch_add(tile_i, std::memory_order_relaxed);
-	if (start_i == 0) {
+static void WorkImbalance1DWithThread(std::atomic_int* num_processed_items, size_t, size_t i) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	if (i == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize1DTile1DRange) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize1DRange) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize1DTile1D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize1DWithThread, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -1246,63 +1372,44 @@ TEST(Parallelize1DTile1D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_1d_tile_1d(
+	pthreadpool_parallelize_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(WorkImbalance1DTile1D),
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(WorkImbalance1DWithThread),
 		static_cast<void*>(&num_processed_items),
-		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		kParallelize1DRange,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DTile1DRange);
-}
-
-static void ComputeNothing2D(void*, size_t, size_t) {
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
 }
 
-TEST(Parallelize2D, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_2d(threadpool.get(),
-		ComputeNothing2D,
-		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
-		0 /* flags */);
+static void CheckThreadIndexValid1DWithThread(const size_t* num_threads, size_t thread_index, size_t) {
+	EXPECT_LE(thread_index, *num_threads);
 }
 
-TEST(Parallelize2D, MultiThreadPoolCompletes) {
+TEST(Parallelize1DWithThread, MultiThreadPoolThreadIndexValid) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+	if (num_threads <= 1) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d(
+	pthreadpool_parallelize_1d_with_thread(
 		threadpool.get(),
-		ComputeNothing2D,
-		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(CheckThreadIndexValid1DWithThread),
+		static_cast<void*>(&num_threads),
+		kParallelize1DRange,
 		0 /* flags */);
 }
 
-static void CheckBounds2D(void*, size_t i, size_t j) {
-	EXPECT_LT(i, kParallelize2DRangeI);
-	EXPECT_LT(j, kParallelize2DRangeJ);
+static void StoreThreadIndex1DWithThread(std::atomic_size_t* thread_indices, size_t thread_index, size_t i) {
+	thread_indices[i].store(thread_index, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2D, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_2d(
-		threadpool.get(),
-		CheckBounds2D,
-		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
-		0 /* flags */);
-}
+TEST(Parallelize1DWithThread, MultiThreadPoolStaticScheduleSameThreadIndex) {
+	std::vector<std::atomic_size_t> first_thread_indices(kParallelize1DRange);
+	std::vector<std::atomic_size_t> second_thread_indices(kParallelize1DRange);
 
-TEST(Parallelize2D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1310,151 +1417,184 @@ TEST(Parallelize2D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d(
+	pthreadpool_parallelize_1d_with_thread(
 		threadpool.get(),
-		CheckBounds2D,
-		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
-		0 /* flags */);
-}
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(StoreThreadIndex1DWithThread),
+		static_cast<void*>(first_thread_indices.data()),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_STATIC_SCHEDULE);
+	pthreadpool_parallelize_1d_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(StoreThreadIndex1DWithThread),
+		static_cast<void*>(second_thread_indices.data()),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_STATIC_SCHEDULE);
 
-static void SetTrue2D(std::atomic_bool* processed_indicators, size_t i, size_t j) {
-	const size_t linear_idx = i * kParallelize2DRangeJ + j;
-	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(first_thread_indices[i].load(std::memory_order_relaxed), second_thread_indices[i].load(std::memory_order_relaxed))
+			<< "Element " << i << " was processed by threads " << first_thread_indices[i].load(std::memory_order_relaxed)
+			<< " and " << second_thread_indices[i].load(std::memory_order_relaxed);
+	}
 }
 
-TEST(Parallelize2D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
+TEST(Parallelize1DWithThread, MultiThreadPoolCpuAffinityStaticScheduleSameThreadIndex) {
+	std::vector<std::atomic_size_t> first_thread_indices(kParallelize1DRange);
+	std::vector<std::atomic_size_t> second_thread_indices(kParallelize1DRange);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d(
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_t>(SetTrue2D),
-		static_cast<void*>(indicators.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
-		0 /* flags */);
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(StoreThreadIndex1DWithThread),
+		static_cast<void*>(first_thread_indices.data()),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_STATIC_SCHEDULE | PTHREADPOOL_FLAG_CPU_AFFINITY);
+	pthreadpool_parallelize_1d_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(StoreThreadIndex1DWithThread),
+		static_cast<void*>(second_thread_indices.data()),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_STATIC_SCHEDULE | PTHREADPOOL_FLAG_CPU_AFFINITY);
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(first_thread_indices[i].load(std::memory_order_relaxed), second_thread_indices[i].load(std::memory_order_relaxed))
+			<< "Element " << i << " was processed by threads " << first_thread_indices[i].load(std::memory_order_relaxed)
+			<< " and " << second_thread_indices[i].load(std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize2D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
+static void StoreSystemThread1DWithThread(std::vector<std::atomic<std::thread::id>>* system_threads, size_t thread_index, size_t) {
+	std::thread::id expected;
+	const std::thread::id current = std::this_thread::get_id();
+	if (!(*system_threads)[thread_index].compare_exchange_strong(expected, current, std::memory_order_relaxed)) {
+		EXPECT_EQ(expected, current) << "Thread index " << thread_index << " is used by multiple system threads";
+	}
+}
 
+TEST(Parallelize1DWithThread, MultiThreadPoolCpuAffinityOneSystemThreadPerThreadIndex) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+	const size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+	if (num_threads <= 1) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_t>(SetTrue2D),
-		static_cast<void*>(indicators.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		std::vector<std::atomic<std::thread::id>> system_threads(num_threads);
+		pthreadpool_parallelize_1d_with_thread(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_with_thread_t>(StoreSystemThread1DWithThread),
+			static_cast<void*>(&system_threads),
+			kParallelize1DRange,
+			PTHREADPOOL_FLAG_CPU_AFFINITY);
 	}
 }
 
-static void Increment2D(std::atomic_int* processed_counters, size_t i, size_t j) {
-	const size_t linear_idx = i * kParallelize2DRangeJ + j;
-	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+struct NestedSystemThreadsContext {
+	pthreadpool_t threadpool;
+	std::vector<std::atomic<std::thread::id>>* system_threads;
+};
+
+static void StoreSystemThreadNested1DWithThread(NestedSystemThreadsContext* context, size_t thread_index, size_t i) {
+	StoreSystemThread1DWithThread(context->system_threads, thread_index, i);
 }
 
-TEST(Parallelize2D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+static void ParallelizeNested1DWithThread(NestedSystemThreadsContext* context, size_t thread_index, size_t i) {
+	StoreSystemThread1DWithThread(context->system_threads, thread_index, i);
+	pthreadpool_parallelize_1d_with_thread(
+		context->threadpool,
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(StoreSystemThreadNested1DWithThread),
+		static_cast<void*>(context),
+		kParallelize1DTile1DTile,
+		0 /* flags */);
+}
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+TEST(Parallelize1DWithThread, MultiThreadPoolNestedOneSystemThreadPerThreadIndex) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d(
+	const size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+	if (num_threads <= 1) {
+		GTEST_SKIP();
+	}
+
+	std::vector<std::atomic<std::thread::id>> system_threads(num_threads);
+	NestedSystemThreadsContext context = { threadpool.get(), &system_threads };
+	pthreadpool_parallelize_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
-		static_cast<void*>(counters.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(ParallelizeNested1DWithThread),
+		static_cast<void*>(&context),
+		kParallelize1DRange,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
-	}
 }
 
-TEST(Parallelize2D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+TEST(Parallelize1DWithThread, MultiThreadPoolStaticScheduleThreadCapacities) {
+	std::vector<std::atomic_size_t> thread_indices(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool.get());
+	if (threads_count <= 1) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d(
+	/* Odd threads are three times faster than even threads */
+	std::vector<uint32_t> capacities(threads_count);
+	uint32_t total_capacity = 0;
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		capacities[tid] = tid % 2 == 0 ? 1 : 3;
+		total_capacity += capacities[tid];
+	}
+	pthreadpool_set_thread_capacities(threadpool.get(), capacities.data());
+
+	pthreadpool_parallelize_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
-		static_cast<void*>(counters.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
-		0 /* flags */);
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(StoreThreadIndex1DWithThread),
+		static_cast<void*>(thread_indices.data()),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_STATIC_SCHEDULE);
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	std::vector<size_t> thread_items(threads_count);
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		const size_t thread_index = thread_indices[i].load(std::memory_order_relaxed);
+		ASSERT_LT(thread_index, threads_count);
+		if (i != 0) {
+			EXPECT_GE(thread_index, thread_indices[i - 1].load(std::memory_order_relaxed))
+				<< "Element " << i << " was processed by thread " << thread_index << " before its predecessor";
 		}
+		thread_items[thread_index] += 1;
+	}
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		const double expected_items = double(kParallelize1DRange) * double(capacities[tid]) / double(total_capacity);
+		EXPECT_NEAR(double(thread_items[tid]), expected_items, 1.0)
+			<< "Thread " << tid << " processed " << thread_items[tid] << " items (expected: " << expected_items << ")";
 	}
 }
 
-TEST(Parallelize2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+static void ComputeNothing1DWithUArch(void*, uint32_t, size_t) {
+}
 
+TEST(Parallelize1DWithUArch, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
-			static_cast<void*>(counters.data()),
-			kParallelize2DRangeI, kParallelize2DRangeJ,
-			0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
-		}
-	}
+	pthreadpool_parallelize_1d_with_uarch(threadpool.get(),
+		ComputeNothing1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex,
+		kMaxUArchIndex,
+		kParallelize1DRange,
+		0 /* flags */);
 }
 
-TEST(Parallelize2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
-
+TEST(Parallelize1DWithUArch, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1462,93 +1602,36 @@ TEST(Parallelize2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
-			static_cast<void*>(counters.data()),
-			kParallelize2DRangeI, kParallelize2DRangeJ,
-			0 /* flags */);
+	pthreadpool_parallelize_1d_with_uarch(
+		threadpool.get(),
+		ComputeNothing1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex,
+		kMaxUArchIndex,
+		kParallelize1DRange,
+		0 /* flags */);
+}
+
+static void CheckUArch1DWithUArch(void*, uint32_t uarch_index, size_t) {
+	if (uarch_index != kDefaultUArchIndex) {
+		EXPECT_LE(uarch_index, kMaxUArchIndex);
 	}
+}
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
-		}
-	}
-}
-
-static void IncrementSame2D(std::atomic_int* num_processed_items, size_t i, size_t j) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-}
-
-TEST(Parallelize2D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_2d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_t>(IncrementSame2D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
-}
-
-static void WorkImbalance2D(std::atomic_int* num_processed_items, size_t i, size_t j) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0 && j == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DRangeI * kParallelize2DRangeJ) {
-			std::atomic_thread_fence(std::memory_order_acquire);
-		}
-	}
-}
-
-TEST(Parallelize2D, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_2d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_t>(WorkImbalance2D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
-}
-
-static void ComputeNothing2DWithThread(void*, size_t, size_t, size_t) {
-}
-
-TEST(Parallelize2DWithThread, SingleThreadPoolCompletes) {
+TEST(Parallelize1DWithUArch, SingleThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_with_thread(threadpool.get(),
-		ComputeNothing2DWithThread,
+	pthreadpool_parallelize_1d_with_uarch(threadpool.get(),
+		CheckUArch1DWithUArch,
 		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kDefaultUArchIndex,
+		kMaxUArchIndex,
+		kParallelize1DRange,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DWithThread, MultiThreadPoolCompletes) {
+TEST(Parallelize1DWithUArch, MultiThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1556,32 +1639,35 @@ TEST(Parallelize2DWithThread, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_with_thread(
+	pthreadpool_parallelize_1d_with_uarch(
 		threadpool.get(),
-		ComputeNothing2DWithThread,
+		CheckUArch1DWithUArch,
 		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kDefaultUArchIndex,
+		kMaxUArchIndex,
+		kParallelize1DRange,
 		0 /* flags */);
 }
 
-static void CheckBounds2DWithThread(void*, size_t, size_t i, size_t j) {
-	EXPECT_LT(i, kParallelize2DRangeI);
-	EXPECT_LT(j, kParallelize2DRangeJ);
+static void CheckBounds1DWithUArch(void*, uint32_t, size_t i) {
+	EXPECT_LT(i, kParallelize1DRange);
 }
 
-TEST(Parallelize2DWithThread, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize1DWithUArch, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_with_thread(
+	pthreadpool_parallelize_1d_with_uarch(
 		threadpool.get(),
-		CheckBounds2DWithThread,
+		CheckBounds1DWithUArch,
 		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kDefaultUArchIndex,
+		kMaxUArchIndex,
+		kParallelize1DRange,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DWithThread, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize1DWithUArch, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1589,43 +1675,43 @@ TEST(Parallelize2DWithThread, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_with_thread(
+	pthreadpool_parallelize_1d_with_uarch(
 		threadpool.get(),
-		CheckBounds2DWithThread,
+		CheckBounds1DWithUArch,
 		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kDefaultUArchIndex,
+		kMaxUArchIndex,
+		kParallelize1DRange,
 		0 /* flags */);
 }
 
-static void SetTrue2DWithThread(std::atomic_bool* processed_indicators, size_t, size_t i, size_t j) {
-	const size_t linear_idx = i * kParallelize2DRangeJ + j;
-	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void SetTrue1DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i) {
+	processed_indicators[i].store(true, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DWithThread, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
+TEST(Parallelize1DWithUArch, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_with_thread(
+	pthreadpool_parallelize_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(SetTrue2DWithThread),
+		reinterpret_cast<pthreadpool_task_1d_with_id_t>(SetTrue1DWithUArch),
 		static_cast<void*>(indicators.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kDefaultUArchIndex,
+		kMaxUArchIndex,
+		kParallelize1DRange,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_TRUE(indicators[i].load(std::memory_order_relaxed))
+			<< "Element " << i << " not processed";
 	}
 }
 
-TEST(Parallelize2DWithThread, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
+TEST(Parallelize1DWithUArch, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -1634,52 +1720,48 @@ TEST(Parallelize2DWithThread, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_with_thread(
+	pthreadpool_parallelize_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(SetTrue2DWithThread),
+		reinterpret_cast<pthreadpool_task_1d_with_id_t>(SetTrue1DWithUArch),
 		static_cast<void*>(indicators.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kDefaultUArchIndex,
+		kMaxUArchIndex,
+		kParallelize1DRange,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_TRUE(indicators[i].load(std::memory_order_relaxed))
+			<< "Element " << i << " not processed";
 	}
 }
 
-static void Increment2DWithThread(std::atomic_int* processed_counters, size_t, size_t i, size_t j) {
-	const size_t linear_idx = i * kParallelize2DRangeJ + j;
-	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void Increment1DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i) {
+	processed_counters[i].fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DWithThread, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+TEST(Parallelize1DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_with_thread(
+	pthreadpool_parallelize_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
+		reinterpret_cast<pthreadpool_task_1d_with_id_t>(Increment1DWithUArch),
 		static_cast<void*>(counters.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kDefaultUArchIndex,
+		kMaxUArchIndex,
+		kParallelize1DRange,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize2DWithThread, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+TEST(Parallelize1DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -1688,51 +1770,47 @@ TEST(Parallelize2DWithThread, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_with_thread(
+	pthreadpool_parallelize_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
+		reinterpret_cast<pthreadpool_task_1d_with_id_t>(Increment1DWithUArch),
 		static_cast<void*>(counters.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kDefaultUArchIndex,
+		kMaxUArchIndex,
+		kParallelize1DRange,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize2DWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+TEST(Parallelize1DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_with_thread(
+		pthreadpool_parallelize_1d_with_uarch(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
+			reinterpret_cast<pthreadpool_task_1d_with_id_t>(Increment1DWithUArch),
 			static_cast<void*>(counters.data()),
-			kParallelize2DRangeI, kParallelize2DRangeJ,
+			kDefaultUArchIndex,
+			kMaxUArchIndex,
+			kParallelize1DRange,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
-		}
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-TEST(Parallelize2DWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+TEST(Parallelize1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -1742,30 +1820,28 @@ TEST(Parallelize2DWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_with_thread(
+		pthreadpool_parallelize_1d_with_uarch(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
+			reinterpret_cast<pthreadpool_task_1d_with_id_t>(Increment1DWithUArch),
 			static_cast<void*>(counters.data()),
-			kParallelize2DRangeI, kParallelize2DRangeJ,
+			kDefaultUArchIndex,
+			kMaxUArchIndex,
+			kParallelize1DRange,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
-		}
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-static void IncrementSame2DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j) {
+static void IncrementSame1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i) {
 	num_processed_items->fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DWithThread, MultiThreadPoolHighContention) {
+TEST(Parallelize1DWithUArch, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -1775,26 +1851,28 @@ TEST(Parallelize2DWithThread, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_with_thread(
+	pthreadpool_parallelize_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(IncrementSame2DWithThread),
+		reinterpret_cast<pthreadpool_task_1d_with_id_t>(IncrementSame1DWithUArch),
 		static_cast<void*>(&num_processed_items),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kDefaultUArchIndex,
+		kMaxUArchIndex,
+		kParallelize1DRange,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
 }
 
-static void WorkImbalance2DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j) {
+static void WorkImbalance1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i) {
 	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0 && j == 0) {
+	if (i == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DRangeI * kParallelize2DRangeJ) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize1DRange) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize2DWithThread, MultiThreadPoolWorkStealing) {
+TEST(Parallelize1DWithUArch, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -1804,51 +1882,32 @@ TEST(Parallelize2DWithThread, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_with_thread(
+	pthreadpool_parallelize_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(WorkImbalance2DWithThread),
+		reinterpret_cast<pthreadpool_task_1d_with_id_t>(WorkImbalance1DWithUArch),
 		static_cast<void*>(&num_processed_items),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
-}
-
-static void CheckThreadIndexValid2DWithThread(const size_t* num_threads, size_t thread_index, size_t, size_t) {
-	EXPECT_LE(thread_index, *num_threads);
-}
-
-TEST(Parallelize2DWithThread, MultiThreadPoolThreadIndexValid) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
-	if (num_threads <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_2d_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(CheckThreadIndexValid2DWithThread),
-		static_cast<void*>(&num_threads),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kDefaultUArchIndex,
+		kMaxUArchIndex,
+		kParallelize1DRange,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
 }
 
-static void ComputeNothing2DTile1D(void*, size_t, size_t, size_t) {
+static void ComputeNothing1DTile1D(void*, size_t, size_t) {
 }
 
-TEST(Parallelize2DTile1D, SingleThreadPoolCompletes) {
+TEST(Parallelize1DTile1D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d(threadpool.get(),
-		ComputeNothing2DTile1D,
+	pthreadpool_parallelize_1d_tile_1d(threadpool.get(),
+		ComputeNothing1DTile1D,
 		nullptr,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile1D, MultiThreadPoolCompletes) {
+TEST(Parallelize1DTile1D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1856,33 +1915,32 @@ TEST(Parallelize2DTile1D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d(
+	pthreadpool_parallelize_1d_tile_1d(
 		threadpool.get(),
-		ComputeNothing2DTile1D,
+		ComputeNothing1DTile1D,
 		nullptr,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 		0 /* flags */);
 }
 
-static void CheckBounds2DTile1D(void*, size_t i, size_t start_j, size_t tile_j) {
-	EXPECT_LT(i, kParallelize2DTile1DRangeI);
-	EXPECT_LT(start_j, kParallelize2DTile1DRangeJ);
-	EXPECT_LE(start_j + tile_j, kParallelize2DTile1DRangeJ);
+static void CheckBounds1DTile1D(void*, size_t start_i, size_t tile_i) {
+	EXPECT_LT(start_i, kParallelize1DTile1DRange);
+	EXPECT_LE(start_i + tile_i, kParallelize1DTile1DRange);
 }
 
-TEST(Parallelize2DTile1D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize1DTile1D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d(
+	pthreadpool_parallelize_1d_tile_1d(
 		threadpool.get(),
-		CheckBounds2DTile1D,
+		CheckBounds1DTile1D,
 		nullptr,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile1D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize1DTile1D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1890,34 +1948,34 @@ TEST(Parallelize2DTile1D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d(
+	pthreadpool_parallelize_1d_tile_1d(
 		threadpool.get(),
-		CheckBounds2DTile1D,
+		CheckBounds1DTile1D,
 		nullptr,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 		0 /* flags */);
 }
 
-static void CheckTiling2DTile1D(void*, size_t i, size_t start_j, size_t tile_j) {
-	EXPECT_GT(tile_j, 0);
-	EXPECT_LE(tile_j, kParallelize2DTile1DTileJ);
-	EXPECT_EQ(start_j % kParallelize2DTile1DTileJ, 0);
-	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile1DTileJ, kParallelize2DTile1DRangeJ - start_j));
+static void CheckTiling1DTile1D(void*, size_t start_i, size_t tile_i) {
+	EXPECT_GT(tile_i, 0);
+	EXPECT_LE(tile_i, kParallelize1DTile1DTile);
+	EXPECT_EQ(start_i % kParallelize1DTile1DTile, 0);
+	EXPECT_EQ(tile_i, std::min<size_t>(kParallelize1DTile1DTile, kParallelize1DTile1DRange - start_i));
 }
 
-TEST(Parallelize2DTile1D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize1DTile1D, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d(
+	pthreadpool_parallelize_1d_tile_1d(
 		threadpool.get(),
-		CheckTiling2DTile1D,
+		CheckTiling1DTile1D,
 		nullptr,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile1D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize1DTile1D, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1925,45 +1983,41 @@ TEST(Parallelize2DTile1D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d(
+	pthreadpool_parallelize_1d_tile_1d(
 		threadpool.get(),
-		CheckTiling2DTile1D,
+		CheckTiling1DTile1D,
 		nullptr,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 		0 /* flags */);
 }
 
-static void SetTrue2DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void SetTrue1DTile1D(std::atomic_bool* processed_indicators, size_t start_i, size_t tile_i) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		processed_indicators[i].store(true, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize2DTile1D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(Parallelize1DTile1D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize1DTile1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d(
+	pthreadpool_parallelize_1d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(SetTrue2DTile1D),
+		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(SetTrue1DTile1D),
 		static_cast<void*>(indicators.data()),
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+		EXPECT_TRUE(indicators[i].load(std::memory_order_relaxed))
+			<< "Element " << i << " not processed";
 	}
 }
 
-TEST(Parallelize2DTile1D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(Parallelize1DTile1D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize1DTile1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -1972,54 +2026,46 @@ TEST(Parallelize2DTile1D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d(
+	pthreadpool_parallelize_1d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(SetTrue2DTile1D),
+		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(SetTrue1DTile1D),
 		static_cast<void*>(indicators.data()),
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+		EXPECT_TRUE(indicators[i].load(std::memory_order_relaxed))
+			<< "Element " << i << " not processed";
 	}
 }
 
-static void Increment2DTile1D(std::atomic_int* processed_counters, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void Increment1DTile1D(std::atomic_int* processed_counters, size_t start_i, size_t tile_i) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		processed_counters[i].fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize2DTile1D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(Parallelize1DTile1D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DTile1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d(
+	pthreadpool_parallelize_1d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
+		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(Increment1DTile1D),
 		static_cast<void*>(counters.data()),
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
+	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize2DTile1D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(Parallelize1DTile1D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DTile1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -2028,51 +2074,43 @@ TEST(Parallelize2DTile1D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d(
+	pthreadpool_parallelize_1d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
+		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(Increment1DTile1D),
 		static_cast<void*>(counters.data()),
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
+	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize2DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(Parallelize1DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DTile1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_1d(
+		pthreadpool_parallelize_1d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
+			reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(Increment1DTile1D),
 			static_cast<void*>(counters.data()),
-			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+			kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
-		}
+	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-TEST(Parallelize2DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(Parallelize1DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DTile1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -2082,32 +2120,28 @@ TEST(Parallelize2DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_1d(
+		pthreadpool_parallelize_1d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
+			reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(Increment1DTile1D),
 			static_cast<void*>(counters.data()),
-			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+			kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
-		}
+	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-static void IncrementSame2DTile1D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
+static void IncrementSame1DTile1D(std::atomic_int* num_processed_items, size_t start_i, size_t tile_i) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
 		num_processed_items->fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize2DTile1D, MultiThreadPoolHighContention) {
+TEST(Parallelize1DTile1D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -2117,26 +2151,26 @@ TEST(Parallelize2DTile1D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d(
+	pthreadpool_parallelize_1d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(IncrementSame2DTile1D),
+		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(IncrementSame1DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DTile1DRange);
 }
 
-static void WorkImbalance2DTile1D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t tile_j) {
-	num_processed_items->fetch_add(tile_j, std::memory_order_relaxed);
-	if (i == 0 && start_j == 0) {
+static void WorkImbalance1DTile1D(std::atomic_int* num_processed_items, size_t start_i, size_t tile_i) {
+	num_processed_items->fetch_add(tile_i, std::memory_order_relaxed);
+	if (start_i == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize1DTile1DRange) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize2DTile1D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize1DTile1D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -2146,31 +2180,49 @@ TEST(Parallelize2DTile1D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d(
+	pthreadpool_parallelize_1d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(WorkImbalance2DTile1D),
+		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(WorkImbalance1DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DTile1DRange);
 }
 
-static void ComputeNothing2DTile1DWithUArch(void*, uint32_t, size_t, size_t, size_t) {
+static void Increment1DRange(std::atomic_int* processed_counters, size_t start, size_t end) {
+	EXPECT_LT(start, end);
+	EXPECT_LE(end, kParallelize1DRange);
+	EXPECT_EQ(start % kParallelize1DRangeAlignment, 0);
+	if (end != kParallelize1DRange) {
+		EXPECT_EQ(end % kParallelize1DRangeAlignment, 0);
+	}
+	for (size_t i = start; i < end; i++) {
+		processed_counters[i].fetch_add(1, std::memory_order_relaxed);
+	}
 }
 
-TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolCompletes) {
+TEST(Parallelize1DRange, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(threadpool.get(),
-		ComputeNothing2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+	pthreadpool_parallelize_1d_range(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_range_t>(Increment1DRange),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange, kParallelize1DRangeAlignment,
 		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolCompletes) {
+TEST(Parallelize1DRange, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2178,71 +2230,110 @@ TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+	pthreadpool_parallelize_1d_range(
 		threadpool.get(),
-		ComputeNothing2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_1d_range_t>(Increment1DRange),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange, kParallelize1DRangeAlignment,
 		0 /* flags */);
-}
 
-static void CheckUArch2DTile1DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t) {
-	if (uarch_index != kDefaultUArchIndex) {
-		EXPECT_LE(uarch_index, kMaxUArchIndex);
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolUArchInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+TEST(Parallelize1DRange, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		CheckUArch2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_1d_range(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_range_t>(Increment1DRange),
+			static_cast<void*>(counters.data()),
+			kParallelize1DRange, kParallelize1DRangeAlignment,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolUArchInBounds) {
+static void CountRuns1DRange(std::atomic_size_t* num_runs, size_t, size_t) {
+	num_runs->fetch_add(1, std::memory_order_relaxed);
+}
+
+TEST(Parallelize1DRange, MultiThreadPoolStaticScheduleOneRunPerThread) {
+	std::atomic_size_t num_runs = ATOMIC_VAR_INIT(0);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool.get());
+	if (threads_count <= 1) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+	pthreadpool_parallelize_1d_range(
 		threadpool.get(),
-		CheckUArch2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+		reinterpret_cast<pthreadpool_task_1d_range_t>(CountRuns1DRange),
+		static_cast<void*>(&num_runs),
+		kParallelize1DRange, kParallelize1DRangeAlignment,
+		PTHREADPOOL_FLAG_STATIC_SCHEDULE);
+	EXPECT_LE(num_runs.load(std::memory_order_relaxed), threads_count);
 }
 
-static void CheckBounds2DTile1DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t tile_j) {
-	EXPECT_LT(i, kParallelize2DTile1DRangeI);
-	EXPECT_LT(start_j, kParallelize2DTile1DRangeJ);
-	EXPECT_LE(start_j + tile_j, kParallelize2DTile1DRangeJ);
+/* Every third item in reverse order */
+template<class Index>
+static std::vector<Index> SparseIndices1D() {
+	std::vector<Index> indices;
+	for (size_t i = 0; i < kParallelize1DRange; i += 3) {
+		indices.push_back(static_cast<Index>(i));
+	}
+	std::reverse(indices.begin(), indices.end());
+	return indices;
 }
 
-TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolAllItemsInBounds) {
+static void ExpectListedItemsProcessedOnce(const std::vector<std::atomic_int>& counters) {
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		const int expected = i % 3 == 0 ? 1 : 0;
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), expected)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << expected << ")";
+	}
+}
+
+TEST(Parallelize1DIndexed, SingleThreadPoolEachListedItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	const std::vector<size_t> indices = SparseIndices1D<size_t>();
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+	pthreadpool_parallelize_1d_indexed(
 		threadpool.get(),
-		CheckBounds2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		indices.data(), indices.size(),
 		0 /* flags */);
+
+	ExpectListedItemsProcessedOnce(counters);
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize1DIndexed, MultiThreadPoolEachListedItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	const std::vector<size_t> indices = SparseIndices1D<size_t>();
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2250,36 +2341,49 @@ TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+	pthreadpool_parallelize_1d_indexed(
 		threadpool.get(),
-		CheckBounds2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		indices.data(), indices.size(),
 		0 /* flags */);
-}
 
-static void CheckTiling2DTile1DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t tile_j) {
-	EXPECT_GT(tile_j, 0);
-	EXPECT_LE(tile_j, kParallelize2DTile1DTileJ);
-	EXPECT_EQ(start_j % kParallelize2DTile1DTileJ, 0);
-	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile1DTileJ, kParallelize2DTile1DRangeJ - start_j));
+	ExpectListedItemsProcessedOnce(counters);
 }
 
-TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolUniformTiling) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+TEST(Parallelize1DIndexedU32, MultiThreadPoolEachListedItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	const std::vector<uint32_t> indices = SparseIndices1D<uint32_t>();
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_1d_indexed_u32(
 		threadpool.get(),
-		CheckTiling2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		indices.data(), indices.size(),
 		0 /* flags */);
+
+	ExpectListedItemsProcessedOnce(counters);
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolUniformTiling) {
+static void IncrementSlice1DIndexedTile1D(std::atomic_int* processed_counters, const uint32_t* indices, size_t count) {
+	EXPECT_NE(count, 0);
+	EXPECT_LE(count, kParallelize1DTile1DTile);
+	for (size_t p = 0; p < count; p++) {
+		processed_counters[indices[p]].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize1DIndexedU32Tile1D, MultiThreadPoolEachListedItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	const std::vector<uint32_t> indices = SparseIndices1D<uint32_t>();
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2287,47 +2391,60 @@ TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+	pthreadpool_parallelize_1d_indexed_u32_tile_1d(
 		threadpool.get(),
-		CheckTiling2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_1d_indexed_u32_tile_1d_t>(IncrementSlice1DIndexedTile1D),
+		static_cast<void*>(counters.data()),
+		indices.data(), indices.size(), kParallelize1DTile1DTile,
 		0 /* flags */);
+
+	ExpectListedItemsProcessedOnce(counters);
 }
 
-static void SetTrue2DTile1DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+/* Rows of very different lengths, including empty rows at the start, in the middle, and at the end */
+static std::vector<size_t> RaggedRowOffsets() {
+	std::vector<size_t> row_offsets(kParallelizeRagged2DRows + 1);
+	for (size_t i = 0; i < kParallelizeRagged2DRows; i++) {
+		const size_t row_length = i % 7 == 0 || i + 1 == kParallelizeRagged2DRows ? 0 : (i * i) % 97 + (i == 31 ? 500 : 0);
+		row_offsets[i + 1] = row_offsets[i] + row_length;
 	}
+	return row_offsets;
 }
 
-TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+struct RaggedCounters {
+	const size_t* row_offsets;
+	std::atomic_int* counters;
+};
+
+static void IncrementRagged2D(const RaggedCounters* context, size_t i, size_t k) {
+	context->counters[context->row_offsets[i] + k].fetch_add(1, std::memory_order_relaxed);
+}
+
+TEST(ParallelizeRagged2D, SingleThreadPoolEachItemProcessedOnce) {
+	const std::vector<size_t> row_offsets = RaggedRowOffsets();
+	std::vector<std::atomic_int> counters(row_offsets.back());
+	const RaggedCounters context = { row_offsets.data(), counters.data() };
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+	pthreadpool_parallelize_ragged_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(SetTrue2DTile1DWithUArch),
-		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_ragged_2d_t>(IncrementRagged2D),
+		const_cast<void*>(static_cast<const void*>(&context)),
+		row_offsets.data(), kParallelizeRagged2DRows,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+	for (size_t i = 0; i < counters.size(); i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(ParallelizeRagged2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	const std::vector<size_t> row_offsets = RaggedRowOffsets();
+	std::vector<std::atomic_int> counters(row_offsets.back());
+	const RaggedCounters context = { row_offsets.data(), counters.data() };
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -2336,111 +2453,79 @@ TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(SetTrue2DTile1DWithUArch),
-		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_ragged_2d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_ragged_2d_t>(IncrementRagged2D),
+			const_cast<void*>(static_cast<const void*>(&context)),
+			row_offsets.data(), kParallelizeRagged2DRows,
+			0 /* flags */);
+	}
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+	for (size_t i = 0; i < counters.size(); i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-static void Increment2DTile1DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void CheckBoundsRagged2DTile1D(const RaggedCounters* context, size_t i, size_t start_k, size_t count_k) {
+	EXPECT_LT(i, kParallelizeRagged2DRows);
+	EXPECT_NE(count_k, 0);
+	EXPECT_LE(count_k, kParallelizeRagged2DTile1DTile);
+	EXPECT_LE(start_k + count_k, context->row_offsets[i + 1] - context->row_offsets[i]);
+}
+
+TEST(ParallelizeRagged2DTile1D, MultiThreadPoolAllItemsInBounds) {
+	const std::vector<size_t> row_offsets = RaggedRowOffsets();
+	const RaggedCounters context = { row_offsets.data(), nullptr };
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
 	}
+
+	pthreadpool_parallelize_ragged_2d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_ragged_2d_tile_1d_t>(CheckBoundsRagged2DTile1D),
+		const_cast<void*>(static_cast<const void*>(&context)),
+		row_offsets.data(), kParallelizeRagged2DRows, kParallelizeRagged2DTile1DTile,
+		0 /* flags */);
 }
 
-TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+static void IncrementRagged2DTile1D(const RaggedCounters* context, size_t i, size_t start_k, size_t count_k) {
+	for (size_t k = start_k; k < start_k + count_k; k++) {
+		context->counters[context->row_offsets[i] + k].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(ParallelizeRagged2DTile1D, SingleThreadPoolEachItemProcessedOnce) {
+	const std::vector<size_t> row_offsets = RaggedRowOffsets();
+	std::vector<std::atomic_int> counters(row_offsets.back());
+	const RaggedCounters context = { row_offsets.data(), counters.data() };
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+	pthreadpool_parallelize_ragged_2d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
-		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_ragged_2d_tile_1d_t>(IncrementRagged2DTile1D),
+		const_cast<void*>(static_cast<const void*>(&context)),
+		row_offsets.data(), kParallelizeRagged2DRows, kParallelizeRagged2DTile1DTile,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
+	for (size_t i = 0; i < counters.size(); i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
-		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
-	}
-}
-
-TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_1d_with_uarch(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
-			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-			0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
-		}
-	}
-}
-
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(ParallelizeRagged2DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	const std::vector<size_t> row_offsets = RaggedRowOffsets();
+	std::vector<std::atomic_int> counters(row_offsets.back());
+	const RaggedCounters context = { row_offsets.data(), counters.data() };
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -2450,65 +2535,36 @@ TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_1d_with_uarch(
+		pthreadpool_parallelize_ragged_2d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
-			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+			reinterpret_cast<pthreadpool_task_ragged_2d_tile_1d_t>(IncrementRagged2DTile1D),
+			const_cast<void*>(static_cast<const void*>(&context)),
+			row_offsets.data(), kParallelizeRagged2DRows, kParallelizeRagged2DTile1DTile,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
-		}
+	for (size_t i = 0; i < counters.size(); i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-static void IncrementSame2DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	}
+static void ComputeNothing2D(void*, size_t, size_t) {
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+TEST(Parallelize2D, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(IncrementSame2DTile1DWithUArch),
-		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+	pthreadpool_parallelize_2d(threadpool.get(),
+		ComputeNothing2D,
+		nullptr,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-}
-
-static void WorkImbalance2DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t tile_j) {
-	num_processed_items->fetch_add(tile_j, std::memory_order_relaxed);
-	if (i == 0 && start_j == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ) {
-			std::atomic_thread_fence(std::memory_order_acquire);
-		}
-	}
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
-
+TEST(Parallelize2D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2516,32 +2572,32 @@ TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+	pthreadpool_parallelize_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(WorkImbalance2DTile1DWithUArch),
-		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		ComputeNothing2D,
+		nullptr,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 }
 
-static void ComputeNothing2DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t, size_t, size_t) {
+static void CheckBounds2D(void*, size_t i, size_t j) {
+	EXPECT_LT(i, kParallelize2DRangeI);
+	EXPECT_LT(j, kParallelize2DRangeJ);
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolCompletes) {
+TEST(Parallelize2D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(threadpool.get(),
-		ComputeNothing2DTile1DWithUArchWithThread,
+	pthreadpool_parallelize_2d(
+		threadpool.get(),
+		CheckBounds2D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolCompletes) {
+TEST(Parallelize2D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2549,35 +2605,44 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d(
 		threadpool.get(),
-		ComputeNothing2DTile1DWithUArchWithThread,
+		CheckBounds2D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 }
 
-static void CheckUArch2DTile1DWithUArchWithThread(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t) {
-	if (uarch_index != kDefaultUArchIndex) {
-		EXPECT_LE(uarch_index, kMaxUArchIndex);
-	}
+static void SetTrue2D(std::atomic_bool* processed_indicators, size_t i, size_t j) {
+	const size_t linear_idx = i * kParallelize2DRangeJ + j;
+	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolUArchInBounds) {
+TEST(Parallelize2D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d(
 		threadpool.get(),
-		CheckUArch2DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_2d_t>(SetTrue2D),
+		static_cast<void*>(indicators.data()),
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
+		}
+	}
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolUArchInBounds) {
+TEST(Parallelize2D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2585,35 +2650,53 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolUArchInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d(
 		threadpool.get(),
-		CheckUArch2DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_2d_t>(SetTrue2D),
+		static_cast<void*>(indicators.data()),
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
+		}
+	}
 }
 
-static void CheckBounds2DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
-	EXPECT_LT(i, kParallelize2DTile1DRangeI);
-	EXPECT_LT(start_j, kParallelize2DTile1DRangeJ);
-	EXPECT_LE(start_j + tile_j, kParallelize2DTile1DRangeJ);
+static void Increment2D(std::atomic_int* processed_counters, size_t i, size_t j) {
+	const size_t linear_idx = i * kParallelize2DRangeJ + j;
+	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize2D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d(
 		threadpool.get(),
-		CheckBounds2DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize2D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2621,187 +2704,41 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d(
 		threadpool.get(),
-		CheckBounds2DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
-}
 
-static void CheckTiling2DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
-	EXPECT_GT(tile_j, 0);
-	EXPECT_LE(tile_j, kParallelize2DTile1DTileJ);
-	EXPECT_EQ(start_j % kParallelize2DTile1DTileJ, 0);
-	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile1DTileJ, kParallelize2DTile1DRangeJ - start_j));
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolUniformTiling) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		CheckTiling2DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-}
-
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolUniformTiling) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		CheckTiling2DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-}
-
-static void SetTrue2DTile1DWithUArchWithThread(std::atomic_bool* processed_indicators, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-	}
-}
-
-TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(SetTrue2DTile1DWithUArchWithThread),
-		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
-	}
-}
-
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(SetTrue2DTile1DWithUArchWithThread),
-		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
-	}
-}
-
-static void Increment2DTile1DWithUArchWithThread(std::atomic_int* processed_counters, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-	}
-}
-
-TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
-		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
-	}
-}
-
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
-		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
-	}
-}
-
-TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-
+TEST(Parallelize2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		pthreadpool_parallelize_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
+			reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+			kParallelize2DRangeI, kParallelize2DRangeJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -2810,8 +2747,8 @@ TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedMu
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(Parallelize2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -2821,18 +2758,17 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedMul
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		pthreadpool_parallelize_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
+			reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+			kParallelize2DRangeI, kParallelize2DRangeJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -2841,13 +2777,11 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedMul
 	}
 }
 
-static void IncrementSame2DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	}
+static void IncrementSame2D(std::atomic_int* num_processed_items, size_t i, size_t j) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolHighContention) {
+TEST(Parallelize2D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -2857,27 +2791,26 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(IncrementSame2DTile1DWithUArchWithThread),
+		reinterpret_cast<pthreadpool_task_2d_t>(IncrementSame2D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
 }
 
-static void WorkImbalance2DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
-	num_processed_items->fetch_add(tile_j, std::memory_order_relaxed);
-	if (i == 0 && start_j == 0) {
+static void WorkImbalance2D(std::atomic_int* num_processed_items, size_t i, size_t j) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	if (i == 0 && j == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DRangeI * kParallelize2DRangeJ) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolWorkStealing) {
+TEST(Parallelize2D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -2887,51 +2820,97 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(WorkImbalance2DTile1DWithUArchWithThread),
+		reinterpret_cast<pthreadpool_task_2d_t>(WorkImbalance2D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
 }
 
-static void SetThreadTrue2DTile1DWithUArchWithThread(const size_t* num_threads, uint32_t, size_t thread_index, size_t i, size_t start_j, size_t tile_j) {
-	EXPECT_LE(thread_index, *num_threads);
+struct Nested2DContext {
+	pthreadpool_t threadpool;
+	std::atomic_int* processed_counters;
+	size_t i;
+	size_t j;
+	uint32_t flags;
+};
+
+static void IncrementNested1D(Nested2DContext* context, size_t k) {
+	const size_t linear_idx = (context->i * kParallelize3DRangeJ + context->j) * kParallelize3DRangeK + k;
+	context->processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolThreadIndexValid) {
+static void ParallelizeNested1D(Nested2DContext* outer_context, size_t i, size_t j) {
+	Nested2DContext context = *outer_context;
+	context.i = i;
+	context.j = j;
+	pthreadpool_parallelize_1d(
+		context.threadpool,
+		reinterpret_cast<pthreadpool_task_1d_t>(IncrementNested1D),
+		static_cast<void*>(&context),
+		kParallelize3DRangeK,
+		context.flags);
+}
+
+static void TestNested1D(uint32_t flags) {
+	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	Nested2DContext context = { threadpool.get(), counters.data(), 0, 0, flags };
+	pthreadpool_parallelize_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(SetThreadTrue2DTile1DWithUArchWithThread),
-		static_cast<void*>(&num_threads),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+		reinterpret_cast<pthreadpool_task_2d_t>(ParallelizeNested1D),
+		static_cast<void*>(&context),
+		kParallelize3DRangeI, kParallelize3DRangeJ,
+		flags);
+
+	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
+		}
+	}
 }
 
-static void ComputeNothing2DTile2D(void*, size_t, size_t, size_t, size_t) {
+TEST(Parallelize2D, MultiThreadPoolNested1DEachItemProcessedOnce) {
+	TestNested1D(0 /* flags */);
 }
 
-TEST(Parallelize2DTile2D, SingleThreadPoolCompletes) {
+TEST(Parallelize2D, MultiThreadPoolNested1DDynamicScheduleEachItemProcessedOnce) {
+	TestNested1D(PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE);
+}
+
+TEST(Parallelize2D, MultiThreadPoolNested1DStaticScheduleEachItemProcessedOnce) {
+	TestNested1D(PTHREADPOOL_FLAG_STATIC_SCHEDULE);
+}
+
+static void ComputeNothing2DWithThread(void*, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize2DWithThread, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d(threadpool.get(),
-		ComputeNothing2DTile2D,
+	pthreadpool_parallelize_2d_with_thread(threadpool.get(),
+		ComputeNothing2DWithThread,
 		nullptr,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile2D, MultiThreadPoolCompletes) {
+TEST(Parallelize2DWithThread, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2939,78 +2918,32 @@ TEST(Parallelize2DTile2D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d(
-		threadpool.get(),
-		ComputeNothing2DTile2D,
-		nullptr,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
-		0 /* flags */);
-}
-
-static void CheckBounds2DTile2D(void*, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	EXPECT_LT(start_i, kParallelize2DTile2DRangeI);
-	EXPECT_LT(start_j, kParallelize2DTile2DRangeJ);
-	EXPECT_LE(start_i + tile_i, kParallelize2DTile2DRangeI);
-	EXPECT_LE(start_j + tile_j, kParallelize2DTile2DRangeJ);
-}
-
-TEST(Parallelize2DTile2D, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_2d_tile_2d(
-		threadpool.get(),
-		CheckBounds2DTile2D,
-		nullptr,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
-		0 /* flags */);
-}
-
-TEST(Parallelize2DTile2D, MultiThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		CheckBounds2DTile2D,
+		ComputeNothing2DWithThread,
 		nullptr,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 }
 
-static void CheckTiling2DTile2D(void*, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	EXPECT_GT(tile_i, 0);
-	EXPECT_LE(tile_i, kParallelize2DTile2DTileI);
-	EXPECT_EQ(start_i % kParallelize2DTile2DTileI, 0);
-	EXPECT_EQ(tile_i, std::min<size_t>(kParallelize2DTile2DTileI, kParallelize2DTile2DRangeI - start_i));
-
-	EXPECT_GT(tile_j, 0);
-	EXPECT_LE(tile_j, kParallelize2DTile2DTileJ);
-	EXPECT_EQ(start_j % kParallelize2DTile2DTileJ, 0);
-	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile2DTileJ, kParallelize2DTile2DRangeJ - start_j));
+static void CheckBounds2DWithThread(void*, size_t, size_t i, size_t j) {
+	EXPECT_LT(i, kParallelize2DRangeI);
+	EXPECT_LT(j, kParallelize2DRangeJ);
 }
 
-TEST(Parallelize2DTile2D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize2DWithThread, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		CheckTiling2DTile2D,
+		CheckBounds2DWithThread,
 		nullptr,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile2D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize2DWithThread, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3018,49 +2951,43 @@ TEST(Parallelize2DTile2D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		CheckTiling2DTile2D,
+		CheckBounds2DWithThread,
 		nullptr,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 }
 
-static void SetTrue2DTile2D(std::atomic_bool* processed_indicators, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		for (size_t j = start_j; j < start_j + tile_j; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
-	}
+static void SetTrue2DWithThread(std::atomic_bool* processed_indicators, size_t, size_t i, size_t j) {
+	const size_t linear_idx = i * kParallelize2DRangeJ + j;
+	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DTile2D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DWithThread, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(SetTrue2DTile2D),
+		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(SetTrue2DWithThread),
 		static_cast<void*>(indicators.data()),
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 				<< "Element (" << i << ", " << j << ") not processed";
 		}
 	}
 }
 
-TEST(Parallelize2DTile2D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DWithThread, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3069,49 +2996,43 @@ TEST(Parallelize2DTile2D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(SetTrue2DTile2D),
+		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(SetTrue2DWithThread),
 		static_cast<void*>(indicators.data()),
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 				<< "Element (" << i << ", " << j << ") not processed";
 		}
 	}
 }
 
-static void Increment2DTile2D(std::atomic_int* processed_counters, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		for (size_t j = start_j; j < start_j + tile_j; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-		}
-	}
+static void Increment2DWithThread(std::atomic_int* processed_counters, size_t, size_t i, size_t j) {
+	const size_t linear_idx = i * kParallelize2DRangeJ + j;
+	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DTile2D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DWithThread, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
 		static_cast<void*>(counters.data()),
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -3119,8 +3040,8 @@ TEST(Parallelize2DTile2D, SingleThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DWithThread, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3129,17 +3050,16 @@ TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
 		static_cast<void*>(counters.data()),
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -3147,25 +3067,24 @@ TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize2DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_2d(
+		pthreadpool_parallelize_2d_with_thread(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+			reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
 			static_cast<void*>(counters.data()),
-			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			kParallelize2DRangeI, kParallelize2DRangeJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -3174,8 +3093,8 @@ TEST(Parallelize2DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3185,18 +3104,17 @@ TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_2d(
+		pthreadpool_parallelize_2d_with_thread(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+			reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
 			static_cast<void*>(counters.data()),
-			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			kParallelize2DRangeI, kParallelize2DRangeJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -3205,15 +3123,11 @@ TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-static void IncrementSame2DTile2D(std::atomic_int* num_processed_items, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		for (size_t j = start_j; j < start_j + tile_j; j++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
-		}
-	}
+static void IncrementSame2DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DTile2D, MultiThreadPoolHighContention) {
+TEST(Parallelize2DWithThread, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -3223,27 +3137,26 @@ TEST(Parallelize2DTile2D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(IncrementSame2DTile2D),
+		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(IncrementSame2DWithThread),
 		static_cast<void*>(&num_processed_items),
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
 }
 
-static void WorkImbalance2DTile2D(std::atomic_int* num_processed_items, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	num_processed_items->fetch_add(tile_i * tile_j, std::memory_order_relaxed);
-	if (start_i == 0 && start_j == 0) {
+static void WorkImbalance2DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	if (i == 0 && j == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DRangeI * kParallelize2DRangeJ) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize2DTile2D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize2DWithThread, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -3253,71 +3166,51 @@ TEST(Parallelize2DTile2D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(WorkImbalance2DTile2D),
+		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(WorkImbalance2DWithThread),
 		static_cast<void*>(&num_processed_items),
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
-}
-
-static void ComputeNothing2DTile2DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t) {
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
 }
 
-TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(threadpool.get(),
-		ComputeNothing2DTile2DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
-		0 /* flags */);
+static void CheckThreadIndexValid2DWithThread(const size_t* num_threads, size_t thread_index, size_t, size_t) {
+	EXPECT_LE(thread_index, *num_threads);
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolCompletes) {
+TEST(Parallelize2DWithThread, MultiThreadPoolThreadIndexValid) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+	if (num_threads <= 1) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		ComputeNothing2DTile2DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(CheckThreadIndexValid2DWithThread),
+		static_cast<void*>(&num_threads),
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 }
 
-static void CheckUArch2DTile2DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t) {
-	if (uarch_index != kDefaultUArchIndex) {
-		EXPECT_LE(uarch_index, kMaxUArchIndex);
-	}
+static void ComputeNothing2DTile1D(void*, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolUArchInBounds) {
+TEST(Parallelize2DTile1D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
-		threadpool.get(),
-		CheckUArch2DTile2DWithUArch,
+	pthreadpool_parallelize_2d_tile_1d(threadpool.get(),
+		ComputeNothing2DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
+TEST(Parallelize2DTile1D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3325,38 +3218,33 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		CheckUArch2DTile2DWithUArch,
+		ComputeNothing2DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-static void CheckBounds2DTile2DWithUArch(void*, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	EXPECT_LT(start_i, kParallelize2DTile2DRangeI);
-	EXPECT_LT(start_j, kParallelize2DTile2DRangeJ);
-	EXPECT_LE(start_i + tile_i, kParallelize2DTile2DRangeI);
-	EXPECT_LE(start_j + tile_j, kParallelize2DTile2DRangeJ);
+static void CheckBounds2DTile1D(void*, size_t i, size_t start_j, size_t tile_j) {
+	EXPECT_LT(i, kParallelize2DTile1DRangeI);
+	EXPECT_LT(start_j, kParallelize2DTile1DRangeJ);
+	EXPECT_LE(start_j + tile_j, kParallelize2DTile1DRangeJ);
 }
 
-TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize2DTile1D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		CheckBounds2DTile2DWithUArch,
+		CheckBounds2DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize2DTile1D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3364,43 +3252,34 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		CheckBounds2DTile2DWithUArch,
+		CheckBounds2DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-static void CheckTiling2DTile2DWithUArch(void*, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	EXPECT_GT(tile_i, 0);
-	EXPECT_LE(tile_i, kParallelize2DTile2DTileI);
-	EXPECT_EQ(start_i % kParallelize2DTile2DTileI, 0);
-	EXPECT_EQ(tile_i, std::min<size_t>(kParallelize2DTile2DTileI, kParallelize2DTile2DRangeI - start_i));
-
+static void CheckTiling2DTile1D(void*, size_t i, size_t start_j, size_t tile_j) {
 	EXPECT_GT(tile_j, 0);
-	EXPECT_LE(tile_j, kParallelize2DTile2DTileJ);
-	EXPECT_EQ(start_j % kParallelize2DTile2DTileJ, 0);
-	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile2DTileJ, kParallelize2DTile2DRangeJ - start_j));
+	EXPECT_LE(tile_j, kParallelize2DTile1DTileJ);
+	EXPECT_EQ(start_j % kParallelize2DTile1DTileJ, 0);
+	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile1DTileJ, kParallelize2DTile1DRangeJ - start_j));
 }
 
-TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolUniformTiling) {
+TEST(Parallelize2DTile1D, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		CheckTiling2DTile2DWithUArch,
+		CheckTiling2DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolUniformTiling) {
+TEST(Parallelize2DTile1D, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3408,51 +3287,45 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		CheckTiling2DTile2DWithUArch,
+		CheckTiling2DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-static void SetTrue2DTile2DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		for (size_t j = start_j; j < start_j + tile_j; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
+static void SetTrue2DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DTile1D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(SetTrue2DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(SetTrue2DTile1D),
 		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
 			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 				<< "Element (" << i << ", " << j << ") not processed";
 		}
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DTile1D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3461,51 +3334,45 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(SetTrue2DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(SetTrue2DTile1D),
 		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
 			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 				<< "Element (" << i << ", " << j << ") not processed";
 		}
 	}
 }
 
-static void Increment2DTile2DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		for (size_t j = start_j; j < start_j + tile_j; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-		}
+static void Increment2DTile1D(std::atomic_int* processed_counters, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DTile1D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -3513,8 +3380,8 @@ TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DTile1D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3523,18 +3390,16 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -3542,26 +3407,24 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		pthreadpool_parallelize_2d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+			reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -3570,8 +3433,8 @@ TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTime
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3581,19 +3444,17 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		pthreadpool_parallelize_2d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+			reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -3602,15 +3463,13 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes
 	}
 }
 
-static void IncrementSame2DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		for (size_t j = start_j; j < start_j + tile_j; j++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
-		}
+static void IncrementSame2DTile1D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolHighContention) {
+TEST(Parallelize2DTile1D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -3620,28 +3479,26 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(IncrementSame2DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(IncrementSame2DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 }
 
-static void WorkImbalance2DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	num_processed_items->fetch_add(tile_i * tile_j, std::memory_order_relaxed);
-	if (start_i == 0 && start_j == 0) {
+static void WorkImbalance2DTile1D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t tile_j) {
+	num_processed_items->fetch_add(tile_j, std::memory_order_relaxed);
+	if (i == 0 && start_j == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolWorkStealing) {
+TEST(Parallelize2DTile1D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -3651,32 +3508,54 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(WorkImbalance2DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(WorkImbalance2DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 }
 
-static void ComputeNothing3D(void*, size_t, size_t, size_t) {
+static void Increment2DRange(std::atomic_int* processed_counters, size_t i, size_t start_j, size_t end_j) {
+	EXPECT_LT(i, kParallelize2DRangeI);
+	EXPECT_LT(start_j, end_j);
+	EXPECT_LE(end_j, kParallelize2DRangeJ);
+	EXPECT_EQ(start_j % kParallelize2DRangeAlignmentJ, 0);
+	if (end_j != kParallelize2DRangeJ) {
+		EXPECT_EQ(end_j % kParallelize2DRangeAlignmentJ, 0);
+	}
+	for (size_t j = start_j; j < end_j; j++) {
+		processed_counters[i * kParallelize2DRangeJ + j].fetch_add(1, std::memory_order_relaxed);
+	}
 }
 
-TEST(Parallelize3D, SingleThreadPoolCompletes) {
+TEST(Parallelize2DRange, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d(threadpool.get(),
-		ComputeNothing3D,
-		nullptr,
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+	pthreadpool_parallelize_2d_range(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_range_t>(Increment2DRange),
+		static_cast<void*>(counters.data()),
+		kParallelize2DRangeI, kParallelize2DRangeJ, kParallelize2DRangeAlignmentJ,
 		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
 }
 
-TEST(Parallelize3D, MultiThreadPoolCompletes) {
+TEST(Parallelize2DRange, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3684,33 +3563,66 @@ TEST(Parallelize3D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_range(
 		threadpool.get(),
-		ComputeNothing3D,
-		nullptr,
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		reinterpret_cast<pthreadpool_task_2d_range_t>(Increment2DRange),
+		static_cast<void*>(counters.data()),
+		kParallelize2DRangeI, kParallelize2DRangeJ, kParallelize2DRangeAlignmentJ,
 		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
 }
 
-static void CheckBounds3D(void*, size_t i, size_t j, size_t k) {
-	EXPECT_LT(i, kParallelize3DRangeI);
-	EXPECT_LT(j, kParallelize3DRangeJ);
-	EXPECT_LT(k, kParallelize3DRangeK);
+TEST(Parallelize2DRange, MultiThreadPoolGuidedScheduleEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_range(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_range_t>(Increment2DRange),
+		static_cast<void*>(counters.data()),
+		kParallelize2DRangeI, kParallelize2DRangeJ, kParallelize2DRangeAlignmentJ,
+		PTHREADPOOL_FLAG_GUIDED_SCHEDULE);
+
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
 }
 
-TEST(Parallelize3D, SingleThreadPoolAllItemsInBounds) {
+static void ComputeNothing2DTile1DWithUArch(void*, uint32_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d(
-		threadpool.get(),
-		CheckBounds3D,
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(threadpool.get(),
+		ComputeNothing2DTile1DWithUArch,
 		nullptr,
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize3D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3718,46 +3630,35 @@ TEST(Parallelize3D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		CheckBounds3D,
+		ComputeNothing2DTile1DWithUArch,
 		nullptr,
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-static void SetTrue3D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k) {
-	const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void CheckUArch2DTile1DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t) {
+	if (uarch_index != kDefaultUArchIndex) {
+		EXPECT_LE(uarch_index, kMaxUArchIndex);
+	}
 }
 
-TEST(Parallelize3D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
-
+TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_t>(SetTrue3D),
-		static_cast<void*>(indicators.data()),
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		CheckUArch2DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
-			}
-		}
-	}
 }
 
-TEST(Parallelize3D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
-
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3765,57 +3666,35 @@ TEST(Parallelize3D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_t>(SetTrue3D),
-		static_cast<void*>(indicators.data()),
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		CheckUArch2DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
-			}
-		}
-	}
 }
 
-static void Increment3D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k) {
-	const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void CheckBounds2DTile1DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t tile_j) {
+	EXPECT_LT(i, kParallelize2DTile1DRangeI);
+	EXPECT_LT(start_j, kParallelize2DTile1DRangeJ);
+	EXPECT_LE(start_j + tile_j, kParallelize2DTile1DRangeJ);
 }
 
-TEST(Parallelize3D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
-
+TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
-		static_cast<void*>(counters.data()),
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		CheckBounds2DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-			}
-		}
-	}
 }
 
-TEST(Parallelize3D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
-
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3823,56 +3702,36 @@ TEST(Parallelize3D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
-		static_cast<void*>(counters.data()),
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		CheckBounds2DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-			}
-		}
-	}
 }
 
-TEST(Parallelize3D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
+static void CheckTiling2DTile1DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t tile_j) {
+	EXPECT_GT(tile_j, 0);
+	EXPECT_LE(tile_j, kParallelize2DTile1DTileJ);
+	EXPECT_EQ(start_j % kParallelize2DTile1DTileJ, 0);
+	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile1DTileJ, kParallelize2DTile1DRangeJ - start_j));
+}
 
+TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
-			static_cast<void*>(counters.data()),
-			kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
-				0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
-		}
-	}
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+		threadpool.get(),
+		CheckTiling2DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
 }
 
-TEST(Parallelize3D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
-
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3880,34 +3739,47 @@ TEST(Parallelize3D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
-			static_cast<void*>(counters.data()),
-			kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
-				0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
-		}
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+		threadpool.get(),
+		CheckTiling2DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+}
+
+static void SetTrue2DTile1DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 	}
 }
 
-static void IncrementSame3D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(SetTrue2DTile1DWithUArch),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
+		}
+	}
 }
 
-TEST(Parallelize3D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3916,27 +3788,56 @@ TEST(Parallelize3D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_t>(IncrementSame3D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(SetTrue2DTile1DWithUArch),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
+		}
+	}
 }
 
-static void WorkImbalance3D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK) {
-			std::atomic_thread_fence(std::memory_order_acquire);
+static void Increment2DTile1DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 		}
 	}
 }
 
-TEST(Parallelize3D, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3945,31 +3846,54 @@ TEST(Parallelize3D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_t>(WorkImbalance3D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
-}
 
-static void ComputeNothing3DTile1D(void*, size_t, size_t, size_t, size_t) {
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
 }
 
-TEST(Parallelize3DTile1D, SingleThreadPoolCompletes) {
+TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d(threadpool.get(),
-		ComputeNothing3DTile1D,
-		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_2d_tile_1d_with_uarch(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
+		}
+	}
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolCompletes) {
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3977,36 +3901,66 @@ TEST(Parallelize3DTile1D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d(
-		threadpool.get(),
-		ComputeNothing3DTile1D,
-		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_2d_tile_1d_with_uarch(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
+		}
+	}
 }
 
-static void CheckBounds3DTile1D(void*, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_LT(i, kParallelize3DTile1DRangeI);
-	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
-	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
-	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
+static void IncrementSame2DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	}
 }
 
-TEST(Parallelize3DTile1D, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d(
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		CheckBounds3DTile1D,
-		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(IncrementSame2DTile1DWithUArch),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolAllItemsInBounds) {
+static void WorkImbalance2DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t tile_j) {
+	num_processed_items->fetch_add(tile_j, std::memory_order_relaxed);
+	if (i == 0 && start_j == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4014,36 +3968,32 @@ TEST(Parallelize3DTile1D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		CheckBounds3DTile1D,
-		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(WorkImbalance2DTile1DWithUArch),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 }
 
-static void CheckTiling3DTile1D(void*, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
-	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
+static void ComputeNothing2DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize3DTile1D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d(
-		threadpool.get(),
-		CheckTiling3DTile1D,
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(threadpool.get(),
+		ComputeNothing2DTile1DWithUArchWithThread,
 		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4051,50 +4001,35 @@ TEST(Parallelize3DTile1D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		CheckTiling3DTile1D,
+		ComputeNothing2DTile1DWithUArchWithThread,
 		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-static void SetTrue3DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void CheckUArch2DTile1DWithUArchWithThread(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t) {
+	if (uarch_index != kDefaultUArchIndex) {
+		EXPECT_LE(uarch_index, kMaxUArchIndex);
 	}
 }
 
-TEST(Parallelize3DTile1D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
+TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(SetTrue3DTile1D),
-		static_cast<void*>(indicators.data()),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		CheckUArch2DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
-			}
-		}
-	}
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4102,61 +4037,35 @@ TEST(Parallelize3DTile1D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(SetTrue3DTile1D),
-		static_cast<void*>(indicators.data()),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		CheckUArch2DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
-			}
-		}
-	}
 }
 
-static void Increment3DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-	}
+static void CheckBounds2DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
+	EXPECT_LT(i, kParallelize2DTile1DRangeI);
+	EXPECT_LT(start_j, kParallelize2DTile1DRangeJ);
+	EXPECT_LE(start_j + tile_j, kParallelize2DTile1DRangeJ);
 }
 
-TEST(Parallelize3DTile1D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
+TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
-		static_cast<void*>(counters.data()),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		CheckBounds2DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-			}
-		}
-	}
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4164,58 +4073,36 @@ TEST(Parallelize3DTile1D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
-		static_cast<void*>(counters.data()),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		CheckBounds2DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-			}
-		}
-	}
 }
 
-TEST(Parallelize3DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+static void CheckTiling2DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
+	EXPECT_GT(tile_j, 0);
+	EXPECT_LE(tile_j, kParallelize2DTile1DTileJ);
+	EXPECT_EQ(start_j % kParallelize2DTile1DTileJ, 0);
+	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile1DTileJ, kParallelize2DTile1DRangeJ - start_j));
+}
 
+TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
-			static_cast<void*>(counters.data()),
-			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-			kParallelize3DTile1DTileK,
-			0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
-		}
-	}
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		CheckTiling2DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4223,67 +4110,47 @@ TEST(Parallelize3DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
-			static_cast<void*>(counters.data()),
-			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-			kParallelize3DTile1DTileK,
-			0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
-		}
-	}
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		CheckTiling2DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
 }
 
-static void IncrementSame3DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+static void SetTrue2DTile1DWithUArchWithThread(std::atomic_bool* processed_indicators, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(IncrementSame3DTile1D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(SetTrue2DTile1DWithUArchWithThread),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-}
 
-static void WorkImbalance3DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && start_k == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK) {
-			std::atomic_thread_fence(std::memory_order_acquire);
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
 		}
 	}
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -4292,23 +4159,1956 @@ TEST(Parallelize3DTile1D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(WorkImbalance3DTile1D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(SetTrue2DTile1DWithUArchWithThread),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-}
 
-static void ComputeNothing3DTile1DWithThread(void*, size_t, size_t, size_t, size_t, size_t) {
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
+		}
+	}
 }
 
-TEST(Parallelize3DTile1DWithThread, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
+static void Increment2DTile1DWithUArchWithThread(std::atomic_int* processed_counters, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
+}
+
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
+}
+
+TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
+		}
+	}
+}
+
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
+		}
+	}
+}
+
+static void IncrementSame2DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(IncrementSame2DTile1DWithUArchWithThread),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+}
+
+static void WorkImbalance2DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
+	num_processed_items->fetch_add(tile_j, std::memory_order_relaxed);
+	if (i == 0 && start_j == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(WorkImbalance2DTile1DWithUArchWithThread),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+}
+
+static void SetThreadTrue2DTile1DWithUArchWithThread(const size_t* num_threads, uint32_t, size_t thread_index, size_t i, size_t start_j, size_t tile_j) {
+	EXPECT_LE(thread_index, *num_threads);
+}
+
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolThreadIndexValid) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(SetThreadTrue2DTile1DWithUArchWithThread),
+		static_cast<void*>(&num_threads),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+}
+
+static void ComputeNothing2DTile2D(void*, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize2DTile2D, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d(threadpool.get(),
+		ComputeNothing2DTile2D,
+		nullptr,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
+
+TEST(Parallelize2DTile2D, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		ComputeNothing2DTile2D,
+		nullptr,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
+
+static void CheckBounds2DTile2D(void*, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	EXPECT_LT(start_i, kParallelize2DTile2DRangeI);
+	EXPECT_LT(start_j, kParallelize2DTile2DRangeJ);
+	EXPECT_LE(start_i + tile_i, kParallelize2DTile2DRangeI);
+	EXPECT_LE(start_j + tile_j, kParallelize2DTile2DRangeJ);
+}
+
+TEST(Parallelize2DTile2D, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		CheckBounds2DTile2D,
+		nullptr,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
+
+TEST(Parallelize2DTile2D, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		CheckBounds2DTile2D,
+		nullptr,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
+
+static void CheckTiling2DTile2D(void*, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	EXPECT_GT(tile_i, 0);
+	EXPECT_LE(tile_i, kParallelize2DTile2DTileI);
+	EXPECT_EQ(start_i % kParallelize2DTile2DTileI, 0);
+	EXPECT_EQ(tile_i, std::min<size_t>(kParallelize2DTile2DTileI, kParallelize2DTile2DRangeI - start_i));
+
+	EXPECT_GT(tile_j, 0);
+	EXPECT_LE(tile_j, kParallelize2DTile2DTileJ);
+	EXPECT_EQ(start_j % kParallelize2DTile2DTileJ, 0);
+	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile2DTileJ, kParallelize2DTile2DRangeJ - start_j));
+}
+
+TEST(Parallelize2DTile2D, SingleThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		CheckTiling2DTile2D,
+		nullptr,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
+
+TEST(Parallelize2DTile2D, MultiThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		CheckTiling2DTile2D,
+		nullptr,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
+
+static void SetTrue2DTile2D(std::atomic_bool* processed_indicators, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		for (size_t j = start_j; j < start_j + tile_j; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize2DTile2D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(SetTrue2DTile2D),
+		static_cast<void*>(indicators.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
+		}
+	}
+}
+
+TEST(Parallelize2DTile2D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(SetTrue2DTile2D),
+		static_cast<void*>(indicators.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
+		}
+	}
+}
+
+static void Increment2DTile2D(std::atomic_int* processed_counters, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		for (size_t j = start_j; j < start_j + tile_j; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize2DTile2D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
+}
+
+TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
+}
+
+TEST(Parallelize2DTile2D, MultiThreadPoolAsyncEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_job_t job = pthreadpool_parallelize_2d_tile_2d_async(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+	pthreadpool_wait(job);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
+}
+
+TEST(Parallelize2DTile2D, MultiThreadPoolBatchClaimsEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		PTHREADPOOL_FLAG_BATCH_CLAIMS);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
+}
+
+TEST(Parallelize2DTile2D, MultiThreadPoolDynamicScheduleEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		PTHREADPOOL_FLAG_DYNAMIC_SCHEDULE);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
+}
+
+TEST(Parallelize2DTile2D, MultiThreadPoolGuidedScheduleEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		PTHREADPOOL_FLAG_GUIDED_SCHEDULE);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
+}
+
+TEST(Parallelize2DTile2D, MultiThreadPoolMortonOrderEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		PTHREADPOOL_FLAG_MORTON_ORDER);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
+}
+
+TEST(Parallelize2DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_2d_tile_2d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+			static_cast<void*>(counters.data()),
+			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
+		}
+	}
+}
+
+TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_2d_tile_2d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+			static_cast<void*>(counters.data()),
+			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
+		}
+	}
+}
+
+static void IncrementSame2DTile2D(std::atomic_int* num_processed_items, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		for (size_t j = start_j; j < start_j + tile_j; j++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize2DTile2D, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(IncrementSame2DTile2D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+}
+
+static void WorkImbalance2DTile2D(std::atomic_int* num_processed_items, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	num_processed_items->fetch_add(tile_i * tile_j, std::memory_order_relaxed);
+	if (start_i == 0 && start_j == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize2DTile2D, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(WorkImbalance2DTile2D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+}
+
+TEST(Parallelize2DTile2D, MultiThreadPoolMortonOrderWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(WorkImbalance2DTile2D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		PTHREADPOOL_FLAG_MORTON_ORDER);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+}
+
+static void Increment2DTriangular(std::atomic_int* processed_counters, size_t i, size_t j) {
+	EXPECT_LE(i, j);
+	EXPECT_LT(j, kParallelize2DRangeJ);
+	processed_counters[i * kParallelize2DRangeJ + j].fetch_add(1, std::memory_order_relaxed);
+}
+
+static void ExpectUpperTriangleProcessedOnce(const std::vector<std::atomic_int>& counters, size_t range, size_t tile) {
+	for (size_t i = 0; i < range; i++) {
+		for (size_t j = 0; j < range; j++) {
+			const int expected = i / tile <= j / tile ? 1 : 0;
+			const size_t linear_idx = i * range + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), expected)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: " << expected << ")";
+		}
+	}
+}
+
+TEST(Parallelize2DTriangular, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeJ * kParallelize2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_triangular(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_t>(Increment2DTriangular),
+		static_cast<void*>(counters.data()),
+		kParallelize2DRangeJ,
+		0 /* flags */);
+
+	ExpectUpperTriangleProcessedOnce(counters, kParallelize2DRangeJ, 1);
+}
+
+TEST(Parallelize2DTriangular, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeJ * kParallelize2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_triangular(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_t>(Increment2DTriangular),
+		static_cast<void*>(counters.data()),
+		kParallelize2DRangeJ,
+		0 /* flags */);
+
+	ExpectUpperTriangleProcessedOnce(counters, kParallelize2DRangeJ, 1);
+}
+
+TEST(Parallelize2DTile2DTriangular, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeJ * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d_triangular(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeJ, kParallelize2DTile2DTileI,
+		0 /* flags */);
+
+	ExpectUpperTriangleProcessedOnce(counters, kParallelize2DTile2DRangeJ, kParallelize2DTile2DTileI);
+}
+
+TEST(Parallelize2DTile2DTriangular, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeJ * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d_triangular(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeJ, kParallelize2DTile2DTileI,
+		0 /* flags */);
+
+	ExpectUpperTriangleProcessedOnce(counters, kParallelize2DTile2DRangeJ, kParallelize2DTile2DTileI);
+}
+
+TEST(Parallelize2DTile2DWavefront, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d_wavefront(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
+}
+
+TEST(Parallelize2DTile2DWavefront, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d_wavefront(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
+}
+
+/* Counts monotonic lattice paths to each element, which requires elements above and to the left to be computed first */
+static void CountPaths2DTile2D(uint64_t* paths, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		for (size_t j = start_j; j < start_j + tile_j; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			if (i == 0 || j == 0) {
+				paths[linear_idx] = 1;
+			} else {
+				paths[linear_idx] = paths[linear_idx - kParallelize2DTile2DRangeJ] + paths[linear_idx - 1];
+			}
+		}
+	}
+}
+
+TEST(Parallelize2DTile2DWavefront, MultiThreadPoolDependenciesSatisfied) {
+	std::vector<uint64_t> expected_paths(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+	CountPaths2DTile2D(expected_paths.data(), 0, 0, kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		std::vector<uint64_t> paths(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+		pthreadpool_parallelize_2d_tile_2d_wavefront(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(CountPaths2DTile2D),
+			static_cast<void*>(paths.data()),
+			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			0 /* flags */);
+
+		for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+			for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+				const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+				EXPECT_EQ(paths[linear_idx], expected_paths[linear_idx])
+					<< "Element (" << i << ", " << j << ") computed before its dependencies";
+			}
+		}
+	}
+}
+
+static void ComputeNothing2DTile2DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(threadpool.get(),
+		ComputeNothing2DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
+
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		ComputeNothing2DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
+
+static void CheckUArch2DTile2DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t) {
+	if (uarch_index != kDefaultUArchIndex) {
+		EXPECT_LE(uarch_index, kMaxUArchIndex);
+	}
+}
+
+TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolUArchInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckUArch2DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
+
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckUArch2DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
+
+static void CheckBounds2DTile2DWithUArch(void*, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	EXPECT_LT(start_i, kParallelize2DTile2DRangeI);
+	EXPECT_LT(start_j, kParallelize2DTile2DRangeJ);
+	EXPECT_LE(start_i + tile_i, kParallelize2DTile2DRangeI);
+	EXPECT_LE(start_j + tile_j, kParallelize2DTile2DRangeJ);
+}
+
+TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckBounds2DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
+
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckBounds2DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
+
+static void CheckTiling2DTile2DWithUArch(void*, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	EXPECT_GT(tile_i, 0);
+	EXPECT_LE(tile_i, kParallelize2DTile2DTileI);
+	EXPECT_EQ(start_i % kParallelize2DTile2DTileI, 0);
+	EXPECT_EQ(tile_i, std::min<size_t>(kParallelize2DTile2DTileI, kParallelize2DTile2DRangeI - start_i));
+
+	EXPECT_GT(tile_j, 0);
+	EXPECT_LE(tile_j, kParallelize2DTile2DTileJ);
+	EXPECT_EQ(start_j % kParallelize2DTile2DTileJ, 0);
+	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile2DTileJ, kParallelize2DTile2DRangeJ - start_j));
+}
+
+TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckTiling2DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
+
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckTiling2DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
+
+static void SetTrue2DTile2DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		for (size_t j = start_j; j < start_j + tile_j; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(SetTrue2DTile2DWithUArch),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
+		}
+	}
+}
+
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(SetTrue2DTile2DWithUArch),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
+		}
+	}
+}
+
+static void Increment2DTile2DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		for (size_t j = start_j; j < start_j + tile_j; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
+}
+
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
+}
+
+TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_2d_tile_2d_with_uarch(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
+		}
+	}
+}
+
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_2d_tile_2d_with_uarch(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
+		}
+	}
+}
+
+static void IncrementSame2DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		for (size_t j = start_j; j < start_j + tile_j; j++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(IncrementSame2DTile2DWithUArch),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+}
+
+static void WorkImbalance2DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	num_processed_items->fetch_add(tile_i * tile_j, std::memory_order_relaxed);
+	if (start_i == 0 && start_j == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(WorkImbalance2DTile2DWithUArch),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+}
+
+static void ComputeNothing3D(void*, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize3D, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d(threadpool.get(),
+		ComputeNothing3D,
+		nullptr,
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		0 /* flags */);
+}
+
+TEST(Parallelize3D, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d(
+		threadpool.get(),
+		ComputeNothing3D,
+		nullptr,
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		0 /* flags */);
+}
+
+static void CheckBounds3D(void*, size_t i, size_t j, size_t k) {
+	EXPECT_LT(i, kParallelize3DRangeI);
+	EXPECT_LT(j, kParallelize3DRangeJ);
+	EXPECT_LT(k, kParallelize3DRangeK);
+}
+
+TEST(Parallelize3D, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d(
+		threadpool.get(),
+		CheckBounds3D,
+		nullptr,
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		0 /* flags */);
+}
+
+TEST(Parallelize3D, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d(
+		threadpool.get(),
+		CheckBounds3D,
+		nullptr,
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		0 /* flags */);
+}
+
+static void SetTrue3D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k) {
+	const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
+	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+}
+
+TEST(Parallelize3D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_t>(SetTrue3D),
+		static_cast<void*>(indicators.data()),
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_t>(SetTrue3D),
+		static_cast<void*>(indicators.data()),
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
+			}
+		}
+	}
+}
+
+static void Increment3D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k) {
+	const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
+	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+}
+
+TEST(Parallelize3D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
+		static_cast<void*>(counters.data()),
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
+		static_cast<void*>(counters.data()),
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_3d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
+			static_cast<void*>(counters.data()),
+			kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+				0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_3d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
+			static_cast<void*>(counters.data()),
+			kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+				0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
+			}
+		}
+	}
+}
+
+static void IncrementSame3D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+}
+
+TEST(Parallelize3D, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_t>(IncrementSame3D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
+}
+
+static void WorkImbalance3D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize3D, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_t>(WorkImbalance3D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
+}
+
+static void ComputeNothing3DTile1D(void*, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize3DTile1D, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d(threadpool.get(),
+		ComputeNothing3DTile1D,
+		nullptr,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+TEST(Parallelize3DTile1D, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d(
+		threadpool.get(),
+		ComputeNothing3DTile1D,
+		nullptr,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void CheckBounds3DTile1D(void*, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_LT(i, kParallelize3DTile1DRangeI);
+	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
+	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
+	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
+}
+
+TEST(Parallelize3DTile1D, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d(
+		threadpool.get(),
+		CheckBounds3DTile1D,
+		nullptr,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+TEST(Parallelize3DTile1D, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d(
+		threadpool.get(),
+		CheckBounds3DTile1D,
+		nullptr,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void CheckTiling3DTile1D(void*, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_GT(tile_k, 0);
+	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
+	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
+}
+
+TEST(Parallelize3DTile1D, SingleThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d(
+		threadpool.get(),
+		CheckTiling3DTile1D,
+		nullptr,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+TEST(Parallelize3DTile1D, MultiThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d(
+		threadpool.get(),
+		CheckTiling3DTile1D,
+		nullptr,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void SetTrue3DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize3DTile1D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(SetTrue3DTile1D),
+		static_cast<void*>(indicators.data()),
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3DTile1D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(SetTrue3DTile1D),
+		static_cast<void*>(indicators.data()),
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
+			}
+		}
+	}
+}
+
+static void Increment3DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize3DTile1D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
+		static_cast<void*>(counters.data()),
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3DTile1D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
+		static_cast<void*>(counters.data()),
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_3d_tile_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
+			static_cast<void*>(counters.data()),
+			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+			kParallelize3DTile1DTileK,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_3d_tile_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
+			static_cast<void*>(counters.data()),
+			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+			kParallelize3DTile1DTileK,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
+			}
+		}
+	}
+}
+
+static void IncrementSame3DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize3DTile1D, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(IncrementSame3DTile1D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+}
+
+static void WorkImbalance3DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && start_k == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize3DTile1D, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(WorkImbalance3DTile1D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+}
+
+static void ComputeNothing3DTile1DWithThread(void*, size_t, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize3DTile1DWithThread, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
 	pthreadpool_parallelize_3d_tile_1d_with_thread(threadpool.get(),
 		ComputeNothing3DTile1DWithThread,
 		nullptr,
@@ -4317,7 +6117,775 @@ TEST(Parallelize3DTile1DWithThread, SingleThreadPoolCompletes) {
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolCompletes) {
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		ComputeNothing3DTile1DWithThread,
+		nullptr,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void CheckBounds3DTile1DWithThread(void*, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_LT(i, kParallelize3DTile1DRangeI);
+	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
+	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
+	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
+}
+
+TEST(Parallelize3DTile1DWithThread, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		CheckBounds3DTile1DWithThread,
+		nullptr,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		CheckBounds3DTile1DWithThread,
+		nullptr,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void CheckTiling3DTile1DWithThread(void*, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_GT(tile_k, 0);
+	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
+	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
+}
+
+TEST(Parallelize3DTile1DWithThread, SingleThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		CheckTiling3DTile1DWithThread,
+		nullptr,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		CheckTiling3DTile1DWithThread,
+		nullptr,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void SetTrue3DTile1DWithThread(std::atomic_bool* processed_indicators, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize3DTile1DWithThread, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(SetTrue3DTile1DWithThread),
+		static_cast<void*>(indicators.data()),
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(SetTrue3DTile1DWithThread),
+		static_cast<void*>(indicators.data()),
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
+			}
+		}
+	}
+}
+
+static void Increment3DTile1DWithThread(std::atomic_int* processed_counters, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize3DTile1DWithThread, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
+		static_cast<void*>(counters.data()),
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
+		static_cast<void*>(counters.data()),
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3DTile1DWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_3d_tile_1d_with_thread(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
+			static_cast<void*>(counters.data()),
+			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+			kParallelize3DTile1DTileK,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_3d_tile_1d_with_thread(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
+			static_cast<void*>(counters.data()),
+			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+			kParallelize3DTile1DTileK,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
+			}
+		}
+	}
+}
+
+static void IncrementSame3DTile1DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(IncrementSame3DTile1DWithThread),
+		static_cast<void*>(&num_processed_items),
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+}
+
+static void WorkImbalance3DTile1DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && start_k == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(WorkImbalance3DTile1DWithThread),
+		static_cast<void*>(&num_processed_items),
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+}
+
+static void CheckThreadIndexValid3DTile1DWithThread(const size_t* num_threads, size_t thread_index, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_LE(thread_index, *num_threads);
+}
+
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolThreadIndexValid) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(CheckThreadIndexValid3DTile1DWithThread),
+		static_cast<void*>(&num_threads),
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void ComputeNothing3DTile1DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(threadpool.get(),
+		ComputeNothing3DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		ComputeNothing3DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void CheckUArch3DTile1DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t) {
+	if (uarch_index != kDefaultUArchIndex) {
+		EXPECT_LE(uarch_index, kMaxUArchIndex);
+	}
+}
+
+TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolUArchInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		CheckUArch3DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolUArchInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		CheckUArch3DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void CheckBounds3DTile1DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_LT(i, kParallelize3DTile1DRangeI);
+	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
+	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
+	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
+}
+
+TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		CheckBounds3DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		CheckBounds3DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void CheckTiling3DTile1DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_GT(tile_k, 0);
+	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
+	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
+}
+
+TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		CheckTiling3DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		CheckTiling3DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void SetTrue3DTile1DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(SetTrue3DTile1DWithUArch),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(SetTrue3DTile1DWithUArch),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
+			}
+		}
+	}
+}
+
+static void Increment3DTile1DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_3d_tile_1d_with_uarch(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+			kParallelize3DTile1DTileK,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_3d_tile_1d_with_uarch(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+			kParallelize3DTile1DTileK,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
+			}
+		}
+	}
+}
+
+static void IncrementSame3DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(IncrementSame3DTile1DWithUArch),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+}
+
+static void WorkImbalance3DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && start_k == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(WorkImbalance3DTile1DWithUArch),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+}
+
+static void ComputeNothing3DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(threadpool.get(),
+		ComputeNothing3DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4325,36 +6893,76 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		ComputeNothing3DTile1DWithThread,
+		ComputeNothing3DTile1DWithUArchWithThread,
 		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
 		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
 		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void CheckBounds3DTile1DWithThread(void*, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+static void CheckUArch3DTile1DWithUArchWithThread(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t, size_t) {
+	if (uarch_index != kDefaultUArchIndex) {
+		EXPECT_LE(uarch_index, kMaxUArchIndex);
+	}
+}
+
+TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolUArchInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		CheckUArch3DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolUArchInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		CheckUArch3DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void CheckBounds3DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
 	EXPECT_LT(i, kParallelize3DTile1DRangeI);
 	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
 	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
 	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
 }
 
-TEST(Parallelize3DTile1DWithThread, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		CheckBounds3DTile1DWithThread,
+		CheckBounds3DTile1DWithUArchWithThread,
 		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
 		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
 		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4362,36 +6970,38 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		CheckBounds3DTile1DWithThread,
+		CheckBounds3DTile1DWithUArchWithThread,
 		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
 		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
 		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void CheckTiling3DTile1DWithThread(void*, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+static void CheckTiling3DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
 	EXPECT_GT(tile_k, 0);
 	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
 	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
 	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
 }
 
-TEST(Parallelize3DTile1DWithThread, SingleThreadPoolUniformTiling) {
+TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		CheckTiling3DTile1DWithThread,
+		CheckTiling3DTile1DWithUArchWithThread,
 		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
 		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
 		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolUniformTiling) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4399,32 +7009,34 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		CheckTiling3DTile1DWithThread,
+		CheckTiling3DTile1DWithUArchWithThread,
 		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
 		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
 		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void SetTrue3DTile1DWithThread(std::atomic_bool* processed_indicators, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+static void SetTrue3DTile1DWithUArchWithThread(std::atomic_bool* processed_indicators, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
 	for (size_t k = start_k; k < start_k + tile_k; k++) {
 		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
 		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, SingleThreadPoolAllItemsProcessed) {
+TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolAllItemsProcessed) {
 	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(SetTrue3DTile1DWithThread),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(SetTrue3DTile1DWithUArchWithThread),
 		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
 		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
 		kParallelize3DTile1DTileK,
 		0 /* flags */);
@@ -4440,7 +7052,7 @@ TEST(Parallelize3DTile1DWithThread, SingleThreadPoolAllItemsProcessed) {
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolAllItemsProcessed) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolAllItemsProcessed) {
 	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -4450,10 +7062,11 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(SetTrue3DTile1DWithThread),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(SetTrue3DTile1DWithUArchWithThread),
 		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
 		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
 		kParallelize3DTile1DTileK,
 		0 /* flags */);
@@ -4469,23 +7082,24 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolAllItemsProcessed) {
 	}
 }
 
-static void Increment3DTile1DWithThread(std::atomic_int* processed_counters, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+static void Increment3DTile1DWithUArchWithThread(std::atomic_int* processed_counters, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
 	for (size_t k = start_k; k < start_k + tile_k; k++) {
 		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
 		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, SingleThreadPoolEachItemProcessedOnce) {
+TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedOnce) {
 	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
 		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
 		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
 		kParallelize3DTile1DTileK,
 		0 /* flags */);
@@ -4502,7 +7116,7 @@ TEST(Parallelize3DTile1DWithThread, SingleThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolEachItemProcessedOnce) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedOnce) {
 	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -4512,10 +7126,11 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
 		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
 		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
 		kParallelize3DTile1DTileK,
 		0 /* flags */);
@@ -4532,17 +7147,18 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
+TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
 	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d_with_thread(
+		pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
 			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
 			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
 			kParallelize3DTile1DTileK,
 			0 /* flags */);
@@ -4561,7 +7177,7 @@ TEST(Parallelize3DTile1DWithThread, SingleThreadPoolEachItemProcessedMultipleTim
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -4572,10 +7188,11 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolEachItemProcessedMultipleTime
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d_with_thread(
+		pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
 			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
 			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
 			kParallelize3DTile1DTileK,
 			0 /* flags */);
@@ -4594,13 +7211,13 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolEachItemProcessedMultipleTime
 	}
 }
 
-static void IncrementSame3DTile1DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+static void IncrementSame3DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
 	for (size_t k = start_k; k < start_k + tile_k; k++) {
 		num_processed_items->fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolHighContention) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -4610,17 +7227,18 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(IncrementSame3DTile1DWithThread),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(IncrementSame3DTile1DWithUArchWithThread),
 		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
 		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
 		kParallelize3DTile1DTileK,
 		0 /* flags */);
 	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 }
 
-static void WorkImbalance3DTile1DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+static void WorkImbalance3DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
 	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
 	if (i == 0 && j == 0 && start_k == 0) {
 		/* Spin-wait until all items are computed */
@@ -4630,7 +7248,7 @@ static void WorkImbalance3DTile1DWithThread(std::atomic_int* num_processed_items
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolWorkStealing) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -4640,90 +7258,53 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(WorkImbalance3DTile1DWithThread),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(WorkImbalance3DTile1DWithUArchWithThread),
 		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
 		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
 		kParallelize3DTile1DTileK,
 		0 /* flags */);
 	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 }
 
-static void CheckThreadIndexValid3DTile1DWithThread(const size_t* num_threads, size_t thread_index, size_t i, size_t j, size_t start_k, size_t tile_k) {
+static void SetThreadTrue3DTile1DWithUArchWithThread(const size_t* num_threads, uint32_t, size_t thread_index, size_t i, size_t j, size_t start_k, size_t tile_k) {
 	EXPECT_LE(thread_index, *num_threads);
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolThreadIndexValid) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolThreadIndexValid) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(CheckThreadIndexValid3DTile1DWithThread),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(SetThreadTrue3DTile1DWithUArchWithThread),
 		static_cast<void*>(&num_threads),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-}
-
-static void ComputeNothing3DTile1DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t) {
-}
-
-TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(threadpool.get(),
-		ComputeNothing3DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-}
-
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
-		threadpool.get(),
-		ComputeNothing3DTile1DWithUArch,
-		nullptr,
 		kDefaultUArchIndex, kMaxUArchIndex,
 		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
 		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void CheckUArch3DTile1DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t) {
-	if (uarch_index != kDefaultUArchIndex) {
-		EXPECT_LE(uarch_index, kMaxUArchIndex);
-	}
+static void ComputeNothing3DTile2D(void*, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolUArchInBounds) {
+TEST(Parallelize3DTile2D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
-		threadpool.get(),
-		CheckUArch3DTile1DWithUArch,
+	pthreadpool_parallelize_3d_tile_2d(threadpool.get(),
+		ComputeNothing3DTile2D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolUArchInBounds) {
+TEST(Parallelize3DTile2D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4731,38 +7312,37 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolUArchInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		CheckUArch3DTile1DWithUArch,
+		ComputeNothing3DTile2D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-static void CheckBounds3DTile1DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_LT(i, kParallelize3DTile1DRangeI);
-	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
-	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
-	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
+static void CheckBounds3DTile2D(void*, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	EXPECT_LT(i, kParallelize3DTile2DRangeI);
+	EXPECT_LT(start_j, kParallelize3DTile2DRangeJ);
+	EXPECT_LT(start_k, kParallelize3DTile2DRangeK);
+	EXPECT_LE(start_j + tile_j, kParallelize3DTile2DRangeJ);
+	EXPECT_LE(start_k + tile_k, kParallelize3DTile2DRangeK);
 }
 
-TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile2D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		CheckBounds3DTile1DWithUArch,
+		CheckBounds3DTile2D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile2D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4770,38 +7350,41 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		CheckBounds3DTile1DWithUArch,
+		CheckBounds3DTile2D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-static void CheckTiling3DTile1DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+static void CheckTiling3DTile2D(void*, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	EXPECT_GT(tile_j, 0);
+	EXPECT_LE(tile_j, kParallelize3DTile2DTileJ);
+	EXPECT_EQ(start_j % kParallelize3DTile2DTileJ, 0);
+	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize3DTile2DTileJ, kParallelize3DTile2DRangeJ - start_j));
+
 	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
-	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
+	EXPECT_LE(tile_k, kParallelize3DTile2DTileK);
+	EXPECT_EQ(start_k % kParallelize3DTile2DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile2DTileK, kParallelize3DTile2DRangeK - start_k));
 }
 
-TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolUniformTiling) {
+TEST(Parallelize3DTile2D, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		CheckTiling3DTile1DWithUArch,
+		CheckTiling3DTile2D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolUniformTiling) {
+TEST(Parallelize3DTile2D, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4809,42 +7392,42 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		CheckTiling3DTile1DWithUArch,
+		CheckTiling3DTile2D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-static void SetTrue3DTile1DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void SetTrue3DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		for (size_t k = start_k; k < start_k + tile_k; k++) {
+			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize3DTile2D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(SetTrue3DTile1DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(SetTrue3DTile2D),
 		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
 				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
@@ -4852,8 +7435,8 @@ TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolAllItemsProcessed) {
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize3DTile2D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -4862,19 +7445,18 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(SetTrue3DTile1DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(SetTrue3DTile2D),
 		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
 				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
@@ -4882,32 +7464,63 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolAllItemsProcessed) {
 	}
 }
 
-static void Increment3DTile1DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void Increment3DTile2D(std::atomic_int* processed_counters, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		for (size_t k = start_k; k < start_k + tile_k; k++) {
+			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize3DTile2D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
+		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -4916,8 +7529,8 @@ TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize3DTile2D, MultiThreadPoolMortonOrderEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -4926,19 +7539,18 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		PTHREADPOOL_FLAG_MORTON_ORDER);
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -4947,27 +7559,26 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize3DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		pthreadpool_parallelize_3d_tile_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
+			reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-			kParallelize3DTile1DTileK,
+			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -4977,8 +7588,8 @@ TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolEachItemProcessedMultipleTime
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -4988,20 +7599,19 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		pthreadpool_parallelize_3d_tile_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
+			reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-			kParallelize3DTile1DTileK,
+			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -5011,13 +7621,15 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes
 	}
 }
 
-static void IncrementSame3DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+static void IncrementSame3DTile2D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		for (size_t k = start_k; k < start_k + tile_k; k++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolHighContention) {
+TEST(Parallelize3DTile2D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -5027,28 +7639,27 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(IncrementSame3DTile1DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(IncrementSame3DTile2D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 }
 
-static void WorkImbalance3DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && start_k == 0) {
+static void WorkImbalance3DTile2D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	num_processed_items->fetch_add(tile_j * tile_k, std::memory_order_relaxed);
+	if (i == 0 && start_j == 0 && start_k == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolWorkStealing) {
+TEST(Parallelize3DTile2D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -5058,34 +7669,53 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(WorkImbalance3DTile1DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(WorkImbalance3DTile2D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 }
 
-static void ComputeNothing3DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t, size_t, size_t, size_t) {
+TEST(Parallelize3DTile2D, MultiThreadPoolMortonOrderWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(WorkImbalance3DTile2D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		PTHREADPOOL_FLAG_MORTON_ORDER);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolCompletes) {
+static void ComputeNothing3DTile2DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(threadpool.get(),
-		ComputeNothing3DTile1DWithUArchWithThread,
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(threadpool.get(),
+		ComputeNothing3DTile2DWithUArch,
 		nullptr,
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolCompletes) {
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5093,37 +7723,37 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		ComputeNothing3DTile1DWithUArchWithThread,
+		ComputeNothing3DTile2DWithUArch,
 		nullptr,
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-static void CheckUArch3DTile1DWithUArchWithThread(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t, size_t) {
+static void CheckUArch3DTile2DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t, size_t) {
 	if (uarch_index != kDefaultUArchIndex) {
 		EXPECT_LE(uarch_index, kMaxUArchIndex);
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolUArchInBounds) {
+TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckUArch3DTile1DWithUArchWithThread,
+		CheckUArch3DTile2DWithUArch,
 		nullptr,
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolUArchInBounds) {
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5131,38 +7761,39 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolUArchInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckUArch3DTile1DWithUArchWithThread,
+		CheckUArch3DTile2DWithUArch,
 		nullptr,
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-static void CheckBounds3DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_LT(i, kParallelize3DTile1DRangeI);
-	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
-	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
-	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
+static void CheckBounds3DTile2DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	EXPECT_LT(i, kParallelize3DTile2DRangeI);
+	EXPECT_LT(start_j, kParallelize3DTile2DRangeJ);
+	EXPECT_LT(start_k, kParallelize3DTile2DRangeK);
+	EXPECT_LE(start_j + tile_j, kParallelize3DTile2DRangeJ);
+	EXPECT_LE(start_k + tile_k, kParallelize3DTile2DRangeK);
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckBounds3DTile1DWithUArchWithThread,
+		CheckBounds3DTile2DWithUArch,
 		nullptr,
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5170,38 +7801,43 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckBounds3DTile1DWithUArchWithThread,
+		CheckBounds3DTile2DWithUArch,
 		nullptr,
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-static void CheckTiling3DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+static void CheckTiling3DTile2DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	EXPECT_GT(tile_j, 0);
+	EXPECT_LE(tile_j, kParallelize3DTile2DTileJ);
+	EXPECT_EQ(start_j % kParallelize3DTile2DTileJ, 0);
+	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize3DTile2DTileJ, kParallelize3DTile2DRangeJ - start_j));
+
 	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
-	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
+	EXPECT_LE(tile_k, kParallelize3DTile2DTileK);
+	EXPECT_EQ(start_k % kParallelize3DTile2DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile2DTileK, kParallelize3DTile2DRangeK - start_k));
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolUniformTiling) {
+TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckTiling3DTile1DWithUArchWithThread,
+		CheckTiling3DTile2DWithUArch,
 		nullptr,
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolUniformTiling) {
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5209,42 +7845,44 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckTiling3DTile1DWithUArchWithThread,
+		CheckTiling3DTile2DWithUArch,
 		nullptr,
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-static void SetTrue3DTile1DWithUArchWithThread(std::atomic_bool* processed_indicators, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void SetTrue3DTile2DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		for (size_t k = start_k; k < start_k + tile_k; k++) {
+			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(SetTrue3DTile1DWithUArchWithThread),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(SetTrue3DTile2DWithUArch),
 		static_cast<void*>(indicators.data()),
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
 				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
@@ -5252,8 +7890,8 @@ TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolAllItemsProcessed)
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -5262,19 +7900,19 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(SetTrue3DTile1DWithUArchWithThread),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(SetTrue3DTile2DWithUArch),
 		static_cast<void*>(indicators.data()),
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
 				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
@@ -5282,32 +7920,34 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolAllItemsProcessed) {
 	}
 }
 
-static void Increment3DTile1DWithUArchWithThread(std::atomic_int* processed_counters, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void Increment3DTile2DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		for (size_t k = start_k; k < start_k + tile_k; k++) {
+			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
 		static_cast<void*>(counters.data()),
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -5316,8 +7956,8 @@ TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedOn
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -5326,19 +7966,19 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedOnc
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
 		static_cast<void*>(counters.data()),
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -5347,27 +7987,27 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedOnc
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+		pthreadpool_parallelize_3d_tile_2d_with_uarch(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
+			reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
 			static_cast<void*>(counters.data()),
 			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-			kParallelize3DTile1DTileK,
+			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -5377,8 +8017,8 @@ TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedMu
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -5388,20 +8028,20 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedMul
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+		pthreadpool_parallelize_3d_tile_2d_with_uarch(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
+			reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
 			static_cast<void*>(counters.data()),
 			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-			kParallelize3DTile1DTileK,
+			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -5411,13 +8051,15 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedMul
 	}
 }
 
-static void IncrementSame3DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+static void IncrementSame3DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		for (size_t k = start_k; k < start_k + tile_k; k++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolHighContention) {
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -5427,28 +8069,28 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(IncrementSame3DTile1DWithUArchWithThread),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(IncrementSame3DTile2DWithUArch),
 		static_cast<void*>(&num_processed_items),
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 }
 
-static void WorkImbalance3DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && start_k == 0) {
+static void WorkImbalance3DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	num_processed_items->fetch_add(tile_j * tile_k, std::memory_order_relaxed);
+	if (i == 0 && start_j == 0 && start_k == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolWorkStealing) {
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -5458,91 +8100,32 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(WorkImbalance3DTile1DWithUArchWithThread),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(WorkImbalance3DTile2DWithUArch),
 		static_cast<void*>(&num_processed_items),
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-}
-
-static void SetThreadTrue3DTile1DWithUArchWithThread(const size_t* num_threads, uint32_t, size_t thread_index, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_LE(thread_index, *num_threads);
-}
-
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolThreadIndexValid) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
-
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(SetThreadTrue3DTile1DWithUArchWithThread),
-		static_cast<void*>(&num_threads),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-}
-
-static void ComputeNothing3DTile2D(void*, size_t, size_t, size_t, size_t, size_t) {
-}
-
-TEST(Parallelize3DTile2D, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_3d_tile_2d(threadpool.get(),
-		ComputeNothing3DTile2D,
-		nullptr,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
-		0 /* flags */);
-}
-
-TEST(Parallelize3DTile2D, MultiThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_3d_tile_2d(
-		threadpool.get(),
-		ComputeNothing3DTile2D,
-		nullptr,
 		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
 		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 }
 
-static void CheckBounds3DTile2D(void*, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	EXPECT_LT(i, kParallelize3DTile2DRangeI);
-	EXPECT_LT(start_j, kParallelize3DTile2DRangeJ);
-	EXPECT_LT(start_k, kParallelize3DTile2DRangeK);
-	EXPECT_LE(start_j + tile_j, kParallelize3DTile2DRangeJ);
-	EXPECT_LE(start_k + tile_k, kParallelize3DTile2DRangeK);
+static void ComputeNothing4D(void*, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize3DTile2D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize4D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d(
-		threadpool.get(),
-		CheckBounds3DTile2D,
+	pthreadpool_parallelize_4d(threadpool.get(),
+		ComputeNothing4D,
 		nullptr,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile2D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize4D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5550,41 +8133,34 @@ TEST(Parallelize3DTile2D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		CheckBounds3DTile2D,
+		ComputeNothing4D,
 		nullptr,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
 }
 
-static void CheckTiling3DTile2D(void*, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	EXPECT_GT(tile_j, 0);
-	EXPECT_LE(tile_j, kParallelize3DTile2DTileJ);
-	EXPECT_EQ(start_j % kParallelize3DTile2DTileJ, 0);
-	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize3DTile2DTileJ, kParallelize3DTile2DRangeJ - start_j));
-
-	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize3DTile2DTileK);
-	EXPECT_EQ(start_k % kParallelize3DTile2DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile2DTileK, kParallelize3DTile2DRangeK - start_k));
+static void CheckBounds4D(void*, size_t i, size_t j, size_t k, size_t l) {
+	EXPECT_LT(i, kParallelize4DRangeI);
+	EXPECT_LT(j, kParallelize4DRangeJ);
+	EXPECT_LT(k, kParallelize4DRangeK);
+	EXPECT_LT(l, kParallelize4DRangeL);
 }
 
-TEST(Parallelize3DTile2D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize4D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		CheckTiling3DTile2D,
+		CheckBounds4D,
 		nullptr,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile2D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize4D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5592,51 +8168,47 @@ TEST(Parallelize3DTile2D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		CheckTiling3DTile2D,
+		CheckBounds4D,
 		nullptr,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
 }
 
-static void SetTrue3DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		for (size_t k = start_k; k < start_k + tile_k; k++) {
-			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
-	}
+static void SetTrue4D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l) {
+	const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 }
 
-TEST(Parallelize3DTile2D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize4D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(SetTrue3DTile2D),
+		reinterpret_cast<pthreadpool_task_4d_t>(SetTrue4D),
 		static_cast<void*>(indicators.data()),
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
+	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
+				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize3DTile2D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize4D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -5645,62 +8217,60 @@ TEST(Parallelize3DTile2D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(SetTrue3DTile2D),
+		reinterpret_cast<pthreadpool_task_4d_t>(SetTrue4D),
 		static_cast<void*>(indicators.data()),
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
+	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
+				}
 			}
 		}
 	}
 }
 
-static void Increment3DTile2D(std::atomic_int* processed_counters, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		for (size_t k = start_k; k < start_k + tile_k; k++) {
-			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-		}
-	}
+static void Increment4D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l) {
+	const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize3DTile2D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize4D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
+		reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
 		static_cast<void*>(counters.data()),
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize4D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -5709,57 +8279,59 @@ TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
+		reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
 		static_cast<void*>(counters.data()),
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize3DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize4D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_2d(
+		pthreadpool_parallelize_4d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
+			reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
 			static_cast<void*>(counters.data()),
-			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
-			0 /* flags */);
+			kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+				0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
+	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+						<< "(expected: " << kIncrementIterations << ")";
+				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize4D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -5769,67 +8341,34 @@ TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_2d(
+		pthreadpool_parallelize_4d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
+			reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
 			static_cast<void*>(counters.data()),
-			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
-			0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
-		}
-	}
-}
-
-static void IncrementSame3DTile2D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		for (size_t k = start_k; k < start_k + tile_k; k++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
-		}
-	}
-}
-
-TEST(Parallelize3DTile2D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
+			kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+				0 /* flags */);
 	}
 
-	pthreadpool_parallelize_3d_tile_2d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(IncrementSame3DTile2D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
-}
-
-static void WorkImbalance3DTile2D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	num_processed_items->fetch_add(tile_j * tile_k, std::memory_order_relaxed);
-	if (i == 0 && start_j == 0 && start_k == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK) {
-			std::atomic_thread_fence(std::memory_order_acquire);
+	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+						<< "(expected: " << kIncrementIterations << ")";
+				}
+			}
 		}
 	}
 }
 
-TEST(Parallelize3DTile2D, MultiThreadPoolWorkStealing) {
+static void IncrementSame4D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+}
+
+TEST(Parallelize4D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -5839,33 +8378,28 @@ TEST(Parallelize3DTile2D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(WorkImbalance3DTile2D),
+		reinterpret_cast<pthreadpool_task_4d_t>(IncrementSame4D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
 }
 
-static void ComputeNothing3DTile2DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t, size_t) {
+static void WorkImbalance4D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && l == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(threadpool.get(),
-		ComputeNothing3DTile2DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
-		0 /* flags */);
-}
+TEST(Parallelize4D, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5873,37 +8407,31 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		ComputeNothing3DTile2DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		reinterpret_cast<pthreadpool_task_4d_t>(WorkImbalance4D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
 }
 
-static void CheckUArch3DTile2DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t, size_t) {
-	if (uarch_index != kDefaultUArchIndex) {
-		EXPECT_LE(uarch_index, kMaxUArchIndex);
-	}
+static void ComputeNothing4DTile1D(void*, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolUArchInBounds) {
+TEST(Parallelize4DTile1D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
-		threadpool.get(),
-		CheckUArch3DTile2DWithUArch,
+	pthreadpool_parallelize_4d_tile_1d(threadpool.get(),
+		ComputeNothing4DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
+TEST(Parallelize4DTile1D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5911,39 +8439,37 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		CheckUArch3DTile2DWithUArch,
+		ComputeNothing4DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 }
 
-static void CheckBounds3DTile2DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	EXPECT_LT(i, kParallelize3DTile2DRangeI);
-	EXPECT_LT(start_j, kParallelize3DTile2DRangeJ);
-	EXPECT_LT(start_k, kParallelize3DTile2DRangeK);
-	EXPECT_LE(start_j + tile_j, kParallelize3DTile2DRangeJ);
-	EXPECT_LE(start_k + tile_k, kParallelize3DTile2DRangeK);
+static void CheckBounds4DTile1D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
+	EXPECT_LT(i, kParallelize4DTile1DRangeI);
+	EXPECT_LT(j, kParallelize4DTile1DRangeJ);
+	EXPECT_LT(k, kParallelize4DTile1DRangeK);
+	EXPECT_LT(start_l, kParallelize4DTile1DRangeL);
+	EXPECT_LE(start_l + tile_l, kParallelize4DTile1DRangeL);
 }
 
-TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize4DTile1D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		CheckBounds3DTile2DWithUArch,
+		CheckBounds4DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize4DTile1D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5951,43 +8477,36 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		CheckBounds3DTile2DWithUArch,
+		CheckBounds4DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 }
 
-static void CheckTiling3DTile2DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	EXPECT_GT(tile_j, 0);
-	EXPECT_LE(tile_j, kParallelize3DTile2DTileJ);
-	EXPECT_EQ(start_j % kParallelize3DTile2DTileJ, 0);
-	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize3DTile2DTileJ, kParallelize3DTile2DRangeJ - start_j));
-
-	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize3DTile2DTileK);
-	EXPECT_EQ(start_k % kParallelize3DTile2DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile2DTileK, kParallelize3DTile2DRangeK - start_k));
+static void CheckTiling4DTile1D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
+	EXPECT_GT(tile_l, 0);
+	EXPECT_LE(tile_l, kParallelize4DTile1DTileL);
+	EXPECT_EQ(start_l % kParallelize4DTile1DTileL, 0);
+	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize4DTile1DTileL, kParallelize4DTile1DRangeL - start_l));
 }
 
-TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolUniformTiling) {
+TEST(Parallelize4DTile1D, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		CheckTiling3DTile2DWithUArch,
+		CheckTiling4DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolUniformTiling) {
+TEST(Parallelize4DTile1D, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5995,53 +8514,51 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		CheckTiling3DTile2DWithUArch,
+		CheckTiling4DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 }
 
-static void SetTrue3DTile2DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		for (size_t k = start_k; k < start_k + tile_k; k++) {
-			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
+static void SetTrue4DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
+	for (size_t l = start_l; l < start_l + tile_l; l++) {
+		const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize4DTile1D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(SetTrue3DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(SetTrue4DTile1D),
 		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
+	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
+				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize4DTile1D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6050,64 +8567,64 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(SetTrue3DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(SetTrue4DTile1D),
 		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
+	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
+				}
 			}
 		}
 	}
 }
 
-static void Increment3DTile2DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		for (size_t k = start_k; k < start_k + tile_k; k++) {
-			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-		}
+static void Increment4DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
+	for (size_t l = start_l; l < start_l + tile_l; l++) {
+		const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize4DTile1D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize4DTile1D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6116,59 +8633,61 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize4DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_2d_with_uarch(
+		pthreadpool_parallelize_4d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
+			reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+			kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+			kParallelize4DTile1DTileL,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
+	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+						<< "(expected: " << kIncrementIterations << ")";
+				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize4DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6178,38 +8697,37 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_2d_with_uarch(
+		pthreadpool_parallelize_4d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
+			reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+			kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+			kParallelize4DTile1DTileL,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
+	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+						<< "(expected: " << kIncrementIterations << ")";
+				}
 			}
 		}
 	}
 }
 
-static void IncrementSame3DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		for (size_t k = start_k; k < start_k + tile_k; k++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
-		}
+static void IncrementSame4DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
+	for (size_t l = start_l; l < start_l + tile_l; l++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolHighContention) {
+TEST(Parallelize4DTile1D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -6219,28 +8737,27 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(IncrementSame3DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(IncrementSame4DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 }
 
-static void WorkImbalance3DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	num_processed_items->fetch_add(tile_j * tile_k, std::memory_order_relaxed);
-	if (i == 0 && start_j == 0 && start_k == 0) {
+static void WorkImbalance4DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
+	num_processed_items->fetch_add(tile_l, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && start_l == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolWorkStealing) {
+TEST(Parallelize4DTile1D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -6250,32 +8767,32 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(WorkImbalance3DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(WorkImbalance4DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 }
 
-static void ComputeNothing4D(void*, size_t, size_t, size_t, size_t) {
+static void ComputeNothing4DTile2D(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize4D, SingleThreadPoolCompletes) {
+TEST(Parallelize4DTile2D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d(threadpool.get(),
-		ComputeNothing4D,
+	pthreadpool_parallelize_4d_tile_2d(threadpool.get(),
+		ComputeNothing4DTile2D,
 		nullptr,
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 }
 
-TEST(Parallelize4D, MultiThreadPoolCompletes) {
+TEST(Parallelize4DTile2D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6283,34 +8800,38 @@ TEST(Parallelize4D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		ComputeNothing4D,
+		ComputeNothing4DTile2D,
 		nullptr,
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 }
 
-static void CheckBounds4D(void*, size_t i, size_t j, size_t k, size_t l) {
-	EXPECT_LT(i, kParallelize4DRangeI);
-	EXPECT_LT(j, kParallelize4DRangeJ);
-	EXPECT_LT(k, kParallelize4DRangeK);
-	EXPECT_LT(l, kParallelize4DRangeL);
+static void CheckBounds4DTile2D(void*, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	EXPECT_LT(i, kParallelize4DTile2DRangeI);
+	EXPECT_LT(j, kParallelize4DTile2DRangeJ);
+	EXPECT_LT(start_k, kParallelize4DTile2DRangeK);
+	EXPECT_LT(start_l, kParallelize4DTile2DRangeL);
+	EXPECT_LE(start_k + tile_k, kParallelize4DTile2DRangeK);
+	EXPECT_LE(start_l + tile_l, kParallelize4DTile2DRangeL);
 }
 
-TEST(Parallelize4D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize4DTile2D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		CheckBounds4D,
+		CheckBounds4DTile2D,
 		nullptr,
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 }
 
-TEST(Parallelize4D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize4DTile2D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6318,37 +8839,85 @@ TEST(Parallelize4D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		CheckBounds4D,
+		CheckBounds4DTile2D,
 		nullptr,
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 }
 
-static void SetTrue4D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l) {
-	const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
-	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-}
+static void CheckTiling4DTile2D(void*, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	EXPECT_GT(tile_k, 0);
+	EXPECT_LE(tile_k, kParallelize4DTile2DTileK);
+	EXPECT_EQ(start_k % kParallelize4DTile2DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize4DTile2DTileK, kParallelize4DTile2DRangeK - start_k));
 
-TEST(Parallelize4D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+	EXPECT_GT(tile_l, 0);
+	EXPECT_LE(tile_l, kParallelize4DTile2DTileL);
+	EXPECT_EQ(start_l % kParallelize4DTile2DTileL, 0);
+	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize4DTile2DTileL, kParallelize4DTile2DRangeL - start_l));
+}
 
+TEST(Parallelize4DTile2D, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_t>(SetTrue4D),
-		static_cast<void*>(indicators.data()),
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		CheckTiling4DTile2D,
+		nullptr,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
+}
 
-	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+TEST(Parallelize4DTile2D, MultiThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d(
+		threadpool.get(),
+		CheckTiling4DTile2D,
+		nullptr,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+}
+
+static void SetTrue4DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		for (size_t l = start_l; l < start_l + tile_l; l++) {
+			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize4DTile2D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_4d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(SetTrue4DTile2D),
+		static_cast<void*>(indicators.data()),
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
 					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
 				}
@@ -6357,8 +8926,8 @@ TEST(Parallelize4D, SingleThreadPoolAllItemsProcessed) {
 	}
 }
 
-TEST(Parallelize4D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+TEST(Parallelize4DTile2D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6367,18 +8936,19 @@ TEST(Parallelize4D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_t>(SetTrue4D),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(SetTrue4DTile2D),
 		static_cast<void*>(indicators.data()),
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
 					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
 				}
@@ -6387,29 +8957,34 @@ TEST(Parallelize4D, MultiThreadPoolAllItemsProcessed) {
 	}
 }
 
-static void Increment4D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l) {
-	const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
-	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void Increment4DTile2D(std::atomic_int* processed_counters, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		for (size_t l = start_l; l < start_l + tile_l; l++) {
+			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
 }
 
-TEST(Parallelize4D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+TEST(Parallelize4DTile2D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
 		static_cast<void*>(counters.data()),
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
 					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
 						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -6419,8 +8994,8 @@ TEST(Parallelize4D, SingleThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize4D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+TEST(Parallelize4DTile2D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6429,18 +9004,19 @@ TEST(Parallelize4D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
 		static_cast<void*>(counters.data()),
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
 					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
 						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -6450,26 +9026,27 @@ TEST(Parallelize4D, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize4D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+TEST(Parallelize4DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d(
+		pthreadpool_parallelize_4d_tile_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
+			reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
 			static_cast<void*>(counters.data()),
-			kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
-				0 /* flags */);
+			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
 					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
 						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -6480,8 +9057,8 @@ TEST(Parallelize4D, SingleThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-TEST(Parallelize4D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+TEST(Parallelize4DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6491,19 +9068,20 @@ TEST(Parallelize4D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d(
+		pthreadpool_parallelize_4d_tile_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
+			reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
 			static_cast<void*>(counters.data()),
-			kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
-				0 /* flags */);
+			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
 					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
 						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -6514,11 +9092,15 @@ TEST(Parallelize4D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-static void IncrementSame4D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+static void IncrementSame4DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		for (size_t l = start_l; l < start_l + tile_l; l++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+		}
+	}
 }
 
-TEST(Parallelize4D, MultiThreadPoolHighContention) {
+TEST(Parallelize4DTile2D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -6528,26 +9110,27 @@ TEST(Parallelize4D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_t>(IncrementSame4D),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(IncrementSame4DTile2D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 }
 
-static void WorkImbalance4D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && l == 0) {
+static void WorkImbalance4DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	num_processed_items->fetch_add(tile_k * tile_l, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && start_k == 0 && start_l == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize4D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize4DTile2D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -6557,31 +9140,33 @@ TEST(Parallelize4D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_t>(WorkImbalance4D),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(WorkImbalance4DTile2D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 }
 
-static void ComputeNothing4DTile1D(void*, size_t, size_t, size_t, size_t, size_t) {
+static void ComputeNothing4DTile2DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize4DTile1D, SingleThreadPoolCompletes) {
+TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_1d(threadpool.get(),
-		ComputeNothing4DTile1D,
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(threadpool.get(),
+		ComputeNothing4DTile2DWithUArch,
 		nullptr,
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolCompletes) {
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6589,37 +9174,37 @@ TEST(Parallelize4DTile1D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
 		threadpool.get(),
-		ComputeNothing4DTile1D,
+		ComputeNothing4DTile2DWithUArch,
 		nullptr,
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 }
 
-static void CheckBounds4DTile1D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
-	EXPECT_LT(i, kParallelize4DTile1DRangeI);
-	EXPECT_LT(j, kParallelize4DTile1DRangeJ);
-	EXPECT_LT(k, kParallelize4DTile1DRangeK);
-	EXPECT_LT(start_l, kParallelize4DTile1DRangeL);
-	EXPECT_LE(start_l + tile_l, kParallelize4DTile1DRangeL);
+static void CheckUArch4DTile2DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t, size_t, size_t) {
+	if (uarch_index != kDefaultUArchIndex) {
+		EXPECT_LE(uarch_index, kMaxUArchIndex);
+	}
 }
 
-TEST(Parallelize4DTile1D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckBounds4DTile1D,
+		CheckUArch4DTile2DWithUArch,
 		nullptr,
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6627,36 +9212,84 @@ TEST(Parallelize4DTile1D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckBounds4DTile1D,
+		CheckUArch4DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+}
+
+static void CheckBounds4DTile2DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	EXPECT_LT(i, kParallelize4DTile2DRangeI);
+	EXPECT_LT(j, kParallelize4DTile2DRangeJ);
+	EXPECT_LT(start_k, kParallelize4DTile2DRangeK);
+	EXPECT_LT(start_l, kParallelize4DTile2DRangeL);
+	EXPECT_LE(start_k + tile_k, kParallelize4DTile2DRangeK);
+	EXPECT_LE(start_l + tile_l, kParallelize4DTile2DRangeL);
+}
+
+TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckBounds4DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+}
+
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckBounds4DTile2DWithUArch,
 		nullptr,
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 }
 
-static void CheckTiling4DTile1D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
+static void CheckTiling4DTile2DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	EXPECT_GT(tile_k, 0);
+	EXPECT_LE(tile_k, kParallelize4DTile2DTileK);
+	EXPECT_EQ(start_k % kParallelize4DTile2DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize4DTile2DTileK, kParallelize4DTile2DRangeK - start_k));
+
 	EXPECT_GT(tile_l, 0);
-	EXPECT_LE(tile_l, kParallelize4DTile1DTileL);
-	EXPECT_EQ(start_l % kParallelize4DTile1DTileL, 0);
-	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize4DTile1DTileL, kParallelize4DTile1DRangeL - start_l));
+	EXPECT_LE(tile_l, kParallelize4DTile2DTileL);
+	EXPECT_EQ(start_l % kParallelize4DTile2DTileL, 0);
+	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize4DTile2DTileL, kParallelize4DTile2DRangeL - start_l));
 }
 
-TEST(Parallelize4DTile1D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckTiling4DTile1D,
+		CheckTiling4DTile2DWithUArch,
 		nullptr,
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6664,41 +9297,45 @@ TEST(Parallelize4DTile1D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckTiling4DTile1D,
+		CheckTiling4DTile2DWithUArch,
 		nullptr,
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 }
 
-static void SetTrue4DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
-	for (size_t l = start_l; l < start_l + tile_l; l++) {
-		const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void SetTrue4DTile2DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		for (size_t l = start_l; l < start_l + tile_l; l++) {
+			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+		}
 	}
 }
 
-TEST(Parallelize4DTile1D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
+TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(SetTrue4DTile1D),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(SetTrue4DTile2DWithUArch),
 		static_cast<void*>(indicators.data()),
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
 					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
 				}
@@ -6707,8 +9344,8 @@ TEST(Parallelize4DTile1D, SingleThreadPoolAllItemsProcessed) {
 	}
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6717,19 +9354,20 @@ TEST(Parallelize4DTile1D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(SetTrue4DTile1D),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(SetTrue4DTile2DWithUArch),
 		static_cast<void*>(indicators.data()),
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
 					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
 				}
@@ -6738,32 +9376,35 @@ TEST(Parallelize4DTile1D, MultiThreadPoolAllItemsProcessed) {
 	}
 }
 
-static void Increment4DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
-	for (size_t l = start_l; l < start_l + tile_l; l++) {
-		const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void Increment4DTile2DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		for (size_t l = start_l; l < start_l + tile_l; l++) {
+			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
 	}
 }
 
-TEST(Parallelize4DTile1D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
+TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
 		static_cast<void*>(counters.data()),
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
 					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
 						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -6773,8 +9414,8 @@ TEST(Parallelize4DTile1D, SingleThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6783,19 +9424,20 @@ TEST(Parallelize4DTile1D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
 		static_cast<void*>(counters.data()),
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
 					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
 						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -6805,27 +9447,28 @@ TEST(Parallelize4DTile1D, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize4DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
+TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d_tile_1d(
+		pthreadpool_parallelize_4d_tile_2d_with_uarch(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
+			reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
 			static_cast<void*>(counters.data()),
-			kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-			kParallelize4DTile1DTileL,
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
 					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
 						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -6836,8 +9479,8 @@ TEST(Parallelize4DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6847,20 +9490,21 @@ TEST(Parallelize4DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d_tile_1d(
+		pthreadpool_parallelize_4d_tile_2d_with_uarch(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
+			reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
 			static_cast<void*>(counters.data()),
-			kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-			kParallelize4DTile1DTileL,
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
 					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
 						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -6871,78 +9515,48 @@ TEST(Parallelize4DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-static void IncrementSame4DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
-	for (size_t l = start_l; l < start_l + tile_l; l++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	}
-}
-
-TEST(Parallelize4DTile1D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_4d_tile_1d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(IncrementSame4DTile1D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
-}
-
-static void WorkImbalance4DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
-	num_processed_items->fetch_add(tile_l, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && start_l == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL) {
-			std::atomic_thread_fence(std::memory_order_acquire);
+static void IncrementSame4DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		for (size_t l = start_l; l < start_l + tile_l; l++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
 		}
 	}
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_4d_tile_1d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(WorkImbalance4DTile1D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
-}
-
-static void ComputeNothing4DTile2D(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
-}
-
-TEST(Parallelize4DTile2D, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d(threadpool.get(),
-		ComputeNothing4DTile2D,
-		nullptr,
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(IncrementSame4DTile2DWithUArch),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
 		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
 		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolCompletes) {
+static void WorkImbalance4DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	num_processed_items->fetch_add(tile_k * tile_l, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && start_k == 0 && start_l == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6950,38 +9564,32 @@ TEST(Parallelize4DTile2D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
 		threadpool.get(),
-		ComputeNothing4DTile2D,
-		nullptr,
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(WorkImbalance4DTile2DWithUArch),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
 		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
 		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 }
 
-static void CheckBounds4DTile2D(void*, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	EXPECT_LT(i, kParallelize4DTile2DRangeI);
-	EXPECT_LT(j, kParallelize4DTile2DRangeJ);
-	EXPECT_LT(start_k, kParallelize4DTile2DRangeK);
-	EXPECT_LT(start_l, kParallelize4DTile2DRangeL);
-	EXPECT_LE(start_k + tile_k, kParallelize4DTile2DRangeK);
-	EXPECT_LE(start_l + tile_l, kParallelize4DTile2DRangeL);
+static void ComputeNothing5D(void*, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize4DTile2D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize5D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d(
-		threadpool.get(),
-		CheckBounds4DTile2D,
+	pthreadpool_parallelize_5d(threadpool.get(),
+		ComputeNothing5D,
 		nullptr,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize5D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6989,41 +9597,35 @@ TEST(Parallelize4DTile2D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_5d(
 		threadpool.get(),
-		CheckBounds4DTile2D,
+		ComputeNothing5D,
 		nullptr,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
 		0 /* flags */);
 }
 
-static void CheckTiling4DTile2D(void*, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize4DTile2DTileK);
-	EXPECT_EQ(start_k % kParallelize4DTile2DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize4DTile2DTileK, kParallelize4DTile2DRangeK - start_k));
-
-	EXPECT_GT(tile_l, 0);
-	EXPECT_LE(tile_l, kParallelize4DTile2DTileL);
-	EXPECT_EQ(start_l % kParallelize4DTile2DTileL, 0);
-	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize4DTile2DTileL, kParallelize4DTile2DRangeL - start_l));
+static void CheckBounds5D(void*, size_t i, size_t j, size_t k, size_t l, size_t m) {
+	EXPECT_LT(i, kParallelize5DRangeI);
+	EXPECT_LT(j, kParallelize5DRangeJ);
+	EXPECT_LT(k, kParallelize5DRangeK);
+	EXPECT_LT(l, kParallelize5DRangeL);
+	EXPECT_LT(m, kParallelize5DRangeM);
 }
 
-TEST(Parallelize4DTile2D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize5D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_5d(
 		threadpool.get(),
-		CheckTiling4DTile2D,
+		CheckBounds5D,
 		nullptr,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize5D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -7031,53 +9633,49 @@ TEST(Parallelize4DTile2D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_5d(
 		threadpool.get(),
-		CheckTiling4DTile2D,
+		CheckBounds5D,
 		nullptr,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
 		0 /* flags */);
 }
 
-static void SetTrue4DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		for (size_t l = start_l; l < start_l + tile_l; l++) {
-			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
-	}
+static void SetTrue5D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t m) {
+	const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 }
 
-TEST(Parallelize4DTile2D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize5D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_5d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(SetTrue4DTile2D),
+		reinterpret_cast<pthreadpool_task_5d_t>(SetTrue5D),
 		static_cast<void*>(indicators.data()),
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
+	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
+					}
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize5D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7086,66 +9684,64 @@ TEST(Parallelize4DTile2D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_5d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(SetTrue4DTile2D),
+		reinterpret_cast<pthreadpool_task_5d_t>(SetTrue5D),
 		static_cast<void*>(indicators.data()),
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
+	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
+					}
 				}
 			}
 		}
 	}
 }
 
-static void Increment4DTile2D(std::atomic_int* processed_counters, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		for (size_t l = start_l; l < start_l + tile_l; l++) {
-			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-		}
-	}
+static void Increment5D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t m) {
+	const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize4DTile2D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize5D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_5d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
+		reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
 		static_cast<void*>(counters.data()),
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+					}
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize5D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7154,61 +9750,63 @@ TEST(Parallelize4DTile2D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_5d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
+		reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
 		static_cast<void*>(counters.data()),
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+					}
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize5D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d_tile_2d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
-			static_cast<void*>(counters.data()),
-			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
-			0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-						<< "(expected: " << kIncrementIterations << ")";
+	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
+		pthreadpool_parallelize_5d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
+			static_cast<void*>(counters.data()),
+			kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+				0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+							<< "(expected: " << kIncrementIterations5D << ")";
+					}
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize5D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7217,40 +9815,37 @@ TEST(Parallelize4DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d_tile_2d(
+	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
+		pthreadpool_parallelize_5d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
+			reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
 			static_cast<void*>(counters.data()),
-			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
-			0 /* flags */);
+			kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+				0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-						<< "(expected: " << kIncrementIterations << ")";
+	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+							<< "(expected: " << kIncrementIterations5D << ")";
+					}
 				}
 			}
 		}
 	}
 }
 
-static void IncrementSame4DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		for (size_t l = start_l; l < start_l + tile_l; l++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
-		}
-	}
+static void IncrementSame5D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolHighContention) {
+TEST(Parallelize5D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -7260,27 +9855,26 @@ TEST(Parallelize4DTile2D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_5d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(IncrementSame4DTile2D),
+		reinterpret_cast<pthreadpool_task_5d_t>(IncrementSame5D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
 }
 
-static void WorkImbalance4DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	num_processed_items->fetch_add(tile_k * tile_l, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && start_k == 0 && start_l == 0) {
+static void WorkImbalance5D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && l == 0 && m == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize5D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -7290,71 +9884,31 @@ TEST(Parallelize4DTile2D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_5d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(WorkImbalance4DTile2D),
+		reinterpret_cast<pthreadpool_task_5d_t>(WorkImbalance5D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
-}
-
-static void ComputeNothing4DTile2DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t, size_t, size_t) {
-}
-
-TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(threadpool.get(),
-		ComputeNothing4DTile2DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
-		0 /* flags */);
-}
-
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
-		threadpool.get(),
-		ComputeNothing4DTile2DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
 }
 
-static void CheckUArch4DTile2DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t, size_t, size_t) {
-	if (uarch_index != kDefaultUArchIndex) {
-		EXPECT_LE(uarch_index, kMaxUArchIndex);
-	}
+static void ComputeNothing5DTile1D(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolUArchInBounds) {
+TEST(Parallelize5DTile1D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
-		threadpool.get(),
-		CheckUArch4DTile2DWithUArch,
+	pthreadpool_parallelize_5d_tile_1d(threadpool.get(),
+		ComputeNothing5DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
+TEST(Parallelize5DTile1D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -7362,40 +9916,38 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_5d_tile_1d(
 		threadpool.get(),
-		CheckUArch4DTile2DWithUArch,
+		ComputeNothing5DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
 		0 /* flags */);
 }
 
-static void CheckBounds4DTile2DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	EXPECT_LT(i, kParallelize4DTile2DRangeI);
-	EXPECT_LT(j, kParallelize4DTile2DRangeJ);
-	EXPECT_LT(start_k, kParallelize4DTile2DRangeK);
-	EXPECT_LT(start_l, kParallelize4DTile2DRangeL);
-	EXPECT_LE(start_k + tile_k, kParallelize4DTile2DRangeK);
-	EXPECT_LE(start_l + tile_l, kParallelize4DTile2DRangeL);
+static void CheckBounds5DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
+	EXPECT_LT(i, kParallelize5DTile1DRangeI);
+	EXPECT_LT(j, kParallelize5DTile1DRangeJ);
+	EXPECT_LT(k, kParallelize5DTile1DRangeK);
+	EXPECT_LT(l, kParallelize5DTile1DRangeL);
+	EXPECT_LT(start_m, kParallelize5DTile1DRangeM);
+	EXPECT_LE(start_m + tile_m, kParallelize5DTile1DRangeM);
 }
 
-TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize5DTile1D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_5d_tile_1d(
 		threadpool.get(),
-		CheckBounds4DTile2DWithUArch,
+		CheckBounds5DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize5DTile1D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -7403,43 +9955,36 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_5d_tile_1d(
 		threadpool.get(),
-		CheckBounds4DTile2DWithUArch,
+		CheckBounds5DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
 		0 /* flags */);
 }
 
-static void CheckTiling4DTile2DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize4DTile2DTileK);
-	EXPECT_EQ(start_k % kParallelize4DTile2DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize4DTile2DTileK, kParallelize4DTile2DRangeK - start_k));
-
-	EXPECT_GT(tile_l, 0);
-	EXPECT_LE(tile_l, kParallelize4DTile2DTileL);
-	EXPECT_EQ(start_l % kParallelize4DTile2DTileL, 0);
-	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize4DTile2DTileL, kParallelize4DTile2DRangeL - start_l));
+static void CheckTiling5DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
+	EXPECT_GT(tile_m, 0);
+	EXPECT_LE(tile_m, kParallelize5DTile1DTileM);
+	EXPECT_EQ(start_m % kParallelize5DTile1DTileM, 0);
+	EXPECT_EQ(tile_m, std::min<size_t>(kParallelize5DTile1DTileM, kParallelize5DTile1DRangeM - start_m));
 }
 
-TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolUniformTiling) {
+TEST(Parallelize5DTile1D, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_5d_tile_1d(
 		threadpool.get(),
-		CheckTiling4DTile2DWithUArch,
+		CheckTiling5DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolUniformTiling) {
+TEST(Parallelize5DTile1D, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -7447,55 +9992,53 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_5d_tile_1d(
 		threadpool.get(),
-		CheckTiling4DTile2DWithUArch,
+		CheckTiling5DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
 		0 /* flags */);
 }
 
-static void SetTrue4DTile2DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		for (size_t l = start_l; l < start_l + tile_l; l++) {
-			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
+static void SetTrue5DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
+	for (size_t m = start_m; m < start_m + tile_m; m++) {
+		const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize5DTile1D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_5d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(SetTrue4DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(SetTrue5DTile1D),
 		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
+	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
+					}
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize5DTile1D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7504,68 +10047,68 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_5d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(SetTrue4DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(SetTrue5DTile1D),
 		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
+	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
+					}
 				}
 			}
 		}
 	}
 }
 
-static void Increment4DTile2DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		for (size_t l = start_l; l < start_l + tile_l; l++) {
-			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-		}
+static void Increment5DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
+	for (size_t m = start_m; m < start_m + tile_m; m++) {
+		const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize5DTile1D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_5d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+					}
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize5DTile1D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7574,63 +10117,65 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_5d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+					}
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize5DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
+		pthreadpool_parallelize_5d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
+			reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+			kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+			kParallelize5DTile1DTileM,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-						<< "(expected: " << kIncrementIterations << ")";
+	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+							<< "(expected: " << kIncrementIterations5D << ")";
+					}
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize5DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7639,41 +10184,40 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
+		pthreadpool_parallelize_5d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
+			reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+			kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+			kParallelize5DTile1DTileM,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-						<< "(expected: " << kIncrementIterations << ")";
+	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+							<< "(expected: " << kIncrementIterations5D << ")";
+					}
 				}
 			}
 		}
 	}
 }
 
-static void IncrementSame4DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		for (size_t l = start_l; l < start_l + tile_l; l++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
-		}
+static void IncrementSame5DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
+	for (size_t m = start_m; m < start_m + tile_m; m++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolHighContention) {
+TEST(Parallelize5DTile1D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -7683,28 +10227,27 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_5d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(IncrementSame4DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(IncrementSame5DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
 }
 
-static void WorkImbalance4DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	num_processed_items->fetch_add(tile_k * tile_l, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && start_k == 0 && start_l == 0) {
+static void WorkImbalance5DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
+	num_processed_items->fetch_add(tile_m, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && l == 0 && start_m == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolWorkStealing) {
+TEST(Parallelize5DTile1D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -7714,32 +10257,72 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_5d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(WorkImbalance4DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(WorkImbalance5DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
 }
 
-static void ComputeNothing5D(void*, size_t, size_t, size_t, size_t, size_t) {
+static void ComputeNothing5DTile2D(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize5DTile2D, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d_tile_2d(threadpool.get(),
+		ComputeNothing5DTile2D,
+		nullptr,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		0 /* flags */);
+}
+
+TEST(Parallelize5DTile2D, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_2d(
+		threadpool.get(),
+		ComputeNothing5DTile2D,
+		nullptr,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		0 /* flags */);
+}
+
+static void CheckBounds5DTile2D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+	EXPECT_LT(i, kParallelize5DTile2DRangeI);
+	EXPECT_LT(j, kParallelize5DTile2DRangeJ);
+	EXPECT_LT(k, kParallelize5DTile2DRangeK);
+	EXPECT_LT(start_l, kParallelize5DTile2DRangeL);
+	EXPECT_LT(start_m, kParallelize5DTile2DRangeM);
+	EXPECT_LE(start_l + tile_l, kParallelize5DTile2DRangeL);
+	EXPECT_LE(start_m + tile_m, kParallelize5DTile2DRangeM);
 }
 
-TEST(Parallelize5D, SingleThreadPoolCompletes) {
+TEST(Parallelize5DTile2D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d(threadpool.get(),
-		ComputeNothing5D,
+	pthreadpool_parallelize_5d_tile_2d(
+		threadpool.get(),
+		CheckBounds5DTile2D,
 		nullptr,
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
 		0 /* flags */);
 }
 
-TEST(Parallelize5D, MultiThreadPoolCompletes) {
+TEST(Parallelize5DTile2D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -7747,35 +10330,41 @@ TEST(Parallelize5D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_5d_tile_2d(
 		threadpool.get(),
-		ComputeNothing5D,
+		CheckBounds5DTile2D,
 		nullptr,
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
 		0 /* flags */);
 }
 
-static void CheckBounds5D(void*, size_t i, size_t j, size_t k, size_t l, size_t m) {
-	EXPECT_LT(i, kParallelize5DRangeI);
-	EXPECT_LT(j, kParallelize5DRangeJ);
-	EXPECT_LT(k, kParallelize5DRangeK);
-	EXPECT_LT(l, kParallelize5DRangeL);
-	EXPECT_LT(m, kParallelize5DRangeM);
+static void CheckTiling5DTile2D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+	EXPECT_GT(tile_l, 0);
+	EXPECT_LE(tile_l, kParallelize5DTile2DTileL);
+	EXPECT_EQ(start_l % kParallelize5DTile2DTileL, 0);
+	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize5DTile2DTileL, kParallelize5DTile2DRangeL - start_l));
+
+	EXPECT_GT(tile_m, 0);
+	EXPECT_LE(tile_m, kParallelize5DTile2DTileM);
+	EXPECT_EQ(start_m % kParallelize5DTile2DTileM, 0);
+	EXPECT_EQ(tile_m, std::min<size_t>(kParallelize5DTile2DTileM, kParallelize5DTile2DRangeM - start_m));
 }
 
-TEST(Parallelize5D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize5DTile2D, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_5d_tile_2d(
 		threadpool.get(),
-		CheckBounds5D,
+		CheckTiling5DTile2D,
 		nullptr,
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
 		0 /* flags */);
 }
 
-TEST(Parallelize5D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize5DTile2D, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -7783,38 +10372,44 @@ TEST(Parallelize5D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_5d_tile_2d(
 		threadpool.get(),
-		CheckBounds5D,
+		CheckTiling5DTile2D,
 		nullptr,
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
 		0 /* flags */);
 }
 
-static void SetTrue5D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t m) {
-	const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
-	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void SetTrue5DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+	for (size_t l = start_l; l < start_l + tile_l; l++) {
+		for (size_t m = start_m; m < start_m + tile_m; m++) {
+			const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+		}
+	}
 }
 
-TEST(Parallelize5D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+TEST(Parallelize5DTile2D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_5d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_t>(SetTrue5D),
+		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(SetTrue5DTile2D),
 		static_cast<void*>(indicators.data()),
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
 						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
 					}
@@ -7824,8 +10419,8 @@ TEST(Parallelize5D, SingleThreadPoolAllItemsProcessed) {
 	}
 }
 
-TEST(Parallelize5D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+TEST(Parallelize5DTile2D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7834,19 +10429,20 @@ TEST(Parallelize5D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_5d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_t>(SetTrue5D),
+		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(SetTrue5DTile2D),
 		static_cast<void*>(indicators.data()),
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
 						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
 					}
@@ -7856,30 +10452,35 @@ TEST(Parallelize5D, MultiThreadPoolAllItemsProcessed) {
 	}
 }
 
-static void Increment5D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t m) {
-	const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
-	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void Increment5DTile2D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+	for (size_t l = start_l; l < start_l + tile_l; l++) {
+		for (size_t m = start_m; m < start_m + tile_m; m++) {
+			const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
 }
 
-TEST(Parallelize5D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+TEST(Parallelize5DTile2D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_5d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
+		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
 		static_cast<void*>(counters.data()),
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
 						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
 							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -7890,8 +10491,8 @@ TEST(Parallelize5D, SingleThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize5D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+TEST(Parallelize5DTile2D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7900,19 +10501,20 @@ TEST(Parallelize5D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_5d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
+		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
 		static_cast<void*>(counters.data()),
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
 						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
 							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -7923,27 +10525,28 @@ TEST(Parallelize5D, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize5D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+TEST(Parallelize5DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
-		pthreadpool_parallelize_5d(
+		pthreadpool_parallelize_5d_tile_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
+			reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
 			static_cast<void*>(counters.data()),
-			kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
-				0 /* flags */);
+			kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+			kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
 						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
 							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
 							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -7955,8 +10558,8 @@ TEST(Parallelize5D, SingleThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-TEST(Parallelize5D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+TEST(Parallelize5DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7966,65 +10569,41 @@ TEST(Parallelize5D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
-		pthreadpool_parallelize_5d(
+		pthreadpool_parallelize_5d_tile_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
+			reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
 			static_cast<void*>(counters.data()),
-			kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
-				0 /* flags */);
+			kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+			kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
 						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
 							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
 							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
 							<< "(expected: " << kIncrementIterations5D << ")";
 					}
 				}
-			}
-		}
-	}
-}
-
-static void IncrementSame5D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-}
-
-TEST(Parallelize5D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_5d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_t>(IncrementSame5D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
-}
-
-static void WorkImbalance5D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && l == 0 && m == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM) {
-			std::atomic_thread_fence(std::memory_order_acquire);
+			}
 		}
 	}
 }
 
-TEST(Parallelize5D, MultiThreadPoolWorkStealing) {
+static void IncrementSame5DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+	for (size_t l = start_l; l < start_l + tile_l; l++) {
+		for (size_t m = start_m; m < start_m + tile_m; m++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize5DTile2D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -8034,31 +10613,29 @@ TEST(Parallelize5D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_5d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_t>(WorkImbalance5D),
+		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(IncrementSame5DTile2D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
 }
 
-static void ComputeNothing5DTile1D(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
+static void WorkImbalance5DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+	num_processed_items->fetch_add(tile_l * tile_m, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && start_l == 0 && start_m == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
 }
 
-TEST(Parallelize5DTile1D, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_5d_tile_1d(threadpool.get(),
-		ComputeNothing5DTile1D,
-		nullptr,
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
-		0 /* flags */);
-}
+TEST(Parallelize5DTile2D, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
-TEST(Parallelize5DTile1D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8066,38 +10643,31 @@ TEST(Parallelize5DTile1D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_5d_tile_2d(
 		threadpool.get(),
-		ComputeNothing5DTile1D,
-		nullptr,
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(WorkImbalance5DTile2D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
 }
 
-static void CheckBounds5DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
-	EXPECT_LT(i, kParallelize5DTile1DRangeI);
-	EXPECT_LT(j, kParallelize5DTile1DRangeJ);
-	EXPECT_LT(k, kParallelize5DTile1DRangeK);
-	EXPECT_LT(l, kParallelize5DTile1DRangeL);
-	EXPECT_LT(start_m, kParallelize5DTile1DRangeM);
-	EXPECT_LE(start_m + tile_m, kParallelize5DTile1DRangeM);
+static void ComputeNothing6D(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize5DTile1D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize6D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_1d(
-		threadpool.get(),
-		CheckBounds5DTile1D,
+	pthreadpool_parallelize_6d(threadpool.get(),
+		ComputeNothing6D,
 		nullptr,
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
 		0 /* flags */);
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize6D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8105,36 +10675,36 @@ TEST(Parallelize5DTile1D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_6d(
 		threadpool.get(),
-		CheckBounds5DTile1D,
+		ComputeNothing6D,
 		nullptr,
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
 		0 /* flags */);
 }
 
-static void CheckTiling5DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
-	EXPECT_GT(tile_m, 0);
-	EXPECT_LE(tile_m, kParallelize5DTile1DTileM);
-	EXPECT_EQ(start_m % kParallelize5DTile1DTileM, 0);
-	EXPECT_EQ(tile_m, std::min<size_t>(kParallelize5DTile1DTileM, kParallelize5DTile1DRangeM - start_m));
+static void CheckBounds6D(void*, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
+	EXPECT_LT(i, kParallelize6DRangeI);
+	EXPECT_LT(j, kParallelize6DRangeJ);
+	EXPECT_LT(k, kParallelize6DRangeK);
+	EXPECT_LT(l, kParallelize6DRangeL);
+	EXPECT_LT(m, kParallelize6DRangeM);
+	EXPECT_LT(n, kParallelize6DRangeN);
 }
 
-TEST(Parallelize5DTile1D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize6D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_6d(
 		threadpool.get(),
-		CheckTiling5DTile1D,
+		CheckBounds6D,
 		nullptr,
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
 		0 /* flags */);
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize6D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8142,44 +10712,42 @@ TEST(Parallelize5DTile1D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_6d(
 		threadpool.get(),
-		CheckTiling5DTile1D,
+		CheckBounds6D,
 		nullptr,
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
 		0 /* flags */);
 }
 
-static void SetTrue5DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
-	for (size_t m = start_m; m < start_m + tile_m; m++) {
-		const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-	}
+static void SetTrue6D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
+	const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 }
 
-TEST(Parallelize5DTile1D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+TEST(Parallelize6D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_6d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(SetTrue5DTile1D),
+		reinterpret_cast<pthreadpool_task_6d_t>(SetTrue6D),
 		static_cast<void*>(indicators.data()),
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
+	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
+						}
 					}
 				}
 			}
@@ -8187,8 +10755,8 @@ TEST(Parallelize5DTile1D, SingleThreadPoolAllItemsProcessed) {
 	}
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+TEST(Parallelize6D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8197,22 +10765,23 @@ TEST(Parallelize5DTile1D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_6d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(SetTrue5DTile1D),
+		reinterpret_cast<pthreadpool_task_6d_t>(SetTrue6D),
 		static_cast<void*>(indicators.data()),
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
+	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
+						}
 					}
 				}
 			}
@@ -8220,36 +10789,35 @@ TEST(Parallelize5DTile1D, MultiThreadPoolAllItemsProcessed) {
 	}
 }
 
-static void Increment5DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
-	for (size_t m = start_m; m < start_m + tile_m; m++) {
-		const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-	}
+static void Increment6D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
+	const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize5DTile1D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+TEST(Parallelize6D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_6d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
+		reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
 		static_cast<void*>(counters.data()),
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+						}
 					}
 				}
 			}
@@ -8257,8 +10825,8 @@ TEST(Parallelize5DTile1D, SingleThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+TEST(Parallelize6D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8267,23 +10835,24 @@ TEST(Parallelize5DTile1D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_6d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
+		reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
 		static_cast<void*>(counters.data()),
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+						}
 					}
 				}
 			}
@@ -8291,32 +10860,33 @@ TEST(Parallelize5DTile1D, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize5DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+TEST(Parallelize6D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
-		pthreadpool_parallelize_5d_tile_1d(
+	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
+		pthreadpool_parallelize_6d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
+			reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
 			static_cast<void*>(counters.data()),
-			kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-			kParallelize5DTile1DTileM,
-			0 /* flags */);
+			kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+				0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-							<< "(expected: " << kIncrementIterations5D << ")";
+	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+								<< "(expected: " << kIncrementIterations6D << ")";
+						}
 					}
 				}
 			}
@@ -8324,8 +10894,8 @@ TEST(Parallelize5DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+TEST(Parallelize6D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8334,26 +10904,27 @@ TEST(Parallelize5DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
-		pthreadpool_parallelize_5d_tile_1d(
+	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
+		pthreadpool_parallelize_6d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
+			reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
 			static_cast<void*>(counters.data()),
-			kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-			kParallelize5DTile1DTileM,
-			0 /* flags */);
+			kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+				0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-							<< "(expected: " << kIncrementIterations5D << ")";
+	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+								<< "(expected: " << kIncrementIterations6D << ")";
+						}
 					}
 				}
 			}
@@ -8361,13 +10932,11 @@ TEST(Parallelize5DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-static void IncrementSame5DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
-	for (size_t m = start_m; m < start_m + tile_m; m++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	}
+static void IncrementSame6D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolHighContention) {
+TEST(Parallelize6D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -8377,27 +10946,26 @@ TEST(Parallelize5DTile1D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_6d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(IncrementSame5DTile1D),
+		reinterpret_cast<pthreadpool_task_6d_t>(IncrementSame6D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
 }
 
-static void WorkImbalance5DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
-	num_processed_items->fetch_add(tile_m, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && l == 0 && start_m == 0) {
+static void WorkImbalance6D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && l == 0 && m == 0 && n == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize6D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -8407,32 +10975,31 @@ TEST(Parallelize5DTile1D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_6d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(WorkImbalance5DTile1D),
+		reinterpret_cast<pthreadpool_task_6d_t>(WorkImbalance6D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
 }
 
-static void ComputeNothing5DTile2D(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
+static void ComputeNothing6DTile1D(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize5DTile2D, SingleThreadPoolCompletes) {
+TEST(Parallelize6DTile1D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_2d(threadpool.get(),
-		ComputeNothing5DTile2D,
+	pthreadpool_parallelize_6d_tile_1d(threadpool.get(),
+		ComputeNothing6DTile1D,
 		nullptr,
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
 		0 /* flags */);
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolCompletes) {
+TEST(Parallelize6DTile1D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8440,39 +11007,39 @@ TEST(Parallelize5DTile2D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_6d_tile_1d(
 		threadpool.get(),
-		ComputeNothing5DTile2D,
+		ComputeNothing6DTile1D,
 		nullptr,
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
 		0 /* flags */);
 }
 
-static void CheckBounds5DTile2D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
-	EXPECT_LT(i, kParallelize5DTile2DRangeI);
-	EXPECT_LT(j, kParallelize5DTile2DRangeJ);
-	EXPECT_LT(k, kParallelize5DTile2DRangeK);
-	EXPECT_LT(start_l, kParallelize5DTile2DRangeL);
-	EXPECT_LT(start_m, kParallelize5DTile2DRangeM);
-	EXPECT_LE(start_l + tile_l, kParallelize5DTile2DRangeL);
-	EXPECT_LE(start_m + tile_m, kParallelize5DTile2DRangeM);
+static void CheckBounds6DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
+	EXPECT_LT(i, kParallelize6DTile1DRangeI);
+	EXPECT_LT(j, kParallelize6DTile1DRangeJ);
+	EXPECT_LT(k, kParallelize6DTile1DRangeK);
+	EXPECT_LT(l, kParallelize6DTile1DRangeL);
+	EXPECT_LT(m, kParallelize6DTile1DRangeM);
+	EXPECT_LT(start_n, kParallelize6DTile1DRangeN);
+	EXPECT_LE(start_n + tile_n, kParallelize6DTile1DRangeN);
 }
 
-TEST(Parallelize5DTile2D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize6DTile1D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_6d_tile_1d(
 		threadpool.get(),
-		CheckBounds5DTile2D,
+		CheckBounds6DTile1D,
 		nullptr,
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
 		0 /* flags */);
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize6DTile1D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8480,41 +11047,36 @@ TEST(Parallelize5DTile2D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_6d_tile_1d(
 		threadpool.get(),
-		CheckBounds5DTile2D,
+		CheckBounds6DTile1D,
 		nullptr,
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
 		0 /* flags */);
 }
 
-static void CheckTiling5DTile2D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
-	EXPECT_GT(tile_l, 0);
-	EXPECT_LE(tile_l, kParallelize5DTile2DTileL);
-	EXPECT_EQ(start_l % kParallelize5DTile2DTileL, 0);
-	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize5DTile2DTileL, kParallelize5DTile2DRangeL - start_l));
-
-	EXPECT_GT(tile_m, 0);
-	EXPECT_LE(tile_m, kParallelize5DTile2DTileM);
-	EXPECT_EQ(start_m % kParallelize5DTile2DTileM, 0);
-	EXPECT_EQ(tile_m, std::min<size_t>(kParallelize5DTile2DTileM, kParallelize5DTile2DRangeM - start_m));
+static void CheckTiling6DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
+	EXPECT_GT(tile_n, 0);
+	EXPECT_LE(tile_n, kParallelize6DTile1DTileN);
+	EXPECT_EQ(start_n % kParallelize6DTile1DTileN, 0);
+	EXPECT_EQ(tile_n, std::min<size_t>(kParallelize6DTile1DTileN, kParallelize6DTile1DRangeN - start_n));
 }
 
-TEST(Parallelize5DTile2D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize6DTile1D, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_6d_tile_1d(
 		threadpool.get(),
-		CheckTiling5DTile2D,
+		CheckTiling6DTile1D,
 		nullptr,
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
 		0 /* flags */);
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize6DTile1D, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8522,46 +11084,46 @@ TEST(Parallelize5DTile2D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_6d_tile_1d(
 		threadpool.get(),
-		CheckTiling5DTile2D,
+		CheckTiling6DTile1D,
 		nullptr,
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
 		0 /* flags */);
 }
 
-static void SetTrue5DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
-	for (size_t l = start_l; l < start_l + tile_l; l++) {
-		for (size_t m = start_m; m < start_m + tile_m; m++) {
-			const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
+static void SetTrue6DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
+	for (size_t n = start_n; n < start_n + tile_n; n++) {
+		const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize5DTile2D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+TEST(Parallelize6DTile1D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_6d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(SetTrue5DTile2D),
+		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(SetTrue6DTile1D),
 		static_cast<void*>(indicators.data()),
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
+	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
+						}
 					}
 				}
 			}
@@ -8569,8 +11131,8 @@ TEST(Parallelize5DTile2D, SingleThreadPoolAllItemsProcessed) {
 	}
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+TEST(Parallelize6DTile1D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8579,22 +11141,24 @@ TEST(Parallelize5DTile2D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_6d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(SetTrue5DTile2D),
+		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(SetTrue6DTile1D),
 		static_cast<void*>(indicators.data()),
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
+						}
 					}
 				}
 			}
@@ -8602,38 +11166,38 @@ TEST(Parallelize5DTile2D, MultiThreadPoolAllItemsProcessed) {
 	}
 }
 
-static void Increment5DTile2D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
-	for (size_t l = start_l; l < start_l + tile_l; l++) {
-		for (size_t m = start_m; m < start_m + tile_m; m++) {
-			const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-		}
+static void Increment6DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
+	for (size_t n = start_n; n < start_n + tile_n; n++) {
+		const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize5DTile2D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+TEST(Parallelize6DTile1D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_6d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
+		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
 		static_cast<void*>(counters.data()),
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+						}
 					}
 				}
 			}
@@ -8641,8 +11205,8 @@ TEST(Parallelize5DTile2D, SingleThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+TEST(Parallelize6DTile1D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8651,23 +11215,25 @@ TEST(Parallelize5DTile2D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_6d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
+		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
 		static_cast<void*>(counters.data()),
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+						}
 					}
 				}
 			}
@@ -8675,32 +11241,34 @@ TEST(Parallelize5DTile2D, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize5DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+TEST(Parallelize6DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
-		pthreadpool_parallelize_5d_tile_2d(
+	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
+		pthreadpool_parallelize_6d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
+			reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
 			static_cast<void*>(counters.data()),
-			kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-			kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+			kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+			kParallelize6DTile1DTileN,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-							<< "(expected: " << kIncrementIterations5D << ")";
+	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+								<< "(expected: " << kIncrementIterations6D << ")";
+						}
 					}
 				}
 			}
@@ -8708,8 +11276,8 @@ TEST(Parallelize5DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+TEST(Parallelize6DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8718,26 +11286,28 @@ TEST(Parallelize5DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
-		pthreadpool_parallelize_5d_tile_2d(
+	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
+		pthreadpool_parallelize_6d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
+			reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
 			static_cast<void*>(counters.data()),
-			kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-			kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+			kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+			kParallelize6DTile1DTileN,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-							<< "(expected: " << kIncrementIterations5D << ")";
+	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+								<< "(expected: " << kIncrementIterations6D << ")";
+						}
 					}
 				}
 			}
@@ -8745,15 +11315,13 @@ TEST(Parallelize5DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-static void IncrementSame5DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
-	for (size_t l = start_l; l < start_l + tile_l; l++) {
-		for (size_t m = start_m; m < start_m + tile_m; m++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
-		}
+static void IncrementSame6DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
+	for (size_t n = start_n; n < start_n + tile_n; n++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolHighContention) {
+TEST(Parallelize6DTile1D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -8763,27 +11331,27 @@ TEST(Parallelize5DTile2D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_6d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(IncrementSame5DTile2D),
+		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(IncrementSame6DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
 }
 
-static void WorkImbalance5DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
-	num_processed_items->fetch_add(tile_l * tile_m, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && start_l == 0 && start_m == 0) {
+static void WorkImbalance6DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
+	num_processed_items->fetch_add(tile_n, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && l == 0 && m == 0 && start_n == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize6DTile1D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -8793,31 +11361,32 @@ TEST(Parallelize5DTile2D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_6d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(WorkImbalance5DTile2D),
+		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(WorkImbalance6DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
 }
 
-static void ComputeNothing6D(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
+static void ComputeNothing6DTile2D(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize6D, SingleThreadPoolCompletes) {
+TEST(Parallelize6DTile2D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d(threadpool.get(),
-		ComputeNothing6D,
+	pthreadpool_parallelize_6d_tile_2d(threadpool.get(),
+		ComputeNothing6DTile2D,
 		nullptr,
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
 		0 /* flags */);
 }
 
-TEST(Parallelize6D, MultiThreadPoolCompletes) {
+TEST(Parallelize6DTile2D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8825,36 +11394,82 @@ TEST(Parallelize6D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_6d_tile_2d(
 		threadpool.get(),
-		ComputeNothing6D,
+		ComputeNothing6DTile2D,
+		nullptr,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		0 /* flags */);
+}
+
+static void CheckBounds6DTile2D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
+	EXPECT_LT(i, kParallelize6DTile2DRangeI);
+	EXPECT_LT(j, kParallelize6DTile2DRangeJ);
+	EXPECT_LT(k, kParallelize6DTile2DRangeK);
+	EXPECT_LT(l, kParallelize6DTile2DRangeL);
+	EXPECT_LT(start_m, kParallelize6DTile2DRangeM);
+	EXPECT_LT(start_n, kParallelize6DTile2DRangeN);
+	EXPECT_LE(start_m + tile_m, kParallelize6DTile2DRangeM);
+	EXPECT_LE(start_n + tile_n, kParallelize6DTile2DRangeN);
+}
+
+TEST(Parallelize6DTile2D, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d_tile_2d(
+		threadpool.get(),
+		CheckBounds6DTile2D,
+		nullptr,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		0 /* flags */);
+}
+
+TEST(Parallelize6DTile2D, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_2d(
+		threadpool.get(),
+		CheckBounds6DTile2D,
 		nullptr,
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
 		0 /* flags */);
 }
 
-static void CheckBounds6D(void*, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
-	EXPECT_LT(i, kParallelize6DRangeI);
-	EXPECT_LT(j, kParallelize6DRangeJ);
-	EXPECT_LT(k, kParallelize6DRangeK);
-	EXPECT_LT(l, kParallelize6DRangeL);
-	EXPECT_LT(m, kParallelize6DRangeM);
-	EXPECT_LT(n, kParallelize6DRangeN);
+static void CheckTiling6DTile2D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
+	EXPECT_GT(tile_m, 0);
+	EXPECT_LE(tile_m, kParallelize6DTile2DTileM);
+	EXPECT_EQ(start_m % kParallelize6DTile2DTileM, 0);
+	EXPECT_EQ(tile_m, std::min<size_t>(kParallelize6DTile2DTileM, kParallelize6DTile2DRangeM - start_m));
+
+	EXPECT_GT(tile_n, 0);
+	EXPECT_LE(tile_n, kParallelize6DTile2DTileN);
+	EXPECT_EQ(start_n % kParallelize6DTile2DTileN, 0);
+	EXPECT_EQ(tile_n, std::min<size_t>(kParallelize6DTile2DTileN, kParallelize6DTile2DRangeN - start_n));
 }
 
-TEST(Parallelize6D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize6DTile2D, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_6d_tile_2d(
 		threadpool.get(),
-		CheckBounds6D,
+		CheckTiling6DTile2D,
 		nullptr,
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
 		0 /* flags */);
 }
 
-TEST(Parallelize6D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize6DTile2D, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8862,39 +11477,45 @@ TEST(Parallelize6D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_6d_tile_2d(
 		threadpool.get(),
-		CheckBounds6D,
+		CheckTiling6DTile2D,
 		nullptr,
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
 		0 /* flags */);
 }
 
-static void SetTrue6D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
-	const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
-	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void SetTrue6DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
+	for (size_t m = start_m; m < start_m + tile_m; m++) {
+		for (size_t n = start_n; n < start_n + tile_n; n++) {
+			const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+		}
+	}
 }
 
-TEST(Parallelize6D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+TEST(Parallelize6DTile2D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_6d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_t>(SetTrue6D),
+		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(SetTrue6DTile2D),
 		static_cast<void*>(indicators.data()),
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
 							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
 						}
@@ -8905,8 +11526,8 @@ TEST(Parallelize6D, SingleThreadPoolAllItemsProcessed) {
 	}
 }
 
-TEST(Parallelize6D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+TEST(Parallelize6DTile2D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8915,20 +11536,21 @@ TEST(Parallelize6D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_6d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_t>(SetTrue6D),
+		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(SetTrue6DTile2D),
 		static_cast<void*>(indicators.data()),
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
 							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
 						}
@@ -8939,31 +11561,36 @@ TEST(Parallelize6D, MultiThreadPoolAllItemsProcessed) {
 	}
 }
 
-static void Increment6D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
-	const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
-	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void Increment6DTile2D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
+	for (size_t m = start_m; m < start_m + tile_m; m++) {
+		for (size_t n = start_n; n < start_n + tile_n; n++) {
+			const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
 }
 
-TEST(Parallelize6D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+TEST(Parallelize6DTile2D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_6d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
+		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
 		static_cast<void*>(counters.data()),
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
 							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
 								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -8975,8 +11602,8 @@ TEST(Parallelize6D, SingleThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize6D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+TEST(Parallelize6DTile2D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8985,20 +11612,21 @@ TEST(Parallelize6D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_6d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
+		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
 		static_cast<void*>(counters.data()),
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
 							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
 								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -9010,28 +11638,65 @@ TEST(Parallelize6D, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize6D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+TEST(Parallelize6DTile2D, MultiThreadPoolGuidedScheduleEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		PTHREADPOOL_FLAG_GUIDED_SCHEDULE);
+
+	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize6DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
-		pthreadpool_parallelize_6d(
+		pthreadpool_parallelize_6d_tile_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
+			reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
 			static_cast<void*>(counters.data()),
-			kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
-				0 /* flags */);
+			kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+			kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN;
+	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
 							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
 								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
 								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -9044,8 +11709,8 @@ TEST(Parallelize6D, SingleThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-TEST(Parallelize6D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+TEST(Parallelize6DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9055,21 +11720,22 @@ TEST(Parallelize6D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
-		pthreadpool_parallelize_6d(
+		pthreadpool_parallelize_6d_tile_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
+			reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
 			static_cast<void*>(counters.data()),
-			kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
-				0 /* flags */);
+			kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+			kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
 							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
 								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
 								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -9082,11 +11748,15 @@ TEST(Parallelize6D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-static void IncrementSame6D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+static void IncrementSame6DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
+	for (size_t m = start_m; m < start_m + tile_m; m++) {
+		for (size_t n = start_n; n < start_n + tile_n; n++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+		}
+	}
 }
 
-TEST(Parallelize6D, MultiThreadPoolHighContention) {
+TEST(Parallelize6DTile2D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -9096,26 +11766,27 @@ TEST(Parallelize6D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_6d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_t>(IncrementSame6D),
+		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(IncrementSame6DTile2D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
 }
 
-static void WorkImbalance6D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && l == 0 && m == 0 && n == 0) {
+static void WorkImbalance6DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
+	num_processed_items->fetch_add(tile_m * tile_n, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && l == 0 && start_m == 0 && start_n == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize6D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize6DTile2D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -9125,164 +11796,80 @@ TEST(Parallelize6D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_6d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_t>(WorkImbalance6D),
+		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(WorkImbalance6DTile2D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
-}
-
-static void ComputeNothing6DTile1D(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
-}
-
-TEST(Parallelize6DTile1D, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_6d_tile_1d(threadpool.get(),
-		ComputeNothing6DTile1D,
-		nullptr,
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
 }
 
-TEST(Parallelize6DTile1D, MultiThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
+struct IncrementNDContext {
+	size_t num_dims;
+	const size_t* range;
+	const size_t* tile;
+	std::atomic_int* counters;
+};
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
+static size_t ItemsND(size_t num_dims, const size_t* range) {
+	size_t items = 1;
+	for (size_t d = 0; d < num_dims; d++) {
+		items *= range[d];
 	}
-
-	pthreadpool_parallelize_6d_tile_1d(
-		threadpool.get(),
-		ComputeNothing6DTile1D,
-		nullptr,
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
-}
-
-static void CheckBounds6DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
-	EXPECT_LT(i, kParallelize6DTile1DRangeI);
-	EXPECT_LT(j, kParallelize6DTile1DRangeJ);
-	EXPECT_LT(k, kParallelize6DTile1DRangeK);
-	EXPECT_LT(l, kParallelize6DTile1DRangeL);
-	EXPECT_LT(m, kParallelize6DTile1DRangeM);
-	EXPECT_LT(start_n, kParallelize6DTile1DRangeN);
-	EXPECT_LE(start_n + tile_n, kParallelize6DTile1DRangeN);
-}
-
-TEST(Parallelize6DTile1D, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_6d_tile_1d(
-		threadpool.get(),
-		CheckBounds6DTile1D,
-		nullptr,
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
+	return items;
 }
 
-TEST(Parallelize6DTile1D, MultiThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
+static void IncrementND(IncrementNDContext* context, const size_t* index, const size_t* tile_size) {
+	for (size_t d = 0; d < context->num_dims; d++) {
+		const size_t tile = context->tile != nullptr ? context->tile[d] : 1;
+		EXPECT_LT(index[d], context->range[d]);
+		EXPECT_EQ(index[d] % tile, 0);
+		EXPECT_EQ(tile_size[d], std::min<size_t>(tile, context->range[d] - index[d]));
 	}
-
-	pthreadpool_parallelize_6d_tile_1d(
-		threadpool.get(),
-		CheckBounds6DTile1D,
-		nullptr,
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
-}
-
-static void CheckTiling6DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
-	EXPECT_GT(tile_n, 0);
-	EXPECT_LE(tile_n, kParallelize6DTile1DTileN);
-	EXPECT_EQ(start_n % kParallelize6DTile1DTileN, 0);
-	EXPECT_EQ(tile_n, std::min<size_t>(kParallelize6DTile1DTileN, kParallelize6DTile1DRangeN - start_n));
-}
-
-TEST(Parallelize6DTile1D, SingleThreadPoolUniformTiling) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_6d_tile_1d(
-		threadpool.get(),
-		CheckTiling6DTile1D,
-		nullptr,
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
-}
-
-TEST(Parallelize6DTile1D, MultiThreadPoolUniformTiling) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
+	/* Increment every item of the tile at its row-major position in the grid */
+	const size_t tile_items = ItemsND(context->num_dims, tile_size);
+	for (size_t t = 0; t < tile_items; t++) {
+		size_t offset = t;
+		size_t linear_idx = 0;
+		size_t stride = 1;
+		for (size_t d = context->num_dims; d != 0; d--) {
+			linear_idx += (index[d - 1] + offset % tile_size[d - 1]) * stride;
+			offset /= tile_size[d - 1];
+			stride *= context->range[d - 1];
+		}
+		context->counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 	}
-
-	pthreadpool_parallelize_6d_tile_1d(
-		threadpool.get(),
-		CheckTiling6DTile1D,
-		nullptr,
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
 }
 
-static void SetTrue6DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
-	for (size_t n = start_n; n < start_n + tile_n; n++) {
-		const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void ExpectEachItemProcessedOnceND(const std::vector<std::atomic_int>& counters) {
+	for (size_t i = 0; i < counters.size(); i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize6DTile1D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+TEST(ParallelizeND, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(ItemsND(7, kParallelizeND7DRange));
+	IncrementNDContext context = { 7, kParallelizeND7DRange, kParallelizeND7DTile, counters.data() };
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d_tile_1d(
+	pthreadpool_parallelize_nd(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(SetTrue6DTile1D),
-		static_cast<void*>(indicators.data()),
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
+		reinterpret_cast<pthreadpool_task_nd_t>(IncrementND),
+		static_cast<void*>(&context),
+		7, kParallelizeND7DRange, kParallelizeND7DTile,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
-						}
-					}
-				}
-			}
-		}
-	}
+	ExpectEachItemProcessedOnceND(counters);
 }
 
-TEST(Parallelize6DTile1D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+TEST(ParallelizeND, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(ItemsND(2, kParallelizeND2DRange));
+	IncrementNDContext context = { 2, kParallelizeND2DRange, kParallelizeND2DTile, counters.data() };
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9291,72 +11878,19 @@ TEST(Parallelize6DTile1D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_1d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(SetTrue6DTile1D),
-		static_cast<void*>(indicators.data()),
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
-						}
-					}
-				}
-			}
-		}
-	}
-}
-
-static void Increment6DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
-	for (size_t n = start_n; n < start_n + tile_n; n++) {
-		const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-	}
-}
-
-TEST(Parallelize6DTile1D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_6d_tile_1d(
+	pthreadpool_parallelize_nd(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
-		static_cast<void*>(counters.data()),
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
+		reinterpret_cast<pthreadpool_task_nd_t>(IncrementND),
+		static_cast<void*>(&context),
+		2, kParallelizeND2DRange, kParallelizeND2DTile,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-						}
-					}
-				}
-			}
-		}
-	}
+	ExpectEachItemProcessedOnceND(counters);
 }
 
-TEST(Parallelize6DTile1D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+TEST(ParallelizeND, MultiThreadPoolUnitTilesEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(ItemsND(4, kParallelizeND4DRange));
+	IncrementNDContext context = { 4, kParallelizeND4DRange, nullptr, counters.data() };
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9365,69 +11899,39 @@ TEST(Parallelize6DTile1D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_1d(
+	pthreadpool_parallelize_nd(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
-		static_cast<void*>(counters.data()),
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
+		reinterpret_cast<pthreadpool_task_nd_t>(IncrementND),
+		static_cast<void*>(&context),
+		4, kParallelizeND4DRange, nullptr /* tile */,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-						}
-					}
-				}
-			}
-		}
-	}
+	ExpectEachItemProcessedOnceND(counters);
 }
 
-TEST(Parallelize6DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
+TEST(ParallelizeND, MultiThreadPool7DGuidedScheduleEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(ItemsND(7, kParallelizeND7DRange));
+	IncrementNDContext context = { 7, kParallelizeND7DRange, kParallelizeND7DTile, counters.data() };
 
-	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
-		pthreadpool_parallelize_6d_tile_1d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
-			static_cast<void*>(counters.data()),
-			kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-			kParallelize6DTile1DTileN,
-			0 /* flags */);
-	}
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
 
-	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-								<< "(expected: " << kIncrementIterations6D << ")";
-						}
-					}
-				}
-			}
-		}
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
 	}
+
+	pthreadpool_parallelize_nd(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_nd_t>(IncrementND),
+		static_cast<void*>(&context),
+		7, kParallelizeND7DRange, kParallelizeND7DTile,
+		PTHREADPOOL_FLAG_GUIDED_SCHEDULE);
+
+	ExpectEachItemProcessedOnceND(counters);
 }
 
-TEST(Parallelize6DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+TEST(ParallelizeND, MultiThreadPool7DEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(ItemsND(7, kParallelizeND7DRange));
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9436,43 +11940,67 @@ TEST(Parallelize6DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
-		pthreadpool_parallelize_6d_tile_1d(
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		IncrementNDContext context = { 7, kParallelizeND7DRange, kParallelizeND7DTile, counters.data() };
+		pthreadpool_parallelize_nd(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
-			static_cast<void*>(counters.data()),
-			kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-			kParallelize6DTile1DTileN,
+			reinterpret_cast<pthreadpool_task_nd_t>(IncrementND),
+			static_cast<void*>(&context),
+			7, kParallelizeND7DRange, kParallelizeND7DTile,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-								<< "(expected: " << kIncrementIterations6D << ")";
-						}
-					}
-				}
-			}
-		}
+	for (size_t i = 0; i < counters.size(); i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-static void IncrementSame6DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
-	for (size_t n = start_n; n < start_n + tile_n; n++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+struct IncrementNDRangeContext {
+	size_t num_dims;
+	const size_t* range;
+	std::atomic_int* counters;
+};
+
+static void IncrementNDRange(IncrementNDRangeContext* context, const size_t* index, size_t start, size_t end) {
+	const size_t last = context->num_dims - 1;
+	size_t row = 0;
+	for (size_t d = 0; d < last; d++) {
+		EXPECT_LT(index[d], context->range[d]);
+		row = row * context->range[d] + index[d];
+	}
+	EXPECT_LT(start, end);
+	EXPECT_LE(end, context->range[last]);
+	EXPECT_EQ(start % kParallelizeNDRangeAlignment, 0);
+	if (end != context->range[last]) {
+		EXPECT_EQ(end % kParallelizeNDRangeAlignment, 0);
+	}
+	for (size_t i = start; i < end; i++) {
+		context->counters[row * context->range[last] + i].fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize6DTile1D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(ParallelizeNDRange, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(ItemsND(7, kParallelizeND7DRange));
+	IncrementNDRangeContext context = { 7, kParallelizeND7DRange, counters.data() };
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_nd_range(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_nd_range_t>(IncrementNDRange),
+		static_cast<void*>(&context),
+		7, kParallelizeND7DRange, kParallelizeNDRangeAlignment,
+		0 /* flags */);
+
+	ExpectEachItemProcessedOnceND(counters);
+}
+
+TEST(ParallelizeNDRange, MultiThreadPool1DEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	IncrementNDRangeContext context = { 1, &kParallelize1DRange, counters.data() };
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9481,28 +12009,40 @@ TEST(Parallelize6DTile1D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_1d(
+	pthreadpool_parallelize_nd_range(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(IncrementSame6DTile1D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
+		reinterpret_cast<pthreadpool_task_nd_range_t>(IncrementNDRange),
+		static_cast<void*>(&context),
+		1, &kParallelize1DRange, kParallelizeNDRangeAlignment,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+
+	ExpectEachItemProcessedOnceND(counters);
 }
 
-static void WorkImbalance6DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
-	num_processed_items->fetch_add(tile_n, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && l == 0 && m == 0 && start_n == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN) {
-			std::atomic_thread_fence(std::memory_order_acquire);
-		}
+TEST(ParallelizeNDRange, MultiThreadPool4DEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(ItemsND(4, kParallelizeND4DRange));
+	IncrementNDRangeContext context = { 4, kParallelizeND4DRange, counters.data() };
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
 	}
+
+	pthreadpool_parallelize_nd_range(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_nd_range_t>(IncrementNDRange),
+		static_cast<void*>(&context),
+		4, kParallelizeND4DRange, kParallelizeNDRangeAlignment,
+		0 /* flags */);
+
+	ExpectEachItemProcessedOnceND(counters);
 }
 
-TEST(Parallelize6DTile1D, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(ParallelizeNDRange, MultiThreadPool7DGuidedScheduleEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(ItemsND(7, kParallelizeND7DRange));
+	IncrementNDRangeContext context = { 7, kParallelizeND7DRange, counters.data() };
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9511,32 +12051,112 @@ TEST(Parallelize6DTile1D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_1d(
+	pthreadpool_parallelize_nd_range(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(WorkImbalance6DTile1D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+		reinterpret_cast<pthreadpool_task_nd_range_t>(IncrementNDRange),
+		static_cast<void*>(&context),
+		7, kParallelizeND7DRange, kParallelizeNDRangeAlignment,
+		PTHREADPOOL_FLAG_GUIDED_SCHEDULE);
+
+	ExpectEachItemProcessedOnceND(counters);
 }
 
-static void ComputeNothing6DTile2D(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
+typedef std::unique_ptr<pthreadpool_graph, decltype(&pthreadpool_graph_destroy)> auto_pthreadpool_graph_t;
+
+const size_t kGraphDiamondNodes = 4;
+const size_t kGraphDiamondEdges[][2] = { { 0, 1 }, { 0, 2 }, { 1, 3 }, { 2, 3 } };
+
+struct GraphNodeContext {
+	size_t node;
+	std::atomic_size_t* completed_items;
+	std::atomic_bool* out_of_order;
+};
+
+static void ProcessGraphNode1D(GraphNodeContext* context, size_t i) {
+	for (const auto& edge : kGraphDiamondEdges) {
+		if (edge[1] == context->node &&
+			context->completed_items[edge[0]].load(std::memory_order_acquire) != kParallelize1DRange)
+		{
+			context->out_of_order->store(true, std::memory_order_relaxed);
+		}
+	}
+	context->completed_items[context->node].fetch_add(1, std::memory_order_release);
 }
 
-TEST(Parallelize6DTile2D, SingleThreadPoolCompletes) {
+static void TestGraphDiamond(pthreadpool_t threadpool, size_t runs) {
+	auto_pthreadpool_graph_t graph(pthreadpool_graph_create(), pthreadpool_graph_destroy);
+	ASSERT_TRUE(graph.get());
+
+	std::vector<std::atomic_size_t> completed_items(kGraphDiamondNodes);
+	std::atomic_bool out_of_order(false);
+	std::vector<GraphNodeContext> contexts(kGraphDiamondNodes);
+	for (size_t node = 0; node < kGraphDiamondNodes; node++) {
+		contexts[node] = GraphNodeContext{ node, completed_items.data(), &out_of_order };
+		EXPECT_EQ(pthreadpool_graph_add_1d(
+			graph.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(ProcessGraphNode1D),
+			static_cast<void*>(&contexts[node]),
+			kParallelize1DRange,
+			0 /* flags */), node);
+	}
+	for (const auto& edge : kGraphDiamondEdges) {
+		EXPECT_EQ(pthreadpool_graph_add_dependency(graph.get(), edge[0], edge[1]), 1);
+	}
+
+	for (size_t run = 0; run < runs; run++) {
+		for (std::atomic_size_t& items : completed_items) {
+			items.store(0, std::memory_order_relaxed);
+		}
+		pthreadpool_graph_run(threadpool, graph.get(), 0 /* flags */);
+
+		for (size_t node = 0; node < kGraphDiamondNodes; node++) {
+			EXPECT_EQ(completed_items[node].load(std::memory_order_relaxed), kParallelize1DRange)
+				<< "Node " << node << " processed " << completed_items[node].load(std::memory_order_relaxed) << " items "
+				<< "(expected: " << kParallelize1DRange << ")";
+		}
+	}
+	EXPECT_FALSE(out_of_order.load(std::memory_order_relaxed))
+		<< "Node started before its dependencies completed";
+}
+
+TEST(Graph, AddDependencyRejectsBackwardEdges) {
+	auto_pthreadpool_graph_t graph(pthreadpool_graph_create(), pthreadpool_graph_destroy);
+	ASSERT_TRUE(graph.get());
+
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	for (size_t node = 0; node < 2; node++) {
+		pthreadpool_graph_add_1d(
+			graph.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(counters.data()),
+			kParallelize1DRange,
+			0 /* flags */);
+	}
+
+	EXPECT_EQ(pthreadpool_graph_add_dependency(graph.get(), 1, 0), 0);
+	EXPECT_EQ(pthreadpool_graph_add_dependency(graph.get(), 1, 1), 0);
+	EXPECT_EQ(pthreadpool_graph_add_dependency(graph.get(), 0, 2), 0);
+	EXPECT_EQ(pthreadpool_graph_add_dependency(graph.get(), 0, 1), 1);
+}
+
+TEST(Graph, EmptyGraph) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	auto_pthreadpool_graph_t graph(pthreadpool_graph_create(), pthreadpool_graph_destroy);
+	ASSERT_TRUE(graph.get());
+
+	pthreadpool_graph_run(threadpool.get(), graph.get(), 0 /* flags */);
+}
+
+TEST(Graph, SingleThreadPoolDependenciesCompleteFirst) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d_tile_2d(threadpool.get(),
-		ComputeNothing6DTile2D,
-		nullptr,
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-		0 /* flags */);
+	TestGraphDiamond(threadpool.get(), 1);
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolCompletes) {
+TEST(Graph, MultiThreadPoolDependenciesCompleteFirst) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -9544,40 +12164,64 @@ TEST(Parallelize6DTile2D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_2d(
-		threadpool.get(),
-		ComputeNothing6DTile2D,
-		nullptr,
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-		0 /* flags */);
-}
-
-static void CheckBounds6DTile2D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
-	EXPECT_LT(i, kParallelize6DTile2DRangeI);
-	EXPECT_LT(j, kParallelize6DTile2DRangeJ);
-	EXPECT_LT(k, kParallelize6DTile2DRangeK);
-	EXPECT_LT(l, kParallelize6DTile2DRangeL);
-	EXPECT_LT(start_m, kParallelize6DTile2DRangeM);
-	EXPECT_LT(start_n, kParallelize6DTile2DRangeN);
-	EXPECT_LE(start_m + tile_m, kParallelize6DTile2DRangeM);
-	EXPECT_LE(start_n + tile_n, kParallelize6DTile2DRangeN);
+	TestGraphDiamond(threadpool.get(), kIncrementIterations);
 }
 
-TEST(Parallelize6DTile2D, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+TEST(Graph, MultiThreadPoolIndependentNodesEachItemProcessedOnce) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d_tile_2d(
-		threadpool.get(),
-		CheckBounds6DTile2D,
-		nullptr,
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	auto_pthreadpool_graph_t graph(pthreadpool_graph_create(), pthreadpool_graph_destroy);
+	ASSERT_TRUE(graph.get());
+
+	std::vector<std::atomic_int> counters_1d(kParallelize1DRange);
+	std::vector<std::atomic_int> counters_1d_tile_1d(kParallelize1DTile1DRange);
+	std::vector<std::atomic_int> counters_2d(kParallelize2DRangeI * kParallelize2DRangeJ);
+	std::vector<std::atomic_int> counters_2d_tile_2d(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+	pthreadpool_graph_add_1d(
+		graph.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters_1d.data()),
+		kParallelize1DRange,
+		0 /* flags */);
+	pthreadpool_graph_add_1d_tile_1d(
+		graph.get(),
+		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(Increment1DTile1D),
+		static_cast<void*>(counters_1d_tile_1d.data()),
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		0 /* flags */);
+	pthreadpool_graph_add_2d(
+		graph.get(),
+		reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
+		static_cast<void*>(counters_2d.data()),
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
+	pthreadpool_graph_add_2d_tile_2d(
+		graph.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters_2d_tile_2d.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+
+	pthreadpool_graph_run(threadpool.get(), graph.get(), 0 /* flags */);
+
+	for (const std::vector<std::atomic_int>* counters : { &counters_1d, &counters_1d_tile_1d, &counters_2d, &counters_2d_tile_2d }) {
+		for (size_t i = 0; i < counters->size(); i++) {
+			EXPECT_EQ((*counters)[i].load(std::memory_order_relaxed), 1)
+				<< "Element " << i << " was processed " << (*counters)[i].load(std::memory_order_relaxed) << " times "
+				<< "(expected: 1)";
+		}
+	}
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolAllItemsInBounds) {
+TEST(Graph, MultiThreadPoolTryIdleThreadPool) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -9585,100 +12229,169 @@ TEST(Parallelize6DTile2D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_2d(
-		threadpool.get(),
-		CheckBounds6DTile2D,
-		nullptr,
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+	auto_pthreadpool_graph_t graph(pthreadpool_graph_create(), pthreadpool_graph_destroy);
+	ASSERT_TRUE(graph.get());
+
+	pthreadpool_graph_add_1d(
+		graph.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
 		0 /* flags */);
-}
 
-static void CheckTiling6DTile2D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
-	EXPECT_GT(tile_m, 0);
-	EXPECT_LE(tile_m, kParallelize6DTile2DTileM);
-	EXPECT_EQ(start_m % kParallelize6DTile2DTileM, 0);
-	EXPECT_EQ(tile_m, std::min<size_t>(kParallelize6DTile2DTileM, kParallelize6DTile2DRangeM - start_m));
+	pthreadpool_graph_run(threadpool.get(), graph.get(), PTHREADPOOL_FLAG_TRY);
+	EXPECT_EQ(pthreadpool_last_try_ran_inline(), 0);
 
-	EXPECT_GT(tile_n, 0);
-	EXPECT_LE(tile_n, kParallelize6DTile2DTileN);
-	EXPECT_EQ(start_n % kParallelize6DTile2DTileN, 0);
-	EXPECT_EQ(tile_n, std::min<size_t>(kParallelize6DTile2DTileN, kParallelize6DTile2DRangeN - start_n));
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: 1)";
+	}
 }
 
-TEST(Parallelize6DTile2D, SingleThreadPoolUniformTiling) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+TEST(Graph, MultiThreadPoolTryBusyThreadPoolRunsInline) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d_tile_2d(
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	auto_pthreadpool_graph_t graph(pthreadpool_graph_create(), pthreadpool_graph_destroy);
+	ASSERT_TRUE(graph.get());
+
+	TryBusyContext try_context;
+	try_context.processed_counters = counters.data();
+	try_context.other_thread.store(false, std::memory_order_relaxed);
+	for (size_t node = 0; node < 2; node++) {
+		pthreadpool_graph_add_1d(
+			graph.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(IncrementOnCaller1D),
+			static_cast<void*>(&try_context),
+			kParallelize1DRange,
+			0 /* flags */);
+	}
+	EXPECT_EQ(pthreadpool_graph_add_dependency(graph.get(), 0, 1), 1);
+
+	/* The first computation waits until the graph finishes */
+	ConcurrentJobsContext busy_context;
+	busy_context.outer_started.store(false, std::memory_order_relaxed);
+	busy_context.concurrent_finished.store(false, std::memory_order_relaxed);
+	int ran_inline = 0;
+	std::thread caller([&threadpool, &graph, &busy_context, &try_context, &ran_inline]() {
+		try_context.caller = std::this_thread::get_id();
+		while (!busy_context.outer_started.load(std::memory_order_relaxed)) {
+			std::this_thread::yield();
+		}
+		pthreadpool_graph_run(threadpool.get(), graph.get(), PTHREADPOOL_FLAG_TRY);
+		ran_inline = pthreadpool_last_try_ran_inline();
+		busy_context.concurrent_finished.store(true, std::memory_order_relaxed);
+	});
+
+	pthreadpool_parallelize_1d(
 		threadpool.get(),
-		CheckTiling6DTile2D,
-		nullptr,
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		reinterpret_cast<pthreadpool_task_1d_t>(WaitForConcurrentJob1D),
+		static_cast<void*>(&busy_context),
+		kParallelize1DRange,
 		0 /* flags */);
+	caller.join();
+
+	EXPECT_EQ(ran_inline, 1);
+	EXPECT_FALSE(try_context.other_thread.load(std::memory_order_relaxed))
+		<< "Items were processed by threads other than the caller";
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 2)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: 2)";
+	}
+}
+
+typedef std::unique_ptr<pthreadpool_task_group, decltype(&pthreadpool_task_group_destroy)> auto_pthreadpool_task_group_t;
+
+static const size_t kTaskGroupRange = 1000;
+static const size_t kTaskGroupLeafSize = 7;
+
+struct TaskGroupRangeContext {
+	pthreadpool_t threadpool;
+	size_t start;
+	size_t end;
+	std::atomic_int* counters;
+};
+
+/* Splits the range in halves with nested task groups until it is small enough to process */
+static void ProcessTaskGroupRange(TaskGroupRangeContext* context) {
+	if (context->end - context->start <= kTaskGroupLeafSize) {
+		for (size_t i = context->start; i < context->end; i++) {
+			context->counters[i].fetch_add(1, std::memory_order_relaxed);
+		}
+		return;
+	}
+
+	const size_t middle = context->start + (context->end - context->start) / 2;
+	TaskGroupRangeContext halves[2] = {
+		{ context->threadpool, context->start, middle, context->counters },
+		{ context->threadpool, middle, context->end, context->counters },
+	};
+	auto_pthreadpool_task_group_t group(pthreadpool_task_group_create(context->threadpool), pthreadpool_task_group_destroy);
+	ASSERT_TRUE(group.get());
+	for (TaskGroupRangeContext& half : halves) {
+		pthreadpool_task_group_spawn(
+			group.get(),
+			reinterpret_cast<pthreadpool_spawn_task_t>(ProcessTaskGroupRange),
+			static_cast<void*>(&half));
+	}
+	pthreadpool_task_group_wait(group.get());
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolUniformTiling) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
+static void TestTaskGroupRecursion(pthreadpool_t threadpool) {
+	std::vector<std::atomic_int> counters(kTaskGroupRange);
+	TaskGroupRangeContext context = { threadpool, 0, kTaskGroupRange, counters.data() };
+
+	auto_pthreadpool_task_group_t group(pthreadpool_task_group_create(threadpool), pthreadpool_task_group_destroy);
+	ASSERT_TRUE(group.get());
+	pthreadpool_task_group_spawn(
+		group.get(),
+		reinterpret_cast<pthreadpool_spawn_task_t>(ProcessTaskGroupRange),
+		static_cast<void*>(&context));
+	pthreadpool_task_group_wait(group.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
+	for (size_t i = 0; i < kTaskGroupRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: 1)";
 	}
+}
 
-	pthreadpool_parallelize_6d_tile_2d(
-		threadpool.get(),
-		CheckTiling6DTile2D,
-		nullptr,
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-		0 /* flags */);
+static void IncrementTaskGroupCounter(std::atomic_int* counter) {
+	counter->fetch_add(1, std::memory_order_relaxed);
 }
 
-static void SetTrue6DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
-	for (size_t m = start_m; m < start_m + tile_m; m++) {
-		for (size_t n = start_n; n < start_n + tile_n; n++) {
-			const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
+struct TaskGroupBarrierContext {
+	std::atomic_size_t* arrived_tasks;
+	size_t expected_tasks;
+};
+
+static void WaitTaskGroupBarrier(TaskGroupBarrierContext* context) {
+	context->arrived_tasks->fetch_add(1, std::memory_order_relaxed);
+	while (context->arrived_tasks->load(std::memory_order_relaxed) < context->expected_tasks) {
+		std::atomic_thread_fence(std::memory_order_acquire);
 	}
 }
 
-TEST(Parallelize6DTile2D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+TEST(TaskGroup, NullThreadPoolRunsTasks) {
+	TestTaskGroupRecursion(nullptr);
+}
 
+TEST(TaskGroup, SingleThreadPoolRunsTasks) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d_tile_2d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(SetTrue6DTile2D),
-		static_cast<void*>(indicators.data()),
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
-						}
-					}
-				}
-			}
-		}
-	}
+	TestTaskGroupRecursion(threadpool.get());
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
-
+TEST(TaskGroup, MultiThreadPoolRunsRecursiveTasks) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -9686,75 +12399,69 @@ TEST(Parallelize6DTile2D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_2d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(SetTrue6DTile2D),
-		static_cast<void*>(indicators.data()),
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
-						}
-					}
-				}
-			}
-		}
+	for (size_t run = 0; run < 10; run++) {
+		TestTaskGroupRecursion(threadpool.get());
 	}
 }
 
-static void Increment6DTile2D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
-	for (size_t m = start_m; m < start_m + tile_m; m++) {
-		for (size_t n = start_n; n < start_n + tile_n; n++) {
-			const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+TEST(TaskGroup, MultiThreadPoolWaitWithoutTasks) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	auto_pthreadpool_task_group_t group(pthreadpool_task_group_create(threadpool.get()), pthreadpool_task_group_destroy);
+	ASSERT_TRUE(group.get());
+	pthreadpool_task_group_wait(group.get());
+}
+
+TEST(TaskGroup, MultiThreadPoolGroupReusedAfterWait) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	auto_pthreadpool_task_group_t group(pthreadpool_task_group_create(threadpool.get()), pthreadpool_task_group_destroy);
+	ASSERT_TRUE(group.get());
+
+	std::atomic_int counter(0);
+	for (size_t wait = 1; wait <= 3; wait++) {
+		for (size_t i = 0; i < kTaskGroupRange; i++) {
+			pthreadpool_task_group_spawn(
+				group.get(),
+				reinterpret_cast<pthreadpool_spawn_task_t>(IncrementTaskGroupCounter),
+				static_cast<void*>(&counter));
 		}
+		pthreadpool_task_group_wait(group.get());
+		EXPECT_EQ(counter.load(std::memory_order_relaxed), wait * kTaskGroupRange);
 	}
 }
 
-TEST(Parallelize6DTile2D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+TEST(TaskGroup, MultiThreadPoolAllThreadsRunTasks) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d_tile_2d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
-		static_cast<void*>(counters.data()),
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-		0 /* flags */);
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool.get());
+	if (threads_count <= 1) {
+		GTEST_SKIP();
+	}
 
-	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-						}
-					}
-				}
-			}
-		}
+	/* Tasks finish only once each thread runs one of them */
+	std::atomic_size_t arrived_tasks(0);
+	TaskGroupBarrierContext context = { &arrived_tasks, threads_count };
+	auto_pthreadpool_task_group_t group(pthreadpool_task_group_create(threadpool.get()), pthreadpool_task_group_destroy);
+	ASSERT_TRUE(group.get());
+	for (size_t i = 0; i < threads_count; i++) {
+		pthreadpool_task_group_spawn(
+			group.get(),
+			reinterpret_cast<pthreadpool_spawn_task_t>(WaitTaskGroupBarrier),
+			static_cast<void*>(&context));
 	}
+	pthreadpool_task_group_wait(group.get());
+	EXPECT_EQ(arrived_tasks.load(std::memory_order_relaxed), threads_count);
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+static void ProcessTaskGroupRangeFromParallelize(TaskGroupRangeContext* contexts, size_t i) {
+	ProcessTaskGroupRange(&contexts[i]);
+}
 
+TEST(TaskGroup, MultiThreadPoolTasksSpawnedFromParallelize) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -9762,70 +12469,71 @@ TEST(Parallelize6DTile2D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_2d(
+	/* Each item of the parallelization recursively processes its part of the range with task groups */
+	const size_t parts = 4;
+	std::vector<std::atomic_int> counters(kTaskGroupRange);
+	std::vector<TaskGroupRangeContext> contexts;
+	for (size_t part = 0; part < parts; part++) {
+		contexts.push_back(TaskGroupRangeContext{
+			threadpool.get(), part * kTaskGroupRange / parts, (part + 1) * kTaskGroupRange / parts, counters.data() });
+	}
+	pthreadpool_parallelize_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
-		static_cast<void*>(counters.data()),
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		reinterpret_cast<pthreadpool_task_1d_t>(ProcessTaskGroupRangeFromParallelize),
+		static_cast<void*>(contexts.data()),
+		parts,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-						}
-					}
-				}
-			}
-		}
+	for (size_t i = 0; i < kTaskGroupRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: 1)";
 	}
 }
 
-TEST(Parallelize6DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+static const size_t kTaskGroupNestedRange = 2000;
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
+struct TaskGroupNestedContext {
+	pthreadpool_t threadpool;
+	std::atomic_int* counters;
+	std::atomic_bool task_started;
+};
 
-	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
-		pthreadpool_parallelize_6d_tile_2d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
-			static_cast<void*>(counters.data()),
-			kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-			kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-			0 /* flags */);
+static void SleepAfterStart(TaskGroupNestedContext* context) {
+	context->task_started.store(true, std::memory_order_relaxed);
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+}
+
+/* The first item waits for a task which another thread runs, while the rest of the range is still being processed */
+static void WaitTaskGroupInNestedItem(TaskGroupNestedContext* context, size_t i) {
+	context->counters[i].fetch_add(1, std::memory_order_relaxed);
+	if (i != 0) {
+		return;
 	}
 
-	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-								<< "(expected: " << kIncrementIterations6D << ")";
-						}
-					}
-				}
-			}
-		}
+	auto_pthreadpool_task_group_t group(pthreadpool_task_group_create(context->threadpool), pthreadpool_task_group_destroy);
+	ASSERT_TRUE(group.get());
+	pthreadpool_task_group_spawn(
+		group.get(),
+		reinterpret_cast<pthreadpool_spawn_task_t>(SleepAfterStart),
+		static_cast<void*>(context));
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+	while (!context->task_started.load(std::memory_order_relaxed) && std::chrono::steady_clock::now() < deadline) {
+		std::this_thread::yield();
 	}
+	pthreadpool_task_group_wait(group.get());
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+static void ParallelizeNestedWithTaskGroupWait(TaskGroupNestedContext* context) {
+	pthreadpool_parallelize_1d(
+		context->threadpool,
+		reinterpret_cast<pthreadpool_task_1d_t>(WaitTaskGroupInNestedItem),
+		static_cast<void*>(context),
+		kTaskGroupNestedRange,
+		0 /* flags */);
+}
 
+TEST(TaskGroup, MultiThreadPoolWaitInsideNestedParallelize) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -9833,76 +12541,114 @@ TEST(Parallelize6DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
-		pthreadpool_parallelize_6d_tile_2d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
-			static_cast<void*>(counters.data()),
-			kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-			kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-			0 /* flags */);
-	}
+	for (size_t run = 0; run < 10; run++) {
+		std::vector<std::atomic_int> counters(kTaskGroupNestedRange);
+		TaskGroupNestedContext context;
+		context.threadpool = threadpool.get();
+		context.counters = counters.data();
+		context.task_started.store(false, std::memory_order_relaxed);
 
-	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-								<< "(expected: " << kIncrementIterations6D << ")";
-						}
-					}
-				}
-			}
+		auto_pthreadpool_task_group_t group(pthreadpool_task_group_create(threadpool.get()), pthreadpool_task_group_destroy);
+		ASSERT_TRUE(group.get());
+		pthreadpool_task_group_spawn(
+			group.get(),
+			reinterpret_cast<pthreadpool_spawn_task_t>(ParallelizeNestedWithTaskGroupWait),
+			static_cast<void*>(&context));
+		pthreadpool_task_group_wait(group.get());
+
+		for (size_t i = 0; i < kTaskGroupNestedRange; i++) {
+			EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+				<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+				<< "(expected: 1)";
 		}
 	}
 }
 
-static void IncrementSame6DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
-	for (size_t m = start_m; m < start_m + tile_m; m++) {
-		for (size_t n = start_n; n < start_n + tile_n; n++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+static const size_t kPipelineStages = 3;
+
+struct PipelineContext {
+	/* The number of stages each item went through */
+	std::atomic_size_t* item_stages;
+	/* The thread which ran the first stage of each tile */
+	std::thread::id* tile_threads;
+	std::atomic_bool* out_of_order;
+	std::atomic_bool* thread_changed;
+};
+
+template<size_t kStage>
+static void ProcessPipelineStage(PipelineContext* context, size_t start_i, size_t tile_i) {
+	const size_t tile_index = start_i / kParallelize1DTile1DTile;
+	if (kStage == 0) {
+		context->tile_threads[tile_index] = std::this_thread::get_id();
+	} else if (context->tile_threads[tile_index] != std::this_thread::get_id()) {
+		context->thread_changed->store(true, std::memory_order_relaxed);
+	}
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		if (context->item_stages[i].load(std::memory_order_relaxed) != kStage) {
+			context->out_of_order->store(true, std::memory_order_relaxed);
 		}
+		context->item_stages[i].store(kStage + 1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+static const pthreadpool_task_1d_tile_1d_t kPipelineStageFunctions[kPipelineStages] = {
+	reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(ProcessPipelineStage<0>),
+	reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(ProcessPipelineStage<1>),
+	reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(ProcessPipelineStage<2>),
+};
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
+static void TestPipeline(pthreadpool_t threadpool) {
+	std::vector<std::atomic_size_t> item_stages(kParallelize1DTile1DRange);
+	std::vector<std::thread::id> tile_threads(
+		(kParallelize1DTile1DRange + kParallelize1DTile1DTile - 1) / kParallelize1DTile1DTile);
+	std::atomic_bool out_of_order(false);
+	std::atomic_bool thread_changed(false);
+	PipelineContext context = { item_stages.data(), tile_threads.data(), &out_of_order, &thread_changed };
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
+	pthreadpool_parallelize_1d_tile_1d_pipeline(
+		threadpool,
+		kPipelineStageFunctions,
+		kPipelineStages,
+		static_cast<void*>(&context),
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+		EXPECT_EQ(item_stages[i].load(std::memory_order_relaxed), kPipelineStages)
+			<< "Element " << i << " went through " << item_stages[i].load(std::memory_order_relaxed) << " stages "
+			<< "(expected: " << kPipelineStages << ")";
 	}
+	EXPECT_FALSE(out_of_order.load(std::memory_order_relaxed))
+		<< "Stage started before the previous stage of the tile completed";
+	EXPECT_FALSE(thread_changed.load(std::memory_order_relaxed))
+		<< "Stages of a tile ran on different threads";
+}
 
-	pthreadpool_parallelize_6d_tile_2d(
+TEST(Parallelize1DTile1DPipeline, ZeroStages) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_1d_tile_1d_pipeline(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(IncrementSame6DTile2D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		nullptr,
+		0,
+		nullptr,
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
 }
 
-static void WorkImbalance6DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
-	num_processed_items->fetch_add(tile_m * tile_n, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && l == 0 && start_m == 0 && start_n == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN) {
-			std::atomic_thread_fence(std::memory_order_acquire);
-		}
-	}
+TEST(Parallelize1DTile1DPipeline, NullThreadPoolStagesRunInOrder) {
+	TestPipeline(nullptr);
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize1DTile1DPipeline, SingleThreadPoolStagesRunInOrder) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	TestPipeline(threadpool.get());
+}
 
+TEST(Parallelize1DTile1DPipeline, MultiThreadPoolStagesRunInOrder) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -9910,12 +12656,5 @@ TEST(Parallelize6DTile2D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_2d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(WorkImbalance6DTile2D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+	TestPipeline(threadpool.get());
 }